@@ -4,7 +4,9 @@
 #include <iostream>
 #include <string>
 #include <functional>
+#include <new>
 #include <stdexcept>
+#include "NodePool.h"
 
 struct PerformanceData {
     int score;
@@ -19,11 +21,37 @@ struct Node {
 
 class DoublyLinkedList {
 private:
+    typedef NodePool<sizeof(Node), alignof(Node)> Pool; // ノード領域を確保するプール
+
     Node* head;
     Node* tail;
     size_t size;
     std::function<bool()> simulateFailure;
 
+    // ノードを生成 (領域はプールから確保し、確保できない場合は nullptr を返す)
+    static Node* createNode(const PerformanceData& data) {
+        void* memory = nullptr;
+        try {
+            memory = Pool::Allocate();
+        }
+        catch (const std::bad_alloc&) {
+            return nullptr;
+        }
+        try {
+            return new (memory) Node{ data, nullptr, nullptr };
+        }
+        catch (...) {
+            Pool::Deallocate(memory);
+            throw;
+        }
+    }
+
+    // ノードを破棄 (領域はプールに返す)
+    static void destroyNode(Node* node) noexcept {
+        node->~Node();
+        Pool::Deallocate(node);
+    }
+
 public:
     // コンストラクタ: 空のリストを作成
     DoublyLinkedList(std::function<bool()> failureSimulation = nullptr) noexcept
@@ -137,7 +165,7 @@ public:
         if (current == tail) {
             tail = current->prev;
         }
-        delete current;
+        destroyNode(current);
         --size; // サイズをデクリメント
         return true;
     }
@@ -153,13 +181,18 @@ public:
         Node* current = head;
         while (current) {
             Node* next = current->next;
-            delete current;
+            destroyNode(current);
             current = next;
         }
         head = tail = nullptr;
         size = 0; // サイズをリセット
     }
 
+    // デストラクタ: 全ノードを削除
+    ~DoublyLinkedList() {
+        clear();
+    }
+
     class ConstIterator {
     private:
         const Node* current;
@@ -259,7 +292,7 @@ public:
 
         // 位置が終端の場合、ノードを末尾に追加
         if (pos == end()) {
-            Node* newNode = new (std::nothrow) Node{ data, nullptr, nullptr };
+            Node* newNode = createNode(data);
             if (!newNode) return false;
             if (!head) {
                 head = tail = newNode;
@@ -278,7 +311,7 @@ public:
             return false;
         }
 
-        Node* newNode = new (std::nothrow) Node{ data, nullptr, nullptr };
+        Node* newNode = createNode(data);
         if (!newNode) return false;
 
         Node* prevNode = pos.getCurrent()->prev;
@@ -0,0 +1,357 @@
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../DLLTest2/CompactDLL.h"
+#include "../DLLTest2/DLL.h"
+#include "../DLLTest2/IntrusiveDLL.h"
+#include "../DLLTest2/UnrolledDLL.h"
+#include "../DLLTest2/XorDLL.h"
+
+using PerformanceData = std::pair<int, std::string>;
+
+// トリビアルにコピーできる要素 (CompactDoublyLinkedList の比較用)
+struct Score {
+    int id;
+    float value;
+};
+
+// 処理時間を計る関数
+// 入力: 計測する処理 (Function function)
+// 戻り値: 処理時間 (ミリ秒)
+template<typename Function>
+double MeasureMilliseconds(Function function) {
+    auto start = std::chrono::steady_clock::now();
+    function();
+    auto finish = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(finish - start).count();
+}
+
+// 要素のキーを取り出す関数
+// 入力: 要素 (int または PerformanceData)
+inline long long Key(int value) {
+    return value;
+}
+
+inline long long Key(const PerformanceData& data) {
+    return data.first;
+}
+
+inline long long Key(const Score& score) {
+    return score.id;
+}
+
+// 侵入型リストに入れる要素 (フックと値を持つ)
+template<typename T>
+struct HookedItem : IntrusiveListHook<> {
+    T value;
+
+    HookedItem(const T& value) : value(value) {}
+};
+
+template<typename T>
+long long Key(const HookedItem<T>& item) {
+    return Key(item.value);
+}
+
+// 確保中のバイト数 (CountingAllocator が数える)
+size_t allocatedBytes = 0;
+
+// 確保したバイト数を数えるアロケータ (要素あたりのメモリ量の計測用)
+template<typename T>
+class CountingAllocator {
+public:
+    typedef T value_type;
+
+    CountingAllocator() {}
+    template<typename U>
+    CountingAllocator(const CountingAllocator<U>&) {}
+
+    T* allocate(size_t count) {
+        allocatedBytes += count * sizeof(T);
+        return std::allocator<T>().allocate(count);
+    }
+
+    void deallocate(T* pointer, size_t count) {
+        allocatedBytes -= count * sizeof(T);
+        std::allocator<T>().deallocate(pointer, count);
+    }
+
+    bool operator==(const CountingAllocator&) const { return true; }
+    bool operator!=(const CountingAllocator&) const { return false; }
+};
+
+// 走査の結果を捨てずに残すための変数 (最適化で走査が消えないようにする)
+volatile long long scanSink = 0;
+
+// 先頭から末尾までキーの合計を求める関数
+// 入力: コンテナ (const Container& container)
+// 戻り値: キーの合計
+template<typename Container>
+long long SumKeys(const Container& container) {
+    long long sum = 0;
+    for (auto it = container.begin(); it != container.end(); ++it) {
+        sum += Key(*it);
+    }
+    return sum;
+}
+
+// 先頭から position 番目の要素を指すイテレータを取得する関数 (リストは先頭からたどる)
+// 入力: リスト (List& list), 位置 (int position)
+// 戻り値: position 番目の要素を指すイテレータ (position がサイズと等しい場合は end())
+template<typename List>
+typename List::Iterator Advance(List& list, int position) {
+    auto it = list.begin();
+    for (int i = 0; i < position; ++i) {
+        ++it;
+    }
+    return it;
+}
+
+// 配列のイテレータを取得する関数
+// 入力: 配列 (std::vector<T>& vector), 位置 (int position)
+// 戻り値: position 番目の要素を指すイテレータ
+template<typename T>
+typename std::vector<T>::iterator Advance(std::vector<T>& vector, int position) {
+    return vector.begin() + position;
+}
+
+// リストの末尾に追加する関数
+// 入力: リスト (List& list), データ (const T& data)
+template<typename List, typename T>
+void Append(List& list, const T& data) {
+    list.Insert(list.end(), data);
+}
+
+template<typename T, typename A>
+void Append(std::vector<T, A>& vector, const T& data) {
+    vector.push_back(data);
+}
+
+// 位置を指定して挿入・削除する関数
+// 入力: コンテナ, 位置, (挿入の場合は) データ
+template<typename List, typename T>
+void InsertAt(List& list, int position, const T& data) {
+    list.Insert(Advance(list, position), data);
+}
+
+template<typename T>
+void InsertAt(std::vector<T>& vector, int position, const T& data) {
+    vector.insert(vector.begin() + position, data);
+}
+
+template<typename List>
+void DeleteAt(List& list, int position) {
+    list.Delete(Advance(list, position));
+}
+
+template<typename T>
+void DeleteAt(std::vector<T>& vector, int position) {
+    vector.erase(vector.begin() + position);
+}
+
+// コンテナの要素数を取得する関数
+template<typename List>
+int SizeOf(const List& list) {
+    return list.GetSize();
+}
+
+template<typename T>
+int SizeOf(const std::vector<T>& vector) {
+    return static_cast<int>(vector.size());
+}
+
+// 全要素の走査の時間を計る関数
+// 入力: コンテナ (const Container& container), 要素数 (int count)
+// 戻り値: 先頭から末尾までの走査を 10 回行った 1 要素あたりの時間 (ナノ秒)
+template<typename Container>
+double MeasureScanNanoseconds(const Container& container, int count) {
+    const int passes = 10;
+    double scan = MeasureMilliseconds([&] {
+        for (int pass = 0; pass < passes; ++pass) {
+            scanSink = scanSink + SumKeys(container);
+        }
+    });
+    return scan * 1000000.0 / (static_cast<double>(count) * passes);
+}
+
+// 走査と、走査を伴う挿入・削除の混在を計測する関数
+// 入力: 表示名 (const std::string& name), 要素数 (int count), 挿入・削除の回数 (int updates), 要素を作る関数 (MakeItem makeItem)
+// 期待結果: 末尾への追加で作ったコンテナの全要素の走査 1 要素あたりの時間 (ナノ秒) と、
+//           先頭からたどったランダムな位置への挿入・削除を交互に updates 回行う時間 (ミリ秒) を表示する
+template<typename Container, typename MakeItem>
+void MeasureScanMix(const std::string& name, int count, int updates, MakeItem makeItem) {
+    Container container;
+    for (int i = 0; i < count; ++i) {
+        Append(container, makeItem(i));
+    }
+
+    double scan = MeasureScanNanoseconds(container, count);
+
+    std::mt19937 rng(1);
+    double mix = MeasureMilliseconds([&] {
+        for (int i = 0; i < updates; ++i) {
+            int size = SizeOf(container);
+            if (i % 2 == 0) {
+                InsertAt(container, static_cast<int>(rng() % (size + 1)), makeItem(i));
+            }
+            else {
+                DeleteAt(container, static_cast<int>(rng() % size));
+            }
+        }
+    });
+
+    std::cout << name << "\t" << std::fixed << std::setprecision(2) << scan
+        << "\t" << std::setprecision(1) << mix << std::endl;
+}
+
+// 展開リストと DoublyLinkedList・std::vector の走査と挿入・削除を比較する関数
+// 入力: 要素数 (int count)
+// 期待結果: int と PerformanceData のコンテナごとに、走査と挿入・削除の混在の結果を表示する
+void BenchmarkUnrolled(int count) {
+    const int updates = 2000;
+    std::cout << "Scan and Insert/Delete Mix (" << count << " elements, " << updates << " updates)" << std::endl;
+    std::cout << "container\tscan ns/element\tmix ms" << std::endl;
+    auto makeInt = [](int i) { return i; };
+    auto makeData = [](int i) { return PerformanceData{ i, "User" }; };
+    MeasureScanMix<std::vector<int>>("int std::vector", count, updates, makeInt);
+    MeasureScanMix<DoublyLinkedList<int>>("int DoublyLinkedList", count, updates, makeInt);
+    MeasureScanMix<UnrolledDoublyLinkedList<int, 256>>("int Unrolled 256B", count, updates, makeInt);
+    MeasureScanMix<UnrolledDoublyLinkedList<int, 1024>>("int Unrolled 1KiB", count, updates, makeInt);
+    MeasureScanMix<std::vector<PerformanceData>>("PerformanceData std::vector", count, updates, makeData);
+    MeasureScanMix<DoublyLinkedList<PerformanceData>>("PerformanceData DoublyLinkedList", count, updates, makeData);
+    MeasureScanMix<UnrolledDoublyLinkedList<PerformanceData, 256>>("PerformanceData Unrolled 256B", count, updates, makeData);
+    MeasureScanMix<UnrolledDoublyLinkedList<PerformanceData, 1024>>("PerformanceData Unrolled 1KiB", count, updates, makeData);
+}
+
+// 要素あたりのメモリ量を計測する関数
+// 入力: 表示名 (const std::string& name), 要素数 (int count), 要素を作る関数 (MakeItem makeItem)
+// 期待結果: 末尾への追加で作ったコンテナが確保したバイト数を要素数で割って表示する (アロケータ自身の管理領域は含まない)
+template<typename Container, typename MakeItem>
+void MeasureBytesPerElement(const std::string& name, int count, MakeItem makeItem) {
+    size_t before = allocatedBytes;
+    Container container;
+    for (int i = 0; i < count; ++i) {
+        Append(container, makeItem(i));
+    }
+    std::cout << name << "\t" << std::fixed << std::setprecision(1)
+        << static_cast<double>(allocatedBytes - before) / count << std::endl;
+}
+
+// 添字でつなぐリストと DoublyLinkedList・std::vector のメモリ量と走査・挿入・削除を比較する関数
+// 入力: 要素数 (int count)
+// 期待結果: int と Score のコンテナごとに、要素あたりのバイト数と、走査と挿入・削除の混在の結果を表示する
+void BenchmarkCompact(int count) {
+    const int updates = 2000;
+    auto makeInt = [](int i) { return i; };
+    auto makeScore = [](int i) { return Score{ i, i * 0.5f }; };
+
+    std::cout << "Bytes per Element (" << count << " elements)" << std::endl;
+    std::cout << "container\tbytes/element" << std::endl;
+    MeasureBytesPerElement<std::vector<int, CountingAllocator<int>>>("int std::vector", count, makeInt);
+    MeasureBytesPerElement<DoublyLinkedList<int, CountingAllocator<int>>>("int DoublyLinkedList", count, makeInt);
+    MeasureBytesPerElement<CompactDoublyLinkedList<int, CountingAllocator<int>>>("int Compact", count, makeInt);
+    MeasureBytesPerElement<std::vector<Score, CountingAllocator<Score>>>("Score std::vector", count, makeScore);
+    MeasureBytesPerElement<DoublyLinkedList<Score, CountingAllocator<Score>>>("Score DoublyLinkedList", count, makeScore);
+    MeasureBytesPerElement<CompactDoublyLinkedList<Score, CountingAllocator<Score>>>("Score Compact", count, makeScore);
+
+    std::cout << "Scan and Insert/Delete Mix (" << count << " elements, " << updates << " updates)" << std::endl;
+    std::cout << "container\tscan ns/element\tmix ms" << std::endl;
+    MeasureScanMix<std::vector<int>>("int std::vector", count, updates, makeInt);
+    MeasureScanMix<DoublyLinkedList<int>>("int DoublyLinkedList", count, updates, makeInt);
+    MeasureScanMix<CompactDoublyLinkedList<int>>("int Compact", count, updates, makeInt);
+    MeasureScanMix<std::vector<Score>>("Score std::vector", count, updates, makeScore);
+    MeasureScanMix<DoublyLinkedList<Score>>("Score DoublyLinkedList", count, updates, makeScore);
+    MeasureScanMix<CompactDoublyLinkedList<Score>>("Score Compact", count, updates, makeScore);
+}
+
+// 要素あたりのメモリ量と走査の時間を計測する関数
+// 入力: 表示名 (const std::string& name), 要素数 (int count), 要素を作る関数 (MakeItem makeItem)
+// 期待結果: CountedContainer (CountingAllocator を使う型) で確保したバイト数を要素数で割った値と、
+//           Container (既定のアロケータを使う型) の全要素の走査 1 要素あたりの時間 (ナノ秒) を表示する
+template<typename CountedContainer, typename Container, typename MakeItem>
+void MeasureLean(const std::string& name, int count, MakeItem makeItem) {
+    double bytes;
+    {
+        size_t before = allocatedBytes;
+        CountedContainer counted;
+        for (int i = 0; i < count; ++i) {
+            Append(counted, makeItem(i));
+        }
+        bytes = static_cast<double>(allocatedBytes - before) / count;
+    }
+
+    Container container;
+    for (int i = 0; i < count; ++i) {
+        Append(container, makeItem(i));
+    }
+    std::cout << name << "\t" << std::fixed << std::setprecision(1) << bytes
+        << "\t" << std::setprecision(2) << MeasureScanNanoseconds(container, count) << std::endl;
+}
+
+// 侵入型リストの要素あたりのメモリ量と走査の時間を計測する関数
+// 入力: 表示名 (const std::string& name), 要素数 (int count), 要素を作る関数 (MakeItem makeItem)
+// 期待結果: 要素 (フックを含む) を配列に並べてリストにつなぎ、配列のバイト数を要素数で割った値と走査の時間を表示する
+//           リスト自身は確保を行わない
+template<typename T, typename MakeItem>
+void MeasureLeanIntrusive(const std::string& name, int count, MakeItem makeItem) {
+    size_t before = allocatedBytes;
+    std::vector<HookedItem<T>, CountingAllocator<HookedItem<T>>> storage; // リストより先に宣言し、リストが先に破棄されるようにする
+    storage.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        storage.emplace_back(makeItem(i));
+    }
+    IntrusiveDoublyLinkedList<HookedItem<T>> list;
+    for (HookedItem<T>& item : storage) {
+        list.Insert(list.end(), item);
+    }
+    std::cout << name << "\t" << std::fixed << std::setprecision(1) << static_cast<double>(allocatedBytes - before) / count
+        << "\t" << std::setprecision(2) << MeasureScanNanoseconds(list, count) << std::endl;
+}
+
+// メモリを抑えたリスト (XOR リスト・侵入型リスト・添字でつなぐリスト) と DoublyLinkedList・std::vector を比較する関数
+// 入力: 要素数 (int count)
+// 期待結果: int と Score のコンテナごとに、要素あたりのバイト数と走査 1 要素あたりの時間を表示する
+void BenchmarkLean(int count) {
+    auto makeInt = [](int i) { return i; };
+    auto makeScore = [](int i) { return Score{ i, i * 0.5f }; };
+
+    std::cout << "Bytes per Element and Scan (" << count << " elements)" << std::endl;
+    std::cout << "container\tbytes/element\tscan ns/element" << std::endl;
+    MeasureLean<std::vector<int, CountingAllocator<int>>, std::vector<int>>("int std::vector", count, makeInt);
+    MeasureLean<DoublyLinkedList<int, CountingAllocator<int>>, DoublyLinkedList<int>>("int DoublyLinkedList", count, makeInt);
+    MeasureLean<XorDoublyLinkedList<int, CountingAllocator<int>>, XorDoublyLinkedList<int>>("int Xor", count, makeInt);
+    MeasureLeanIntrusive<int>("int Intrusive", count, makeInt);
+    MeasureLean<CompactDoublyLinkedList<int, CountingAllocator<int>>, CompactDoublyLinkedList<int>>("int Compact", count, makeInt);
+    MeasureLean<std::vector<Score, CountingAllocator<Score>>, std::vector<Score>>("Score std::vector", count, makeScore);
+    MeasureLean<DoublyLinkedList<Score, CountingAllocator<Score>>, DoublyLinkedList<Score>>("Score DoublyLinkedList", count, makeScore);
+    MeasureLean<XorDoublyLinkedList<Score, CountingAllocator<Score>>, XorDoublyLinkedList<Score>>("Score Xor", count, makeScore);
+    MeasureLeanIntrusive<Score>("Score Intrusive", count, makeScore);
+    MeasureLean<CompactDoublyLinkedList<Score, CountingAllocator<Score>>, CompactDoublyLinkedList<Score>>("Score Compact", count, makeScore);
+}
+
+// 入力: コマンドライン引数 (ベンチマーク名, 要素数)
+// 期待結果: 指定したベンチマークを実行して結果を表示する
+int main(int argc, char** argv) {
+    std::string name = argc > 1 ? argv[1] : "unrolled";
+    int count = argc > 2 ? std::atoi(argv[2]) : 1000000;
+
+    if (name == "unrolled") {
+        BenchmarkUnrolled(count);
+    }
+    else if (name == "compact") {
+        BenchmarkCompact(count);
+    }
+    else if (name == "lean") {
+        BenchmarkLean(count);
+    }
+    else {
+        std::cerr << "Usage: DLLBench [unrolled|compact|lean] [count]" << std::endl;
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,219 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+// テンプレートクラス CompactDoublyLinkedList
+// ノードを 1 つの連続した配列に置き、前後のノードを 32 ビットの添字でつなぐダブルリンクリストの実装
+// 64 ビット環境でも 1 ノードあたりのつなぎの領域は 8 バイトで済み、ノードが配列上に並ぶため走査のキャッシュ効率がよい
+// 削除したノードの添字は空き添字のリストで再利用し、配列が足りなくなった場合だけ 2 倍に広げる
+// T がトリビアルにコピーできる場合は、Serialize / Deserialize で配列をそのまま memcpy して保存・復元できる
+// Iterator / ConstIterator / Insert / Delete の使い方は DoublyLinkedList と同じ
+//
+// イテレータの有効性:
+//   イテレータは添字を持つため、配列を広げても無効にならない (削除した要素を指すイテレータだけが無効になる)
+//   operator* / operator-> で得た参照・ポインタは、配列を広げる挿入 (GetCapacity() を超える挿入) で無効になる
+template<typename T, typename Allocator = std::allocator<T>>
+class CompactDoublyLinkedList {
+public:
+    static const uint32_t NullIndex = UINT32_MAX; // どのノードも指さない添字 (末尾の次、先頭の前)
+
+private:
+    // ノードの定義
+    struct Node {
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage; // データ (使用中のノードだけ構築されている)
+        uint32_t prev; // 前のノードの添字
+        uint32_t next; // 次のノードの添字 (空きノードでは次の空きノードの添字)
+
+        // データを取得する関数
+        // 戻り値: ノードのデータ
+        T& data();
+    };
+
+    // Serialize で先頭に書き出す管理情報
+    struct Header {
+        uint32_t head;     // 先頭ノードの添字
+        uint32_t tail;     // 末尾ノードの添字
+        uint32_t freeHead; // 空き添字のリストの先頭
+        uint32_t used;     // 一度でも使ったノードの数 (nodes[0, used) を書き出す)
+        uint32_t size;     // リストのサイズ
+        uint32_t nodeSize; // ノードの大きさ (異なる型で書き出したデータを読み込まないよう確認する)
+    };
+
+    typedef typename std::allocator_traits<Allocator>::template rebind_alloc<Node> NodeAllocator;
+    typedef std::allocator_traits<NodeAllocator> NodeTraits;
+
+    Node* nodes;        // ノードの配列
+    uint32_t capacity;  // 配列の要素数
+    uint32_t used;      // 一度でも使ったノードの数 (これより後ろは未使用)
+    uint32_t freeHead;  // 空き添字のリストの先頭
+    uint32_t head;      // 先頭ノードの添字
+    uint32_t tail;      // 末尾ノードの添字
+    int size;           // リストのサイズ
+    NodeAllocator allocator; // 配列を確保するアロケータ
+
+    // 空きノードを取り出す関数
+    // 戻り値: 空きノードの添字 (空きがなければ配列を広げる。添字が尽きた場合は NullIndex)
+    uint32_t acquireNode();
+
+    // 配列を広げる関数
+    // 入力: 新しい要素数 (uint32_t newCapacity)
+    // 期待結果: 使用中のノードが新しい配列に移る (添字は変わらない)
+    void grow(uint32_t newCapacity);
+
+    // ノードをつなぐ関数
+    // 入力: つなぐノードの添字 (uint32_t index), 挿入位置のノードの添字 (uint32_t before、NullIndex の場合は末尾)
+    // 期待結果: index のノードが before の前に入る
+    void link(uint32_t index, uint32_t before);
+
+public:
+    // 定数イテレータクラス
+    class ConstIterator {
+    private:
+        uint32_t current;                       // 現在のノードの添字
+        const CompactDoublyLinkedList* list;    // 所属するリスト
+
+        friend class CompactDoublyLinkedList;
+
+    public:
+        // コンストラクタ
+        // 入力: ノードの添字 (uint32_t、NullIndex は末尾), リスト (const CompactDoublyLinkedList*)
+        // 期待結果: 定数イテレータが生成される
+        ConstIterator(uint32_t index, const CompactDoublyLinkedList* list);
+        // コピーコンストラクタ
+        // 入力: 既存のConstIterator
+        // 期待結果: 新しいConstIteratorが既存のものと同じ位置を指す
+        ConstIterator(const ConstIterator& other);
+
+        // イテレータを前に進める
+        // 期待結果: イテレータが一つ前のノードを指すようになる
+        ConstIterator& operator--();
+        // イテレータを前に進める（ポストデクリメント）
+        // 期待結果: イテレータが一つ前のノードを指し、以前の状態のコピーが返される
+        ConstIterator operator--(int);
+        // イテレータを次に進める
+        // 期待結果: イテレータが一つ次のノードを指すようになる
+        ConstIterator& operator++();
+        // イテレータを次に進める（ポストインクリメント）
+        // 期待結果: イテレータが一つ次のノードを指し、以前の状態のコピーが返される
+        ConstIterator operator++(int);
+
+        // イテレータが指しているデータを取得
+        // 期待結果: ノードのデータが返される
+        const T& operator*() const;
+        // イテレータが指しているデータのポインタを取得
+        // 期待結果: ノードのデータへのポインタが返される
+        const T* operator->() const;
+
+        // イテレータの代入
+        // 入力: 既存のConstIterator
+        // 期待結果: イテレータが既存のものと同じ位置を指すようになる
+        void operator=(const ConstIterator& other);
+        // イテレータの等価比較
+        // 入力: 既存のConstIterator
+        // 期待結果: イテレータが同じ位置を指している場合はtrue、それ以外はfalseが返される
+        bool operator==(const ConstIterator& other) const;
+        // イテレータの非等価比較
+        // 入力: 既存のConstIterator
+        // 期待結果: イテレータが異なる位置を指している場合はtrue、それ以外はfalseが返される
+        bool operator!=(const ConstIterator& other) const;
+    };
+
+    // 非定数イテレータクラス
+    class Iterator : public ConstIterator {
+    public:
+        // コンストラクタ
+        // 入力: ノードの添字 (uint32_t、NullIndex は末尾), リスト (const CompactDoublyLinkedList*)
+        // 期待結果: イテレータが生成される
+        Iterator(uint32_t index, const CompactDoublyLinkedList* list);
+
+        // イテレータを前に進める
+        // 期待結果: イテレータが一つ前のノードを指すようになる
+        Iterator& operator--();
+        // イテレータを前に進める（ポストデクリメント）
+        // 期待結果: イテレータが一つ前のノードを指し、以前の状態のコピーが返される
+        Iterator operator--(int);
+        // イテレータを次に進める
+        // 期待結果: イテレータが一つ次のノードを指すようになる
+        Iterator& operator++();
+        // イテレータを次に進める（ポストインクリメント）
+        // 期待結果: イテレータが一つ次のノードを指し、以前の状態のコピーが返される
+        Iterator operator++(int);
+
+        // イテレータが指しているデータを取得
+        // 期待結果: ノードのデータが返される
+        T& operator*();
+        // イテレータが指しているデータのポインタを取得
+        // 期待結果: ノードのデータへのポインタが返される
+        T* operator->();
+    };
+
+    // コンストラクタ
+    // 入力: 配列の確保に使うアロケータ (const Allocator&、省略時は既定のアロケータ)
+    // 期待結果: 空のリストが生成される (配列は最初の挿入で確保する)
+    explicit CompactDoublyLinkedList(const Allocator& allocator = Allocator());
+
+    CompactDoublyLinkedList(const CompactDoublyLinkedList&) = delete;
+    CompactDoublyLinkedList& operator=(const CompactDoublyLinkedList&) = delete;
+
+    // リストのサイズを取得
+    // 期待結果: リストのサイズが返される
+    int GetSize() const;
+    // 配列の要素数を取得
+    // 期待結果: 配列を広げずに持てるノード数が返される
+    uint32_t GetCapacity() const;
+    // 配列をあらかじめ広げる
+    // 入力: 持てるようにするノード数 (uint32_t count)
+    // 期待結果: GetCapacity() が count 以上になる (既存のイテレータは有効なまま)
+    void Reserve(uint32_t count);
+
+    // ノードを挿入
+    // 入力: 挿入位置のイテレータ (const Iterator& または ConstIterator&), 挿入するデータ (const T&)
+    // 戻り値: 挿入が成功した場合はtrue、別のリストのイテレータの場合や添字が尽きた場合はfalse
+    template<typename Iter>
+    bool Insert(const Iter& iter, const T& data);
+
+    // ノードを削除
+    // 入力: 削除する位置のイテレータ (const Iterator& または ConstIterator&)
+    // 戻り値: 削除が成功した場合はtrue、失敗した場合はfalse
+    // 期待結果: ノードの添字は空き添字のリストに戻り、次の挿入で再利用される
+    template<typename Iter>
+    bool Delete(const Iter& iter);
+
+    // リストの先頭を指すイテレータを取得
+    // 期待結果: 先頭ノードを指すイテレータが返される
+    Iterator begin();
+    // リストの先頭を指す定数イテレータを取得
+    // 期待結果: 先頭ノードを指す定数イテレータが返される
+    ConstIterator begin() const;
+    // リストの末尾を指すイテレータを取得
+    // 期待結果: NullIndexを指すイテレータが返される
+    Iterator end();
+    // リストの末尾を指す定数イテレータを取得
+    // 期待結果: NullIndexを指す定数イテレータが返される
+    ConstIterator end() const;
+
+    // 書き出しに必要なバイト数を取得
+    // 期待結果: Serialize で書き出すバイト数 (管理情報 + 使用したノードの配列) が返される
+    size_t GetSerializedSize() const;
+    // リストを書き出す
+    // 入力: 書き出し先 (void*、GetSerializedSize() バイト以上)
+    // 期待結果: 管理情報とノードの配列がそのまま memcpy で書き出される (T がトリビアルにコピーできること)
+    void Serialize(void* buffer) const;
+    // 書き出したリストを読み込む
+    // 入力: Serialize で書き出したデータ (const void* buffer), バイト数 (size_t bytes)
+    // 戻り値: 読み込みに成功した場合はtrue、大きさやつながりが正しくない場合はfalse (リストは変更されない)
+    // 期待結果: 配列がそのまま memcpy で読み込まれ、書き出した時と同じ添字・順序のリストになる
+    bool Deserialize(const void* buffer, size_t bytes);
+
+    // リストの全ノードを削除
+    // 期待結果: リストが空になり、配列が解放される
+    void Clear();
+
+    // デストラクタ
+    // 期待結果: リストの全ノードと配列が解放される
+    ~CompactDoublyLinkedList();
+};
+
+#include "CompactDLL.inl"
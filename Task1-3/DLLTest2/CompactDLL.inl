@@ -0,0 +1,531 @@
+#include <cassert>
+#include <cstring>
+#include <new>
+#include <utility>
+#include <vector>
+
+template<typename T, typename Allocator>
+const uint32_t CompactDoublyLinkedList<T, Allocator>::NullIndex;
+
+// ノードのデータを取得する関数
+// 戻り値: ノードのデータ
+template<typename T, typename Allocator>
+T& CompactDoublyLinkedList<T, Allocator>::Node::data() {
+    return *reinterpret_cast<T*>(&storage);
+}
+
+// ConstIterator のコンストラクタ
+// 引数: uint32_t index - 現在のノードの添字
+//       const CompactDoublyLinkedList* list - 関連するリスト
+// 期待結果: ConstIterator が初期化される
+template<typename T, typename Allocator>
+CompactDoublyLinkedList<T, Allocator>::ConstIterator::ConstIterator(uint32_t index, const CompactDoublyLinkedList* list) : current(index), list(list) {}
+
+// ConstIterator のコピーコンストラクタ
+// 引数: const ConstIterator& other - コピー元のイテレータ
+// 期待結果: ConstIterator がコピーされる
+template<typename T, typename Allocator>
+CompactDoublyLinkedList<T, Allocator>::ConstIterator::ConstIterator(const ConstIterator& other) : current(other.current), list(other.list) {}
+
+// 前置デクリメント演算子
+// 期待結果: イテレータが前のノードに移動する
+// 戻り値: 自身の参照
+template<typename T, typename Allocator>
+typename CompactDoublyLinkedList<T, Allocator>::ConstIterator& CompactDoublyLinkedList<T, Allocator>::ConstIterator::operator--() {
+    assert(list != nullptr);
+    assert(list->tail != NullIndex);
+
+    if (current == NullIndex) {
+        current = list->tail;
+    }
+    else {
+        current = list->nodes[current].prev;
+    }
+    return *this;
+}
+
+// 後置デクリメント演算子
+// 期待結果: イテレータが前のノードに移動する
+// 戻り値: 移動前のイテレータのコピー
+template<typename T, typename Allocator>
+typename CompactDoublyLinkedList<T, Allocator>::ConstIterator CompactDoublyLinkedList<T, Allocator>::ConstIterator::operator--(int) {
+    assert(list != nullptr);
+    assert(list->tail != NullIndex);
+
+    ConstIterator temp = *this;
+    --(*this);
+    return temp;
+}
+
+// 前置インクリメント演算子
+// 期待結果: イテレータが次のノードに移動する
+// 戻り値: 自身の参照
+template<typename T, typename Allocator>
+typename CompactDoublyLinkedList<T, Allocator>::ConstIterator& CompactDoublyLinkedList<T, Allocator>::ConstIterator::operator++() {
+    assert(list != nullptr);
+    assert(list->tail != NullIndex);
+
+    if (current == NullIndex) {
+        current = list->head;
+    }
+    else {
+        current = list->nodes[current].next;
+    }
+    return *this;
+}
+
+// 後置インクリメント演算子
+// 期待結果: イテレータが次のノードに移動する
+// 戻り値: 移動前のイテレータのコピー
+template<typename T, typename Allocator>
+typename CompactDoublyLinkedList<T, Allocator>::ConstIterator CompactDoublyLinkedList<T, Allocator>::ConstIterator::operator++(int) {
+    assert(list != nullptr);
+    assert(list->tail != NullIndex);
+
+    ConstIterator temp = *this;
+    ++(*this);
+    return temp;
+}
+
+// デリファレンス演算子
+// 期待結果: 現在のノードのデータを返す
+// 戻り値: 現在のノードのデータの参照
+template<typename T, typename Allocator>
+const T& CompactDoublyLinkedList<T, Allocator>::ConstIterator::operator*() const {
+    assert(list != nullptr && current != NullIndex);
+    return list->nodes[current].data();
+}
+
+// アロー演算子
+// 期待結果: 現在のノードのデータへのポインタを返す
+// 戻り値: 現在のノードのデータへのポインタ
+template<typename T, typename Allocator>
+const T* CompactDoublyLinkedList<T, Allocator>::ConstIterator::operator->() const {
+    assert(list != nullptr && current != NullIndex);
+    return &list->nodes[current].data();
+}
+
+// 代入演算子
+// 期待結果: イテレータの状態をコピーする
+// 引数: const ConstIterator& other - コピー元のイテレータ
+template<typename T, typename Allocator>
+void CompactDoublyLinkedList<T, Allocator>::ConstIterator::operator=(const ConstIterator& other) {
+    current = other.current;
+    list = other.list;
+}
+
+// 等価比較演算子
+// 期待結果: イテレータが指しているノードが同じ場合に true を返す
+// 引数: const ConstIterator& other - 比較対象のイテレータ
+// 戻り値: 等しい場合は true, それ以外は false
+template<typename T, typename Allocator>
+bool CompactDoublyLinkedList<T, Allocator>::ConstIterator::operator==(const ConstIterator& other) const {
+    return current == other.current && (current != NullIndex || list == other.list);
+}
+
+// 非等価比較演算子
+// 期待結果: イテレータが指しているノードが異なる場合に true を返す
+// 引数: const ConstIterator& other - 比較対象のイテレータ
+// 戻り値: 異なる場合は true, それ以外は false
+template<typename T, typename Allocator>
+bool CompactDoublyLinkedList<T, Allocator>::ConstIterator::operator!=(const ConstIterator& other) const {
+    return !(*this == other);
+}
+
+// Iterator のコンストラクタ
+// 引数: uint32_t index - 現在のノードの添字
+//       const CompactDoublyLinkedList* list - 関連するリスト
+// 期待結果: Iterator が初期化される
+template<typename T, typename Allocator>
+CompactDoublyLinkedList<T, Allocator>::Iterator::Iterator(uint32_t index, const CompactDoublyLinkedList* list) : ConstIterator(index, list) {}
+
+// 前置デクリメント演算子
+// 期待結果: イテレータが前のノードに移動する
+// 戻り値: 自身の参照
+template<typename T, typename Allocator>
+typename CompactDoublyLinkedList<T, Allocator>::Iterator& CompactDoublyLinkedList<T, Allocator>::Iterator::operator--() {
+    assert(this->list != nullptr);
+    assert(this->list->tail != NullIndex);
+    assert(this->current != this->list->head);
+
+    ConstIterator::operator--();
+    return *this;
+}
+
+// 後置デクリメント演算子
+// 期待結果: イテレータが前のノードに移動する
+// 戻り値: 移動前のイテレータのコピー
+template<typename T, typename Allocator>
+typename CompactDoublyLinkedList<T, Allocator>::Iterator CompactDoublyLinkedList<T, Allocator>::Iterator::operator--(int) {
+    assert(this->list != nullptr);
+    assert(this->list->tail != NullIndex);
+    assert(this->current != this->list->head);
+
+    Iterator temp = *this;
+    --(*this);
+    return temp;
+}
+
+// 前置インクリメント演算子
+// 期待結果: イテレータが次のノードに移動する
+// 戻り値: 自身の参照
+template<typename T, typename Allocator>
+typename CompactDoublyLinkedList<T, Allocator>::Iterator& CompactDoublyLinkedList<T, Allocator>::Iterator::operator++() {
+    assert(this->list != nullptr && this->current != NullIndex);
+    this->current = this->list->nodes[this->current].next;
+    return *this;
+}
+
+// 後置インクリメント演算子
+// 期待結果: イテレータが次のノードに移動する
+// 戻り値: 移動前のイテレータのコピー
+template<typename T, typename Allocator>
+typename CompactDoublyLinkedList<T, Allocator>::Iterator CompactDoublyLinkedList<T, Allocator>::Iterator::operator++(int) {
+    assert(this->list != nullptr && this->current != NullIndex);
+
+    Iterator temp = *this;
+    ++(*this);
+    return temp;
+}
+
+// デリファレンス演算子
+// 期待結果: 現在のノードのデータを返す
+// 戻り値: 現在のノードのデータの参照
+template<typename T, typename Allocator>
+T& CompactDoublyLinkedList<T, Allocator>::Iterator::operator*() {
+    assert(this->list != nullptr && this->current != NullIndex);
+    return this->list->nodes[this->current].data();
+}
+
+// アロー演算子
+// 期待結果: 現在のノードのデータへのポインタを返す
+// 戻り値: 現在のノードのデータへのポインタ
+template<typename T, typename Allocator>
+T* CompactDoublyLinkedList<T, Allocator>::Iterator::operator->() {
+    assert(this->list != nullptr && this->current != NullIndex);
+    return &this->list->nodes[this->current].data();
+}
+
+// CompactDoublyLinkedList のコンストラクタ
+// 引数: const Allocator& allocator - 配列の確保に使うアロケータ
+// 期待結果: 空のリストが初期化される
+template<typename T, typename Allocator>
+CompactDoublyLinkedList<T, Allocator>::CompactDoublyLinkedList(const Allocator& allocator)
+    : nodes(nullptr), capacity(0), used(0), freeHead(NullIndex), head(NullIndex), tail(NullIndex), size(0), allocator(allocator) {}
+
+// 空きノードを取り出す関数
+// 戻り値: 空きノードの添字 (添字が尽きた場合は NullIndex)
+template<typename T, typename Allocator>
+uint32_t CompactDoublyLinkedList<T, Allocator>::acquireNode() {
+    if (freeHead != NullIndex) {
+        uint32_t index = freeHead;
+        freeHead = nodes[index].next;
+        return index;
+    }
+    if (used == capacity) {
+        if (capacity == NullIndex) return NullIndex; // NullIndex は末尾を表すため、ノードには使えない
+        uint64_t doubled = capacity == 0 ? 16 : static_cast<uint64_t>(capacity) * 2;
+        grow(doubled < NullIndex ? static_cast<uint32_t>(doubled) : NullIndex);
+    }
+    return used++;
+}
+
+// 配列を広げる関数
+// 引数: uint32_t newCapacity - 新しい要素数
+// 期待結果: 使用中のノードが新しい配列に移る (添字は変わらない)
+//           T がトリビアルにコピーできる場合は配列をまとめて memcpy し、それ以外は使用中のノードのデータだけをムーブする
+template<typename T, typename Allocator>
+void CompactDoublyLinkedList<T, Allocator>::grow(uint32_t newCapacity) {
+    Node* newNodes = NodeTraits::allocate(allocator, newCapacity);
+    if (used > 0) {
+        if (std::is_trivially_copyable<T>::value) {
+            std::memcpy(static_cast<void*>(newNodes), nodes, used * sizeof(Node));
+        }
+        else {
+            for (uint32_t i = 0; i < used; ++i) {
+                newNodes[i].prev = nodes[i].prev;
+                newNodes[i].next = nodes[i].next;
+            }
+            for (uint32_t i = head; i != NullIndex; i = nodes[i].next) {
+                new (&newNodes[i].storage) T(std::move(nodes[i].data()));
+                nodes[i].data().~T();
+            }
+        }
+    }
+    if (nodes != nullptr) {
+        NodeTraits::deallocate(allocator, nodes, capacity);
+    }
+    nodes = newNodes;
+    capacity = newCapacity;
+}
+
+// ノードをつなぐ関数
+// 引数: uint32_t index - つなぐノードの添字, uint32_t before - 挿入位置のノードの添字 (NullIndex の場合は末尾)
+// 期待結果: index のノードが before の前に入る
+template<typename T, typename Allocator>
+void CompactDoublyLinkedList<T, Allocator>::link(uint32_t index, uint32_t before) {
+    Node& node = nodes[index];
+    if (before == NullIndex) { // Insert at end or empty list
+        node.prev = tail;
+        node.next = NullIndex;
+        if (tail != NullIndex) {
+            nodes[tail].next = index;
+        }
+        else {
+            head = index;
+        }
+        tail = index;
+    }
+    else { // Insert before the current node
+        node.prev = nodes[before].prev;
+        node.next = before;
+        if (node.prev != NullIndex) {
+            nodes[node.prev].next = index;
+        }
+        else {
+            head = index; // Insert at beginning
+        }
+        nodes[before].prev = index;
+    }
+}
+
+// リストのサイズを取得する関数
+// 期待結果: リストのサイズを返す
+// 戻り値: リストのサイズ
+template<typename T, typename Allocator>
+int CompactDoublyLinkedList<T, Allocator>::GetSize() const {
+    return size;
+}
+
+// 配列の要素数を取得する関数
+// 戻り値: 配列を広げずに持てるノード数
+template<typename T, typename Allocator>
+uint32_t CompactDoublyLinkedList<T, Allocator>::GetCapacity() const {
+    return capacity;
+}
+
+// 配列をあらかじめ広げる関数
+// 引数: uint32_t count - 持てるようにするノード数
+// 期待結果: GetCapacity() が count 以上になる
+template<typename T, typename Allocator>
+void CompactDoublyLinkedList<T, Allocator>::Reserve(uint32_t count) {
+    if (count > capacity) {
+        grow(count < NullIndex ? count : NullIndex);
+    }
+}
+
+// ノードを挿入
+// 引数: const Iterator& または ConstIterator& iter - 挿入位置のイテレータ, const T& data - 挿入するデータ
+// 期待結果: イテレータが指すノードの前 (end() の場合は末尾) にデータが入る
+// 戻り値: 挿入が成功した場合はtrue、失敗した場合はfalse
+template<typename T, typename Allocator>
+template<typename Iter>
+bool CompactDoublyLinkedList<T, Allocator>::Insert(const Iter& iter, const T& data) {
+    if (iter.list != this) return false;
+
+    if (freeHead == NullIndex && used == capacity) {
+        // 配列を広げると、data がこのリストの要素を指している場合に無効になるため、先にコピーしておく
+        T value(data);
+        uint32_t index = acquireNode();
+        if (index == NullIndex) return false;
+        new (&nodes[index].storage) T(std::move(value));
+        link(index, iter.current);
+    }
+    else {
+        uint32_t index = acquireNode();
+        try {
+            new (&nodes[index].storage) T(data);
+        }
+        catch (...) {
+            nodes[index].next = freeHead;
+            freeHead = index;
+            throw;
+        }
+        link(index, iter.current);
+    }
+
+    size++;
+    return true;
+}
+
+// 指定された位置のノードを削除する関数
+// 引数: const Iterator& または ConstIterator& iter - 削除位置のイテレータ
+// 期待結果: 指定された位置のノードが削除され、添字が空き添字のリストに戻る
+// 戻り値: 削除に成功した場合は true, それ以外は false
+template<typename T, typename Allocator>
+template<typename Iter>
+bool CompactDoublyLinkedList<T, Allocator>::Delete(const Iter& iter) {
+    uint32_t current = iter.current;
+
+    if (current == NullIndex || iter.list != this) return false;
+
+    Node& node = nodes[current];
+    if (node.prev != NullIndex) {
+        nodes[node.prev].next = node.next;
+    }
+    else {
+        head = node.next; // Deleting the first node
+    }
+
+    if (node.next != NullIndex) {
+        nodes[node.next].prev = node.prev;
+    }
+    else {
+        tail = node.prev; // Deleting the last node
+    }
+
+    node.data().~T();
+    node.next = freeHead;
+    freeHead = current;
+    size--;
+    return true;
+}
+
+// リストの先頭のイテレータを返す関数
+// 期待結果: リストの先頭のイテレータを返す
+// 戻り値: リストの先頭のイテレータ
+template<typename T, typename Allocator>
+typename CompactDoublyLinkedList<T, Allocator>::Iterator CompactDoublyLinkedList<T, Allocator>::begin() {
+    return Iterator(head, this);
+}
+
+// リストの先頭のイテレータを返す関数（const版）
+// 期待結果: リストの先頭のイテレータを返す
+// 戻り値: リストの先頭のイテレータ
+template<typename T, typename Allocator>
+typename CompactDoublyLinkedList<T, Allocator>::ConstIterator CompactDoublyLinkedList<T, Allocator>::begin() const {
+    return ConstIterator(head, this);
+}
+
+// リストの末尾のイテレータを返す関数
+// 期待結果: リストの末尾のイテレータを返す
+// 戻り値: リストの末尾のイテレータ
+template<typename T, typename Allocator>
+typename CompactDoublyLinkedList<T, Allocator>::Iterator CompactDoublyLinkedList<T, Allocator>::end() {
+    return Iterator(NullIndex, this);
+}
+
+// リストの末尾のイテレータを返す関数（const版）
+// 期待結果: リストの末尾のイテレータを返す
+// 戻り値: リストの末尾のイテレータ
+template<typename T, typename Allocator>
+typename CompactDoublyLinkedList<T, Allocator>::ConstIterator CompactDoublyLinkedList<T, Allocator>::end() const {
+    return ConstIterator(NullIndex, this);
+}
+
+// 書き出しに必要なバイト数を取得する関数
+// 戻り値: 管理情報と使用したノードの配列のバイト数
+template<typename T, typename Allocator>
+size_t CompactDoublyLinkedList<T, Allocator>::GetSerializedSize() const {
+    return sizeof(Header) + static_cast<size_t>(used) * sizeof(Node);
+}
+
+// リストを書き出す関数
+// 引数: void* buffer - 書き出し先 (GetSerializedSize() バイト以上)
+// 期待結果: 管理情報とノードの配列がそのまま書き出される
+template<typename T, typename Allocator>
+void CompactDoublyLinkedList<T, Allocator>::Serialize(void* buffer) const {
+    static_assert(std::is_trivially_copyable<T>::value, "Serialize requires a trivially copyable T");
+
+    Header header = { head, tail, freeHead, used, static_cast<uint32_t>(size), static_cast<uint32_t>(sizeof(Node)) };
+    std::memcpy(buffer, &header, sizeof(Header));
+    if (used > 0) {
+        std::memcpy(static_cast<char*>(buffer) + sizeof(Header), nodes, used * sizeof(Node));
+    }
+}
+
+// 書き出したリストを読み込む関数
+// 引数: const void* buffer - Serialize で書き出したデータ, size_t bytes - バイト数
+// 期待結果: 配列がそのまま読み込まれる。壊れたデータでループしたり範囲外を読んだりしないよう、
+//           読み込んだ配列の全ての添字が範囲内で、使用中と空きのリストが全ノードを 1 回ずつたどることを確かめてから置き換える
+// 戻り値: 読み込みに成功した場合は true, それ以外は false
+template<typename T, typename Allocator>
+bool CompactDoublyLinkedList<T, Allocator>::Deserialize(const void* buffer, size_t bytes) {
+    static_assert(std::is_trivially_copyable<T>::value, "Deserialize requires a trivially copyable T");
+
+    Header header;
+    if (bytes < sizeof(Header)) return false;
+    std::memcpy(&header, buffer, sizeof(Header));
+    if (header.nodeSize != sizeof(Node) || header.used == NullIndex || header.size > header.used) return false;
+    if (bytes != sizeof(Header) + static_cast<size_t>(header.used) * sizeof(Node)) return false;
+
+    Node* loaded = nullptr;
+    if (header.used > 0) {
+        loaded = NodeTraits::allocate(allocator, header.used);
+        std::memcpy(static_cast<void*>(loaded), static_cast<const char*>(buffer) + sizeof(Header), header.used * sizeof(Node));
+    }
+
+    std::vector<bool> visited(header.used, false);
+    bool valid = true;
+    uint32_t count = 0;
+    uint32_t prev = NullIndex;
+    // 添字の範囲を確かめてから loaded[i] を読む (範囲外や 2 回目の訪問が見つかった時点で打ち切る)
+    uint32_t i = header.head;
+    while (i != NullIndex) {
+        if (i >= header.used || visited[i] || loaded[i].prev != prev) {
+            valid = false;
+            break;
+        }
+        visited[i] = true;
+        prev = i;
+        count++;
+        i = loaded[i].next;
+    }
+    valid = valid && prev == header.tail && count == header.size;
+    i = valid ? header.freeHead : NullIndex;
+    while (i != NullIndex) {
+        if (i >= header.used || visited[i]) {
+            valid = false;
+            break;
+        }
+        visited[i] = true;
+        count++;
+        i = loaded[i].next;
+    }
+    valid = valid && count == header.used;
+
+    if (!valid) {
+        if (loaded != nullptr) {
+            NodeTraits::deallocate(allocator, loaded, header.used);
+        }
+        return false;
+    }
+
+    Clear();
+    nodes = loaded;
+    capacity = header.used;
+    used = header.used;
+    freeHead = header.freeHead;
+    head = header.head;
+    tail = header.tail;
+    size = static_cast<int>(header.size);
+    return true;
+}
+
+// CompactDoublyLinkedList のデストラクタ
+// 期待結果: リストの全ノードと配列が解放される
+template<typename T, typename Allocator>
+CompactDoublyLinkedList<T, Allocator>::~CompactDoublyLinkedList() {
+    Clear();
+}
+
+// リストの全ノードを削除する関数
+// 期待結果: 使用中のノードのデータが破棄され、配列が解放されて空のリストになる
+template<typename T, typename Allocator>
+void CompactDoublyLinkedList<T, Allocator>::Clear() {
+    if (!std::is_trivially_destructible<T>::value) {
+        for (uint32_t i = head; i != NullIndex; i = nodes[i].next) {
+            nodes[i].data().~T();
+        }
+    }
+    if (nodes != nullptr) {
+        NodeTraits::deallocate(allocator, nodes, capacity);
+    }
+    nodes = nullptr;
+    capacity = 0;
+    used = 0;
+    freeHead = NullIndex;
+    head = NullIndex;
+    tail = NullIndex;
+    size = 0;
+}
@@ -1,8 +1,11 @@
 #pragma once
+#include <memory>
+#include "NodePool.h"
 
 // テンプレートクラス DoublyLinkedList
 // ダブルリンクリストの実装
-template<typename T>
+// ノードは Allocator から確保する (既定では NodePool のページから切り出し、挿入・削除ごとの new / delete を避ける)
+template<typename T, typename Allocator = PoolAllocator<T>>
 class DoublyLinkedList {
 private:
     // ノードの定義
@@ -18,6 +21,21 @@ private:
     Node* tail; // リストの末尾ノード
     int size;   // リストのサイズ
 
+    typedef typename std::allocator_traits<Allocator>::template rebind_alloc<Node> NodeAllocator;
+    typedef std::allocator_traits<NodeAllocator> NodeTraits;
+
+    NodeAllocator allocator; // ノードを確保するアロケータ
+
+    // ノードを生成する関数
+    // 入力: ノードに格納するデータ (const T&)
+    // 戻り値: アロケータから確保して初期化したノード
+    Node* createNode(const T& data);
+
+    // ノードを破棄する関数
+    // 入力: 破棄するノード (Node*)
+    // 期待結果: データが破棄され、領域がアロケータに返される
+    void destroyNode(Node* node);
+
 public:
     // 定数イテレータクラス
     class ConstIterator {
@@ -101,8 +119,9 @@ public:
     };
 
     // コンストラクタ
+    // 入力: ノードの確保に使うアロケータ (const Allocator&、省略時は既定のアロケータ)
     // 期待結果: 空のダブルリンクリストが生成される
-    DoublyLinkedList();
+    explicit DoublyLinkedList(const Allocator& allocator = Allocator());
     // リストのサイズを取得
     // 期待結果: リストのサイズが返される
     int GetSize() const;
@@ -131,6 +150,10 @@ public:
     // 期待結果: nullptrを指す定数イテレータが返される
     ConstIterator end() const;
 
+    // リストの全ノードを削除
+    // 期待結果: リストが空になり、全ノードが解放される
+    void Clear();
+
     // デストラクタ
     // 期待結果: リストの全ノードが解放される
     ~DoublyLinkedList();
@@ -3,27 +3,27 @@
 // ノードのコンストラクタ
 // 引数: const T& rd - ノードのデータ
 // 期待結果: ノードが初期化される
-template<typename T>
-DoublyLinkedList<T>::Node::Node(const T& rd) : data(rd), prev(nullptr), next(nullptr) {}
+template<typename T, typename Allocator>
+DoublyLinkedList<T, Allocator>::Node::Node(const T& rd) : data(rd), prev(nullptr), next(nullptr) {}
 
 // ConstIterator のコンストラクタ
 // 引数: Node* node - 現在のノード
 //       const DoublyLinkedList* list - 関連するリスト
 // 期待結果: ConstIterator が初期化される
-template<typename T>
-DoublyLinkedList<T>::ConstIterator::ConstIterator(Node* node, const DoublyLinkedList* list) : current(node), list(list) {}
+template<typename T, typename Allocator>
+DoublyLinkedList<T, Allocator>::ConstIterator::ConstIterator(Node* node, const DoublyLinkedList* list) : current(node), list(list) {}
 
 // ConstIterator のコピーコンストラクタ
 // 引数: const ConstIterator& other - コピー元のイテレータ
 // 期待結果: ConstIterator がコピーされる
-template<typename T>
-DoublyLinkedList<T>::ConstIterator::ConstIterator(const ConstIterator& other) : current(other.current), list(other.list) {}
+template<typename T, typename Allocator>
+DoublyLinkedList<T, Allocator>::ConstIterator::ConstIterator(const ConstIterator& other) : current(other.current), list(other.list) {}
 
 // 前置デクリメント演算子
 // 期待結果: イテレータが前のノードに移動する
 // 戻り値: 自身の参照
-template<typename T>
-typename DoublyLinkedList<T>::ConstIterator& DoublyLinkedList<T>::ConstIterator::operator--() {
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::ConstIterator& DoublyLinkedList<T, Allocator>::ConstIterator::operator--() {
     assert(list != nullptr);
     assert(list->tail != nullptr);
 
@@ -39,8 +39,8 @@ typename DoublyLinkedList<T>::ConstIterator& DoublyLinkedList<T>::ConstIterator:
 // 後置デクリメント演算子
 // 期待結果: イテレータが前のノードに移動する
 // 戻り値: 移動前のイテレータのコピー
-template<typename T>
-typename DoublyLinkedList<T>::ConstIterator DoublyLinkedList<T>::ConstIterator::operator--(int) {
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::ConstIterator DoublyLinkedList<T, Allocator>::ConstIterator::operator--(int) {
     assert(list != nullptr);
     assert(list->tail != nullptr);
 
@@ -52,8 +52,8 @@ typename DoublyLinkedList<T>::ConstIterator DoublyLinkedList<T>::ConstIterator::
 // 前置インクリメント演算子
 // 期待結果: イテレータが次のノードに移動する
 // 戻り値: 自身の参照
-template<typename T>
-typename DoublyLinkedList<T>::ConstIterator& DoublyLinkedList<T>::ConstIterator::operator++() {
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::ConstIterator& DoublyLinkedList<T, Allocator>::ConstIterator::operator++() {
     assert(list != nullptr);
     assert(list->tail != nullptr);
 
@@ -69,8 +69,8 @@ typename DoublyLinkedList<T>::ConstIterator& DoublyLinkedList<T>::ConstIterator:
 // 後置インクリメント演算子
 // 期待結果: イテレータが次のノードに移動する
 // 戻り値: 移動前のイテレータのコピー
-template<typename T>
-typename DoublyLinkedList<T>::ConstIterator DoublyLinkedList<T>::ConstIterator::operator++(int) {
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::ConstIterator DoublyLinkedList<T, Allocator>::ConstIterator::operator++(int) {
     assert(list != nullptr);
     assert(list->tail != nullptr);
 
@@ -82,8 +82,8 @@ typename DoublyLinkedList<T>::ConstIterator DoublyLinkedList<T>::ConstIterator::
 // デリファレンス演算子
 // 期待結果: 現在のノードのデータを返す
 // 戻り値: 現在のノードのデータの参照
-template<typename T>
-const T& DoublyLinkedList<T>::ConstIterator::operator*() const {
+template<typename T, typename Allocator>
+const T& DoublyLinkedList<T, Allocator>::ConstIterator::operator*() const {
     assert(current != nullptr);
     return current->data;
 }
@@ -91,8 +91,8 @@ const T& DoublyLinkedList<T>::ConstIterator::operator*() const {
 // アロー演算子
 // 期待結果: 現在のノードのデータへのポインタを返す
 // 戻り値: 現在のノードのデータへのポインタ
-template<typename T>
-const T* DoublyLinkedList<T>::ConstIterator::operator->() const {
+template<typename T, typename Allocator>
+const T* DoublyLinkedList<T, Allocator>::ConstIterator::operator->() const {
     assert(current != nullptr);
     return &(current->data);
 }
@@ -100,8 +100,8 @@ const T* DoublyLinkedList<T>::ConstIterator::operator->() const {
 // 代入演算子
 // 期待結果: イテレータの状態をコピーする
 // 引数: const ConstIterator& other - コピー元のイテレータ
-template<typename T>
-void DoublyLinkedList<T>::ConstIterator::operator=(const ConstIterator& other) {
+template<typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::ConstIterator::operator=(const ConstIterator& other) {
     current = other.current;
     list = other.list;
 }
@@ -110,8 +110,8 @@ void DoublyLinkedList<T>::ConstIterator::operator=(const ConstIterator& other) {
 // 期待結果: イテレータが指しているノードが同じ場合に true を返す
 // 引数: const ConstIterator& other - 比較対象のイテレータ
 // 戻り値: 等しい場合は true, それ以外は false
-template<typename T>
-bool DoublyLinkedList<T>::ConstIterator::operator==(const ConstIterator& other) const {
+template<typename T, typename Allocator>
+bool DoublyLinkedList<T, Allocator>::ConstIterator::operator==(const ConstIterator& other) const {
     return current == other.current;
 }
 
@@ -119,8 +119,8 @@ bool DoublyLinkedList<T>::ConstIterator::operator==(const ConstIterator& other)
 // 期待結果: イテレータが指しているノードが異なる場合に true を返す
 // 引数: const ConstIterator& other - 比較対象のイテレータ
 // 戻り値: 異なる場合は true, それ以外は false
-template<typename T>
-bool DoublyLinkedList<T>::ConstIterator::operator!=(const ConstIterator& other) const {
+template<typename T, typename Allocator>
+bool DoublyLinkedList<T, Allocator>::ConstIterator::operator!=(const ConstIterator& other) const {
     return current != other.current;
 }
 
@@ -128,14 +128,14 @@ bool DoublyLinkedList<T>::ConstIterator::operator!=(const ConstIterator& other)
 // 引数: Node* node - 現在のノード
 //       const DoublyLinkedList* list - 関連するリスト
 // 期待結果: Iterator が初期化される
-template<typename T>
-DoublyLinkedList<T>::Iterator::Iterator(Node* node, const DoublyLinkedList* list) : ConstIterator(node, list) {}
+template<typename T, typename Allocator>
+DoublyLinkedList<T, Allocator>::Iterator::Iterator(Node* node, const DoublyLinkedList* list) : ConstIterator(node, list) {}
 
 // 前置デクリメント演算子
 // 期待結果: イテレータが前のノードに移動する
 // 戻り値: 自身の参照
-template<typename T>
-typename DoublyLinkedList<T>::Iterator& DoublyLinkedList<T>::Iterator::operator--() {
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::Iterator& DoublyLinkedList<T, Allocator>::Iterator::operator--() {
     assert(this->list != nullptr);
     assert(this->list->tail != nullptr);
     assert(this->current != this->list->head);
@@ -152,8 +152,8 @@ typename DoublyLinkedList<T>::Iterator& DoublyLinkedList<T>::Iterator::operator-
 // 後置デクリメント演算子
 // 期待結果: イテレータが前のノードに移動する
 // 戻り値: 移動前のイテレータのコピー
-template<typename T>
-typename DoublyLinkedList<T>::Iterator DoublyLinkedList<T>::Iterator::operator--(int) {
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::Iterator DoublyLinkedList<T, Allocator>::Iterator::operator--(int) {
     assert(this->list != nullptr);
     assert(this->list->tail != nullptr);
     assert(this->current != this->list->head);
@@ -166,8 +166,8 @@ typename DoublyLinkedList<T>::Iterator DoublyLinkedList<T>::Iterator::operator--
 // 前置インクリメント演算子
 // 期待結果: イテレータが次のノードに移動する
 // 戻り値: 自身の参照
-template<typename T>
-typename DoublyLinkedList<T>::Iterator& DoublyLinkedList<T>::Iterator::operator++() {
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::Iterator& DoublyLinkedList<T, Allocator>::Iterator::operator++() {
     assert(this->current != nullptr);
     this->current = this->current->next;
     return *this;
@@ -176,8 +176,8 @@ typename DoublyLinkedList<T>::Iterator& DoublyLinkedList<T>::Iterator::operator+
 // 後置インクリメント演算子
 // 期待結果: イテレータが次のノードに移動する
 // 戻り値: 移動前のイテレータのコピー
-template<typename T>
-typename DoublyLinkedList<T>::Iterator DoublyLinkedList<T>::Iterator::operator++(int) {
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::Iterator DoublyLinkedList<T, Allocator>::Iterator::operator++(int) {
     assert(this->current != nullptr);
 
     Iterator temp = *this;
@@ -188,8 +188,8 @@ typename DoublyLinkedList<T>::Iterator DoublyLinkedList<T>::Iterator::operator++
 // デリファレンス演算子
 // 期待結果: 現在のノードのデータを返す
 // 戻り値: 現在のノードのデータの参照
-template<typename T>
-T& DoublyLinkedList<T>::Iterator::operator*() {
+template<typename T, typename Allocator>
+T& DoublyLinkedList<T, Allocator>::Iterator::operator*() {
     assert(this->current != nullptr);
     return this->current->data;
 }
@@ -197,36 +197,62 @@ T& DoublyLinkedList<T>::Iterator::operator*() {
 // アロー演算子
 // 期待結果: 現在のノードのデータへのポインタを返す
 // 戻り値: 現在のノードのデータへのポインタ
-template<typename T>
-T* DoublyLinkedList<T>::Iterator::operator->() {
+template<typename T, typename Allocator>
+T* DoublyLinkedList<T, Allocator>::Iterator::operator->() {
     assert(this->current != nullptr);
     return &(this->current->data);
 }
 
 // DoublyLinkedList のコンストラクタ
+// 引数: const Allocator& allocator - ノードの確保に使うアロケータ
 // 期待結果: 空のリストが初期化される
-template<typename T>
-DoublyLinkedList<T>::DoublyLinkedList() : head(nullptr), tail(nullptr), size(0) {}
+template<typename T, typename Allocator>
+DoublyLinkedList<T, Allocator>::DoublyLinkedList(const Allocator& allocator) : head(nullptr), tail(nullptr), size(0), allocator(allocator) {}
+
+// ノードを生成する関数
+// 引数: const T& data - ノードに格納するデータ
+// 戻り値: アロケータから確保して初期化したノード
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::Node* DoublyLinkedList<T, Allocator>::createNode(const T& data) {
+    Node* node = NodeTraits::allocate(allocator, 1);
+    try {
+        NodeTraits::construct(allocator, node, data);
+    }
+    catch (...) {
+        NodeTraits::deallocate(allocator, node, 1);
+        throw;
+    }
+    return node;
+}
+
+// ノードを破棄する関数
+// 引数: Node* node - 破棄するノード
+// 期待結果: データが破棄され、領域がアロケータに返される
+template<typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::destroyNode(Node* node) {
+    NodeTraits::destroy(allocator, node);
+    NodeTraits::deallocate(allocator, node, 1);
+}
 
 // リストのサイズを取得する関数
 // 期待結果: リストのサイズを返す
 // 戻り値: リストのサイズ
-template<typename T>
-int DoublyLinkedList<T>::GetSize() const {
+template<typename T, typename Allocator>
+int DoublyLinkedList<T, Allocator>::GetSize() const {
     return size;
 }
 
 // ノードを挿入
 // 入力: 挿入位置のイテレータ (const Iterator& または ConstIterator&), 挿入するデータ (const T&)
 // 戻り値: 挿入が成功した場合はtrue、失敗した場合はfalse
-template<typename T>
+template<typename T, typename Allocator>
 template<typename Iter>
-bool DoublyLinkedList<T>::Insert(const Iter& iter, const T& data) {
-    Node* newNode = new Node(data);
-    Node* current = iter.current;
-
+bool DoublyLinkedList<T, Allocator>::Insert(const Iter& iter, const T& data) {
     if (iter.list != this) return false;
 
+    Node* newNode = createNode(data);
+    Node* current = iter.current;
+
     if (current == nullptr) { // Insert at end or empty list
         if (tail == nullptr) { // Empty list
             head = tail = newNode;
@@ -257,9 +283,9 @@ bool DoublyLinkedList<T>::Insert(const Iter& iter, const T& data) {
 // 引数: const Iterator& または ConstIterator& iter - 削除位置のイテレータ
 // 期待結果: 指定された位置のノードが削除される
 // 戻り値: 削除に成功した場合は true, それ以外は false
-template<typename T>
+template<typename T, typename Allocator>
 template<typename Iter>
-bool DoublyLinkedList<T>::Delete(const Iter& iter) {
+bool DoublyLinkedList<T, Allocator>::Delete(const Iter& iter) {
     Node* current = iter.current;
 
     if (current == nullptr || iter.list != this) return false;
@@ -278,7 +304,7 @@ bool DoublyLinkedList<T>::Delete(const Iter& iter) {
         tail = current->prev; // Deleting the last node
     }
 
-    delete current;
+    destroyNode(current);
     size--;
     return true;
 }
@@ -286,40 +312,53 @@ bool DoublyLinkedList<T>::Delete(const Iter& iter) {
 // リストの先頭のイテレータを返す関数
 // 期待結果: リストの先頭のイテレータを返す
 // 戻り値: リストの先頭のイテレータ
-template<typename T>
-typename DoublyLinkedList<T>::Iterator DoublyLinkedList<T>::begin() {
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::Iterator DoublyLinkedList<T, Allocator>::begin() {
     return Iterator(head, this);
 }
 
 // リストの先頭のイテレータを返す関数（const版）
 // 期待結果: リストの先頭のイテレータを返す
 // 戻り値: リストの先頭のイテレータ
-template<typename T>
-typename DoublyLinkedList<T>::ConstIterator DoublyLinkedList<T>::begin() const {
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::ConstIterator DoublyLinkedList<T, Allocator>::begin() const {
     return ConstIterator(head, this);
 }
 
 // リストの末尾のイテレータを返す関数
 // 期待結果: リストの末尾のイテレータを返す
 // 戻り値: リストの末尾のイテレータ
-template<typename T>
-typename DoublyLinkedList<T>::Iterator DoublyLinkedList<T>::end() {
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::Iterator DoublyLinkedList<T, Allocator>::end() {
     return Iterator(nullptr, this);
 }
 
 // リストの末尾のイテレータを返す関数（const版）
 // 期待結果: リストの末尾のイテレータを返す
 // 戻り値: リストの末尾のイテレータ
-template<typename T>
-typename DoublyLinkedList<T>::ConstIterator DoublyLinkedList<T>::end() const {
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::ConstIterator DoublyLinkedList<T, Allocator>::end() const {
     return ConstIterator(nullptr, this);
 }
 
 // DoublyLinkedList のデストラクタ
 // 期待結果: リストの全ノードが削除される
-template<typename T>
-DoublyLinkedList<T>::~DoublyLinkedList() {
-    while (head) {
-        Delete(begin());
+template<typename T, typename Allocator>
+DoublyLinkedList<T, Allocator>::~DoublyLinkedList() {
+    Clear();
+}
+
+// リストの全ノードを削除する関数
+// 期待結果: リストが空になる (既定のアロケータでは、プール上のノードが全て解放された時点でページがまとめて返される)
+template<typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::Clear() {
+    Node* current = head;
+    while (current != nullptr) {
+        Node* next = current->next;
+        destroyNode(current);
+        current = next;
     }
+    head = nullptr;
+    tail = nullptr;
+    size = 0;
 }
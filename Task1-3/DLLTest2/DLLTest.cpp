@@ -1,7 +1,16 @@
 #include "gtest/gtest.h"
 #include "DLL.h"
+#include "CompactDLL.h"
+#include "IntrusiveDLL.h"
+#include "UnrolledDLL.h"
+#include "XorDLL.h"
 #include <utility>
+#include <cstring>
+#include <deque>
+#include <random>
 #include <string>
+#include <thread>
+#include <vector>
 
 using PerformanceData = std::pair<int, std::string>;
 
@@ -947,3 +956,467 @@ TEST(IteratorComparisonTest, TestDifferentListIterators) {
     bool success = it1 != it2;
     EXPECT_TRUE(success);
 }
+
+// Clear 関数のテスト: 要素があるリストを空にする
+// 期待結果: サイズが 0 になり、再び挿入できることを確認
+TEST(ClearTest, TestClearAndReuse) {
+    DoublyLinkedList<PerformanceData> list;
+    for (int i = 0; i < 100; ++i) {
+        list.Insert(list.end(), PerformanceData{ i, "User" });
+    }
+    list.Clear();
+    EXPECT_EQ(0, list.GetSize());
+    EXPECT_TRUE(list.begin() == list.end());
+
+    list.Insert(list.end(), PerformanceData{ 10, "User" });
+    EXPECT_EQ(1, list.GetSize());
+    EXPECT_EQ(10, list.begin()->first);
+}
+
+// アロケータを指定したリストのテスト: std::allocator を使う
+// 期待結果: 既定のアロケータと同じように挿入・削除・走査できることを確認
+TEST(AllocatorTest, TestStdAllocator) {
+    DoublyLinkedList<PerformanceData, std::allocator<PerformanceData>> list;
+    list.Insert(list.end(), PerformanceData{ 10, "User" });
+    list.Insert(list.begin(), PerformanceData{ 20, "User1" });
+    list.Delete(list.begin());
+    EXPECT_EQ(1, list.GetSize());
+    EXPECT_EQ(10, list.begin()->first);
+}
+
+// NodePool のテスト: 解放した領域の再利用
+// 期待結果: 直前に解放した領域が次の確保で返されることを確認
+TEST(NodePoolTest, TestReuseFreedSlot) {
+    typedef NodePool<104, 8> Pool;
+    void* first = Pool::Allocate();
+    void* second = Pool::Allocate();
+    Pool::Deallocate(first);
+    EXPECT_EQ(first, Pool::Allocate());
+    Pool::Deallocate(first);
+    Pool::Deallocate(second);
+    EXPECT_EQ(0u, Pool::GetLiveCount());
+}
+
+// NodePool のテスト: 全ての領域を解放した場合のページの返却
+// 期待結果: 複数ページ分を確保して全て解放すると、ページが 1 枚だけ残ることを確認
+TEST(NodePoolTest, TestReleasePagesWhenEmpty) {
+    typedef NodePool<112, 8> Pool;
+    std::vector<void*> slots;
+    for (size_t i = 0; i < Pool::SlotsPerPage * 3; ++i) {
+        slots.push_back(Pool::Allocate());
+    }
+    EXPECT_EQ(3u, Pool::GetPageCount());
+    EXPECT_EQ(Pool::SlotsPerPage * 3, Pool::GetLiveCount());
+    for (void* slot : slots) {
+        Pool::Deallocate(slot);
+    }
+    EXPECT_EQ(1u, Pool::GetPageCount());
+    EXPECT_EQ(0u, Pool::GetLiveCount());
+}
+
+// NodePool のテスト: 別のスレッドで確保・解放した場合
+// 期待結果: 他のスレッドで解放した領域が確保元のプールに回収され、終了したスレッドのプールの領域も解放できることを確認
+TEST(NodePoolTest, TestDeallocateFromOtherThread) {
+    typedef NodePool<120, 8> Pool;
+    std::vector<void*> local;
+    for (int i = 0; i < 1000; ++i) {
+        local.push_back(Pool::Allocate());
+    }
+    std::thread freer([&] {
+        for (void* slot : local) {
+            Pool::Deallocate(slot);
+        }
+    });
+    freer.join();
+    EXPECT_EQ(0u, Pool::GetLiveCount());
+
+    std::vector<void*> remote;
+    std::thread allocator([&] {
+        for (int i = 0; i < 1000; ++i) {
+            remote.push_back(Pool::Allocate());
+        }
+    });
+    allocator.join();
+    for (void* slot : remote) {
+        Pool::Deallocate(slot);
+    }
+    EXPECT_EQ(0u, Pool::GetLiveCount());
+}
+
+// DoublyLinkedList と同じ操作を別のリストに行い、結果を比べる関数
+// 入力: 比べるリスト (List&),
+//       挿入する関数 (insert(it, data) で data を it の前に入れて成否を返す),
+//       削除する関数 (erase(it) で it の要素を削除して成否を返す),
+//       要素をデータに変換する関数 (toData(element) で PerformanceData を返す)
+// 期待結果: ランダムな位置への挿入・削除を 2000 回行ったあと、両方向の走査で DoublyLinkedList と同じ順序で要素が並ぶ
+template<typename List, typename Insert, typename Erase, typename ToData>
+void ExpectMatchesDoublyLinkedList(List& list, Insert insert, Erase erase, ToData toData) {
+    DoublyLinkedList<PerformanceData> expected;
+    std::mt19937 rng(1);
+    for (int step = 0; step < 2000; ++step) {
+        int position = list.GetSize() > 0 ? static_cast<int>(rng() % (list.GetSize() + 1)) : 0;
+        auto expectedIt = expected.begin();
+        auto it = list.begin();
+        for (int i = 0; i < position; ++i) {
+            ++expectedIt;
+            ++it;
+        }
+        if (rng() % 3 != 0 || it == list.end()) {
+            PerformanceData data{ step, "User" + std::to_string(step) };
+            EXPECT_TRUE(expected.Insert(expectedIt, data));
+            EXPECT_TRUE(insert(it, data));
+        }
+        else {
+            EXPECT_TRUE(expected.Delete(expectedIt));
+            EXPECT_TRUE(erase(it));
+        }
+        ASSERT_EQ(expected.GetSize(), list.GetSize());
+    }
+
+    auto expectedIt = expected.begin();
+    for (auto it = list.begin(); it != list.end(); ++it, ++expectedIt) {
+        PerformanceData data = toData(*it);
+        EXPECT_EQ(expectedIt->first, data.first);
+        EXPECT_EQ(expectedIt->second, data.second);
+    }
+    auto expectedBack = expected.end();
+    auto back = list.end();
+    for (int i = 0; i < list.GetSize(); ++i) {
+        --expectedBack;
+        --back;
+        EXPECT_EQ(expectedBack->first, toData(*back).first);
+    }
+    EXPECT_TRUE(back == list.begin());
+}
+
+// PerformanceData を値で持つリストを DoublyLinkedList と比べる関数
+// 入力: 比べるリスト (List&)
+// 期待結果: リストの Insert / Delete でランダムな挿入・削除を行い、DoublyLinkedList と同じ順序で要素が並ぶ
+template<typename List>
+void ExpectMatchesDoublyLinkedList(List& list) {
+    ExpectMatchesDoublyLinkedList(list,
+        [&list](typename List::Iterator it, const PerformanceData& data) { return list.Insert(it, data); },
+        [&list](typename List::Iterator it) { return list.Delete(it); },
+        [](const PerformanceData& data) { return data; });
+}
+
+// UnrolledDoublyLinkedList のテスト: 挿入・削除・走査
+// 期待結果: ブロックの分割・併合をまたいでも、DoublyLinkedList と同じ順序で要素が並ぶことを確認
+TEST(UnrolledListTest, TestMatchesDoublyLinkedList) {
+    UnrolledDoublyLinkedList<PerformanceData, 64> list; // 1 ブロック 4 要素にして分割・併合を起こしやすくする
+    ExpectMatchesDoublyLinkedList(list);
+}
+
+// UnrolledDoublyLinkedList のテスト: 無効な挿入・削除
+// 期待結果: 別のリストのイテレータや end() では失敗し、サイズが変わらないことを確認
+TEST(UnrolledListTest, TestInsertDeleteInvalid) {
+    UnrolledDoublyLinkedList<PerformanceData> list;
+    UnrolledDoublyLinkedList<PerformanceData> other;
+    PerformanceData data = { 10, "User" };
+    EXPECT_FALSE(list.Delete(list.end()));
+    EXPECT_TRUE(list.Insert(list.end(), data));
+    EXPECT_FALSE(list.Insert(other.end(), data));
+    EXPECT_FALSE(other.Delete(list.begin()));
+    EXPECT_FALSE(list.Delete(list.end()));
+    EXPECT_EQ(1, list.GetSize());
+    EXPECT_EQ(0, other.GetSize());
+}
+
+// UnrolledDoublyLinkedList のテスト: 満杯のブロックの要素を同じブロックに挿入
+// 期待結果: ブロックの分割で移動する後半の要素を挿入しても、元の値のコピーが入ることを確認
+TEST(UnrolledListTest, TestInsertElementOfFullBlock) {
+    for (int source = 0; source < 4; ++source) {
+        UnrolledDoublyLinkedList<std::string, 128> list; // 1 ブロック 4 要素
+        std::vector<std::string> expected;
+        for (int i = 0; i < 4; ++i) {
+            expected.push_back(std::string(32, static_cast<char>('a' + i))); // 短い文字列の最適化を避ける長さにする
+            list.Insert(list.end(), expected.back());
+        }
+        auto it = list.begin();
+        for (int i = 0; i < source; ++i) {
+            ++it;
+        }
+        EXPECT_TRUE(list.Insert(list.begin(), *it));
+        expected.insert(expected.begin(), expected[source]);
+
+        ASSERT_EQ(5, list.GetSize());
+        int index = 0;
+        for (auto check = list.begin(); check != list.end(); ++check, ++index) {
+            EXPECT_EQ(expected[index], *check);
+        }
+    }
+}
+
+// UnrolledDoublyLinkedList のテスト: 定数イテレータでの走査とイテレータの有効性
+// 期待結果: const のリストを先頭から末尾まで走査でき、挿入したブロック以外の要素を指すイテレータが有効なままであることを確認
+TEST(UnrolledListTest, TestConstIterationAndStability) {
+    UnrolledDoublyLinkedList<int, 64> list; // 1 ブロック 16 要素
+    for (int i = 0; i < 100; ++i) {
+        list.Insert(list.end(), i);
+    }
+    const UnrolledDoublyLinkedList<int, 64>& constList = list;
+    int expected = 0;
+    for (auto it = constList.begin(); it != constList.end(); ++it) {
+        EXPECT_EQ(expected++, *it);
+    }
+    EXPECT_EQ(100, expected);
+
+    auto last = list.end();
+    --last; // 最後のブロックの要素
+    list.Insert(list.begin(), -1); // 先頭のブロックを分割する
+    list.Delete(list.begin());
+    EXPECT_EQ(99, *last);
+    EXPECT_TRUE(list.Insert(last, 98));
+    EXPECT_EQ(101, list.GetSize());
+
+    list.Clear();
+    EXPECT_EQ(0, list.GetSize());
+    EXPECT_TRUE(list.begin() == list.end());
+}
+
+// CompactDoublyLinkedList のテスト: 挿入・削除・走査
+// 期待結果: 空き添字の再利用と配列の拡張をまたいでも、DoublyLinkedList と同じ順序で要素が並ぶことを確認
+TEST(CompactListTest, TestMatchesDoublyLinkedList) {
+    CompactDoublyLinkedList<PerformanceData> list;
+    ExpectMatchesDoublyLinkedList(list);
+}
+
+// CompactDoublyLinkedList のテスト: 配列の拡張とイテレータの有効性
+// 期待結果: 配列を広げる挿入の後もイテレータが同じ要素を指し、自身の要素を挿入してもコピーが正しく入ることを確認
+TEST(CompactListTest, TestIteratorsSurviveGrowth) {
+    CompactDoublyLinkedList<PerformanceData> list;
+    CompactDoublyLinkedList<PerformanceData> other;
+    EXPECT_FALSE(list.Delete(list.end()));
+    EXPECT_FALSE(list.Insert(other.end(), PerformanceData{ 0, "User" }));
+
+    list.Insert(list.end(), PerformanceData{ 0, "First" });
+    auto first = list.begin();
+    while (list.GetSize() < static_cast<int>(list.GetCapacity())) {
+        list.Insert(list.end(), PerformanceData{ list.GetSize(), "User" });
+    }
+    uint32_t capacity = list.GetCapacity();
+    EXPECT_TRUE(list.Insert(list.end(), *first)); // 配列を広げる挿入に、配列内の要素を渡す
+    EXPECT_GT(list.GetCapacity(), capacity);
+    EXPECT_EQ("First", first->second);
+    auto last = list.end();
+    --last;
+    EXPECT_EQ("First", last->second);
+
+    // 削除した添字は再利用され、配列は広がらない
+    capacity = list.GetCapacity();
+    EXPECT_TRUE(list.Delete(first));
+    EXPECT_TRUE(list.Insert(list.begin(), PerformanceData{ -1, "Reused" }));
+    EXPECT_EQ(capacity, list.GetCapacity());
+    EXPECT_EQ(-1, list.begin()->first);
+
+    list.Clear();
+    EXPECT_EQ(0, list.GetSize());
+    EXPECT_EQ(0u, list.GetCapacity());
+    EXPECT_TRUE(list.begin() == list.end());
+}
+
+// CompactDoublyLinkedList のテスト: Serialize / Deserialize
+// 期待結果: 書き出したデータから同じ順序のリストが復元され、壊れたデータは読み込まずにリストが変わらないことを確認
+TEST(CompactListTest, TestSerializeRoundTrip) {
+    struct Score {
+        int id;
+        int value;
+    };
+    typedef CompactDoublyLinkedList<Score> List;
+    List list;
+    for (int i = 0; i < 50; ++i) {
+        list.Insert(list.begin(), Score{ i, i * i });
+    }
+    for (int i = 0; i < 10; ++i) {
+        list.Delete(list.begin()); // 空き添字のリストも書き出す
+    }
+    std::vector<char> buffer(list.GetSerializedSize());
+    list.Serialize(buffer.data());
+
+    List restored;
+    restored.Insert(restored.end(), Score{ -1, -1 });
+    ASSERT_TRUE(restored.Deserialize(buffer.data(), buffer.size()));
+    EXPECT_EQ(list.GetSize(), restored.GetSize());
+    auto expected = list.begin();
+    for (auto it = restored.begin(); it != restored.end(); ++it, ++expected) {
+        EXPECT_EQ(expected->id, it->id);
+        EXPECT_EQ(expected->value, it->value);
+    }
+    EXPECT_TRUE(restored.Insert(restored.end(), Score{ 100, 100 })); // 空き添字を再利用できる
+    EXPECT_EQ(41, restored.GetSize());
+
+    List broken;
+    broken.Insert(broken.end(), Score{ 7, 7 });
+    EXPECT_FALSE(broken.Deserialize(buffer.data(), buffer.size() - 1));
+    EXPECT_FALSE(broken.Deserialize(buffer.data(), 4));
+    std::vector<char> corrupted(buffer);
+    uint32_t head = 50;
+    std::memcpy(corrupted.data(), &head, sizeof(head)); // 先頭の添字を範囲外に書き換える
+    EXPECT_FALSE(broken.Deserialize(corrupted.data(), corrupted.size()));
+    EXPECT_EQ(1, broken.GetSize());
+    EXPECT_EQ(7, broken.begin()->id);
+}
+
+// CompactDoublyLinkedList のテスト: 壊れたデータの Deserialize
+// 期待結果: 範囲外の先頭・空き添字や、ノードのない配列を指す先頭の添字を、配列の範囲外を読まずに拒否し、リストが変わらないことを確認
+TEST(CompactListTest, TestDeserializeRejectsMalformed) {
+    typedef CompactDoublyLinkedList<int> List;
+    List list;
+    for (int i = 0; i < 20; ++i) {
+        list.Insert(list.end(), i);
+    }
+    list.Delete(list.begin());
+    std::vector<char> buffer(list.GetSerializedSize());
+    list.Serialize(buffer.data());
+
+    List target;
+    target.Insert(target.end(), 7);
+    const uint32_t badIndices[] = { 20, 1u << 30, List::NullIndex - 1 };
+    for (uint32_t index : badIndices) {
+        std::vector<char> corrupted(buffer);
+        std::memcpy(corrupted.data(), &index, sizeof(index)); // 先頭の添字
+        EXPECT_FALSE(target.Deserialize(corrupted.data(), corrupted.size()));
+        corrupted = buffer;
+        std::memcpy(corrupted.data() + 2 * sizeof(uint32_t), &index, sizeof(index)); // 空き添字のリストの先頭
+        EXPECT_FALSE(target.Deserialize(corrupted.data(), corrupted.size()));
+    }
+
+    // ノードを 1 つも持たないデータの先頭の添字を書き換える
+    List empty;
+    std::vector<char> emptyBuffer(empty.GetSerializedSize());
+    empty.Serialize(emptyBuffer.data());
+    uint32_t zero = 0;
+    std::memcpy(emptyBuffer.data(), &zero, sizeof(zero));
+    EXPECT_FALSE(target.Deserialize(emptyBuffer.data(), emptyBuffer.size()));
+
+    EXPECT_EQ(1, target.GetSize());
+    EXPECT_EQ(7, *target.begin());
+    EXPECT_TRUE(target.Deserialize(buffer.data(), buffer.size()));
+    EXPECT_EQ(19, target.GetSize());
+    EXPECT_EQ(1, *target.begin());
+}
+
+// 侵入型リストのテスト用の要素 (既定のフックと RankingTag のフックで 2 つのリストに同時に入れられる)
+struct RankingTag {};
+
+struct ScoreEntry : IntrusiveListHook<>, IntrusiveListHook<RankingTag> {
+    int id;
+    std::string name;
+
+    ScoreEntry(int id, const std::string& name) : id(id), name(name) {}
+};
+
+// IntrusiveDoublyLinkedList のテスト: 挿入・削除・走査
+// 期待結果: DoublyLinkedList と同じ順序で要素が並び、リストの要素が挿入した要素そのもの (コピーではない) であることを確認
+TEST(IntrusiveListTest, TestMatchesDoublyLinkedList) {
+    std::deque<ScoreEntry> storage; // リストより先に宣言し、リストが先に破棄されるようにする
+    typedef IntrusiveDoublyLinkedList<ScoreEntry> List;
+    List list;
+    ExpectMatchesDoublyLinkedList(list,
+        [&](List::Iterator it, const PerformanceData& data) {
+            storage.emplace_back(data.first, data.second);
+            bool inserted = list.Insert(it, storage.back());
+            --it;
+            EXPECT_EQ(&storage.back(), &*it);
+            return inserted;
+        },
+        [&](List::Iterator it) {
+            ScoreEntry& entry = *it;
+            bool deleted = list.Delete(it);
+            EXPECT_FALSE(entry.IntrusiveListHook<>::IsLinked());
+            return deleted;
+        },
+        [](const ScoreEntry& entry) { return PerformanceData{ entry.id, entry.name }; });
+}
+
+// IntrusiveDoublyLinkedList のテスト: 無効な挿入・削除と複数のリストへの所属
+// 期待結果: 既に入っている要素や別のリストのイテレータでは失敗し、Tag の異なるリストには同じ要素を同時に入れられることを確認
+TEST(IntrusiveListTest, TestInvalidOperationsAndTags) {
+    std::vector<ScoreEntry> entries;
+    for (int i = 0; i < 5; ++i) {
+        entries.emplace_back(i, "User" + std::to_string(i));
+    }
+    IntrusiveDoublyLinkedList<ScoreEntry> list;
+    IntrusiveDoublyLinkedList<ScoreEntry> other;
+    IntrusiveDoublyLinkedList<ScoreEntry, RankingTag> ranking;
+
+    EXPECT_FALSE(list.Delete(list.end()));
+    for (ScoreEntry& entry : entries) {
+        EXPECT_TRUE(list.Insert(list.end(), entry));
+        EXPECT_TRUE(ranking.Insert(ranking.begin(), entry)); // 逆順に並べる
+    }
+    EXPECT_FALSE(list.Insert(list.end(), entries[0]));   // 既に入っている
+    EXPECT_FALSE(other.Insert(other.end(), entries[0])); // 同じ Tag の別のリストにも入れられない
+    EXPECT_FALSE(other.Insert(list.end(), entries[0]));
+    EXPECT_FALSE(other.Delete(list.begin()));
+    EXPECT_EQ(5, list.GetSize());
+    EXPECT_EQ(5, ranking.GetSize());
+
+    list.begin()->name = "Renamed"; // リストの要素は entries の要素そのもの
+    EXPECT_EQ("Renamed", entries[0].name);
+    const IntrusiveDoublyLinkedList<ScoreEntry, RankingTag>& constRanking = ranking;
+    int expected = 4;
+    for (auto it = constRanking.begin(); it != constRanking.end(); ++it) {
+        EXPECT_EQ(expected--, it->id);
+    }
+
+    EXPECT_TRUE(list.Delete(list.begin()));
+    EXPECT_TRUE(entries[0].IntrusiveListHook<RankingTag>::IsLinked()); // 別の Tag のリストには残る
+    EXPECT_TRUE(other.Insert(other.end(), entries[0]));
+    EXPECT_EQ(4, list.GetSize());
+    EXPECT_EQ(1, other.GetSize());
+
+    list.Clear();
+    other.Clear();
+    ranking.Clear();
+    for (const ScoreEntry& entry : entries) {
+        EXPECT_FALSE(entry.IntrusiveListHook<>::IsLinked());
+        EXPECT_FALSE(entry.IntrusiveListHook<RankingTag>::IsLinked());
+    }
+    EXPECT_TRUE(list.begin() == list.end());
+}
+
+// XorDoublyLinkedList のテスト: 挿入・削除・走査
+// 期待結果: 両隣の XOR の付け替えをまたいでも、DoublyLinkedList と同じ順序で要素が並び、両方向に走査できることを確認
+TEST(XorListTest, TestMatchesDoublyLinkedList) {
+    XorDoublyLinkedList<PerformanceData> list;
+    ExpectMatchesDoublyLinkedList(list);
+}
+
+// XorDoublyLinkedList のテスト: 無効な挿入・削除と end() の有効性
+// 期待結果: 別のリストのイテレータや end() では失敗し、挿入の前に取得した end() で末尾に挿入・走査できることを確認
+TEST(XorListTest, TestInsertDeleteInvalidAndEnd) {
+    XorDoublyLinkedList<int> list;
+    XorDoublyLinkedList<int> other;
+    auto end = list.end();
+    EXPECT_FALSE(list.Delete(list.end()));
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_TRUE(list.Insert(end, i));
+    }
+    EXPECT_FALSE(list.Insert(other.end(), 10));
+    EXPECT_FALSE(other.Delete(list.begin()));
+    EXPECT_FALSE(list.Delete(end));
+    EXPECT_EQ(10, list.GetSize());
+
+    const XorDoublyLinkedList<int>& constList = list;
+    int expected = 0;
+    for (auto it = constList.begin(); it != constList.end(); ++it) {
+        EXPECT_EQ(expected++, *it);
+    }
+    auto last = end;
+    --last;
+    EXPECT_EQ(9, *last);
+    auto head = constList.end();
+    ++head; // end() から ++ で先頭に移る
+    EXPECT_EQ(0, *head);
+
+    EXPECT_TRUE(list.Delete(list.begin()));
+    EXPECT_TRUE(list.Delete(last));
+    EXPECT_EQ(1, *list.begin());
+    --end;
+    EXPECT_EQ(8, *end);
+
+    list.Clear();
+    EXPECT_EQ(0, list.GetSize());
+    EXPECT_TRUE(list.begin() == list.end());
+}
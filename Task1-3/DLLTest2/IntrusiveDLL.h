@@ -0,0 +1,185 @@
+#pragma once
+
+template<typename T, typename Tag>
+class IntrusiveDoublyLinkedList;
+
+// 侵入型リストのフック
+// リストに入れる型はこのクラスを継承して、前後の要素へのポインタを自身に持つ
+// 1 つの要素を複数のリストに入れる場合は、リストごとに異なる Tag のフックを継承する
+// フックのコピー・代入ではつながりをコピーしない (コピーした要素はどのリストにも入っていない)
+template<typename Tag = void>
+class IntrusiveListHook {
+private:
+    IntrusiveListHook* prev; // 前の要素 (リストに入っていない場合は nullptr)
+    IntrusiveListHook* next; // 次の要素 (リストに入っていない場合は nullptr)
+
+    template<typename T, typename ListTag>
+    friend class IntrusiveDoublyLinkedList;
+
+public:
+    // コンストラクタ
+    // 期待結果: どのリストにも入っていないフックが生成される
+    IntrusiveListHook();
+    // コピーコンストラクタ
+    // 期待結果: どのリストにも入っていないフックが生成される (つながりはコピーしない)
+    IntrusiveListHook(const IntrusiveListHook&);
+    // 代入演算子
+    // 期待結果: 何もしない (代入先のつながりは保たれる)
+    IntrusiveListHook& operator=(const IntrusiveListHook&);
+
+    // リストに入っているかを取得
+    // 期待結果: リストに入っている場合は true, それ以外は false が返される
+    bool IsLinked() const;
+
+    // デストラクタ
+    // 期待結果: リストに入ったまま破棄されていないことを確認する (先にリストから削除すること)
+    ~IntrusiveListHook();
+};
+
+// テンプレートクラス IntrusiveDoublyLinkedList
+// 要素自身が持つフック (IntrusiveListHook<Tag>) で要素をつなぐ侵入型ダブルリンクリストの実装
+// ノードを確保せず、挿入で要素をコピーしないため、要素を別の場所 (配列など) に持ったままリストで並べられる
+// リストは要素を所有しない: Delete / Clear は要素をリストから外すだけで破棄しない
+// 要素はリストに入っている間、移動・破棄しないこと
+// Iterator / ConstIterator / Insert / Delete の使い方は DoublyLinkedList と同じ (Insert は要素の参照を受け取る)
+//
+// 末尾の次はリストが持つ番兵のフックで、end() は番兵を指す
+// 先頭の前・末尾の次がどちらも番兵になるため、DoublyLinkedList と同じく end() から ++ で先頭、-- で末尾に移る
+template<typename T, typename Tag = void>
+class IntrusiveDoublyLinkedList {
+private:
+    typedef IntrusiveListHook<Tag> Hook;
+
+    Hook sentinel; // 番兵 (sentinel.next が先頭、sentinel.prev が末尾の要素)
+    int size;      // リストのサイズ
+
+public:
+    // 定数イテレータクラス
+    class ConstIterator {
+    private:
+        Hook* current;                              // 現在の要素のフック (end() は番兵)
+        const IntrusiveDoublyLinkedList* list;      // 所属するリスト
+
+        friend class IntrusiveDoublyLinkedList;
+
+    public:
+        // コンストラクタ
+        // 入力: 要素のフック (Hook*), リスト (const IntrusiveDoublyLinkedList*)
+        // 期待結果: 定数イテレータが生成される
+        ConstIterator(Hook* hook, const IntrusiveDoublyLinkedList* list);
+        // コピーコンストラクタ
+        // 入力: 既存のConstIterator
+        // 期待結果: 新しいConstIteratorが既存のものと同じ位置を指す
+        ConstIterator(const ConstIterator& other);
+
+        // イテレータを前に進める
+        // 期待結果: イテレータが一つ前の要素を指すようになる
+        ConstIterator& operator--();
+        // イテレータを前に進める（ポストデクリメント）
+        // 期待結果: イテレータが一つ前の要素を指し、以前の状態のコピーが返される
+        ConstIterator operator--(int);
+        // イテレータを次に進める
+        // 期待結果: イテレータが一つ次の要素を指すようになる
+        ConstIterator& operator++();
+        // イテレータを次に進める（ポストインクリメント）
+        // 期待結果: イテレータが一つ次の要素を指し、以前の状態のコピーが返される
+        ConstIterator operator++(int);
+
+        // イテレータが指しているデータを取得
+        // 期待結果: 要素が返される
+        const T& operator*() const;
+        // イテレータが指しているデータのポインタを取得
+        // 期待結果: 要素へのポインタが返される
+        const T* operator->() const;
+
+        // イテレータの代入
+        // 入力: 既存のConstIterator
+        // 期待結果: イテレータが既存のものと同じ位置を指すようになる
+        void operator=(const ConstIterator& other);
+        // イテレータの等価比較
+        // 入力: 既存のConstIterator
+        // 期待結果: イテレータが同じ位置を指している場合はtrue、それ以外はfalseが返される
+        bool operator==(const ConstIterator& other) const;
+        // イテレータの非等価比較
+        // 入力: 既存のConstIterator
+        // 期待結果: イテレータが異なる位置を指している場合はtrue、それ以外はfalseが返される
+        bool operator!=(const ConstIterator& other) const;
+    };
+
+    // 非定数イテレータクラス
+    class Iterator : public ConstIterator {
+    public:
+        // コンストラクタ
+        // 入力: 要素のフック (Hook*), リスト (const IntrusiveDoublyLinkedList*)
+        // 期待結果: イテレータが生成される
+        Iterator(Hook* hook, const IntrusiveDoublyLinkedList* list);
+
+        // イテレータを前に進める
+        // 期待結果: イテレータが一つ前の要素を指すようになる
+        Iterator& operator--();
+        // イテレータを前に進める（ポストデクリメント）
+        // 期待結果: イテレータが一つ前の要素を指し、以前の状態のコピーが返される
+        Iterator operator--(int);
+        // イテレータを次に進める
+        // 期待結果: イテレータが一つ次の要素を指すようになる
+        Iterator& operator++();
+        // イテレータを次に進める（ポストインクリメント）
+        // 期待結果: イテレータが一つ次の要素を指し、以前の状態のコピーが返される
+        Iterator operator++(int);
+
+        // イテレータが指しているデータを取得
+        // 期待結果: 要素が返される
+        T& operator*();
+        // イテレータが指しているデータのポインタを取得
+        // 期待結果: 要素へのポインタが返される
+        T* operator->();
+    };
+
+    // コンストラクタ
+    // 期待結果: 空のリストが生成される
+    IntrusiveDoublyLinkedList();
+
+    IntrusiveDoublyLinkedList(const IntrusiveDoublyLinkedList&) = delete;
+    IntrusiveDoublyLinkedList& operator=(const IntrusiveDoublyLinkedList&) = delete;
+
+    // リストのサイズを取得
+    // 期待結果: リストのサイズが返される
+    int GetSize() const;
+
+    // 要素を挿入
+    // 入力: 挿入位置のイテレータ (const Iterator& または ConstIterator&), 挿入する要素 (T&、コピーせずにそのままつなぐ)
+    // 戻り値: 挿入が成功した場合はtrue、別のリストのイテレータの場合や要素が既に同じ Tag のリストに入っている場合はfalse
+    // 期待結果: イテレータが指す要素の前 (end() の場合は末尾) に要素が入る
+    template<typename Iter>
+    bool Insert(const Iter& iter, T& data);
+
+    // 要素を削除
+    // 入力: 削除する位置のイテレータ (const Iterator& または ConstIterator&)
+    // 戻り値: 削除が成功した場合はtrue、end() や別のリストのイテレータの場合はfalse
+    // 期待結果: 要素がリストから外れる (要素は破棄されず、別のリストに入れ直せる)
+    template<typename Iter>
+    bool Delete(const Iter& iter);
+
+    // リストの先頭を指すイテレータを取得
+    // 期待結果: 先頭の要素を指すイテレータが返される
+    Iterator begin();
+    // リストの先頭を指す定数イテレータを取得
+    // 期待結果: 先頭の要素を指す定数イテレータが返される
+    ConstIterator begin() const;
+    // リストの末尾を指すイテレータを取得
+    // 期待結果: 番兵を指すイテレータが返される
+    Iterator end();
+    // リストの末尾を指す定数イテレータを取得
+    // 期待結果: 番兵を指す定数イテレータが返される
+    ConstIterator end() const;
+
+    // リストの全要素を外す
+    // 期待結果: リストが空になり、全要素がどのリストにも入っていない状態になる
+    void Clear();
+
+    // デストラクタ
+    // 期待結果: リストの全要素が外される
+    ~IntrusiveDoublyLinkedList();
+};
+
+#include "IntrusiveDLL.inl"
@@ -0,0 +1,328 @@
+#include <cassert>
+
+// IntrusiveListHook のコンストラクタ
+// 期待結果: どのリストにも入っていないフックが生成される
+template<typename Tag>
+IntrusiveListHook<Tag>::IntrusiveListHook() : prev(nullptr), next(nullptr) {}
+
+// IntrusiveListHook のコピーコンストラクタ
+// 期待結果: つながりはコピーせず、どのリストにも入っていないフックが生成される
+template<typename Tag>
+IntrusiveListHook<Tag>::IntrusiveListHook(const IntrusiveListHook&) : prev(nullptr), next(nullptr) {}
+
+// 代入演算子
+// 期待結果: 代入先のつながりが保たれる
+// 戻り値: 自身の参照
+template<typename Tag>
+IntrusiveListHook<Tag>& IntrusiveListHook<Tag>::operator=(const IntrusiveListHook&) {
+    return *this;
+}
+
+// リストに入っているかを取得する関数
+// 戻り値: リストに入っている場合は true, それ以外は false
+template<typename Tag>
+bool IntrusiveListHook<Tag>::IsLinked() const {
+    return next != nullptr;
+}
+
+// IntrusiveListHook のデストラクタ
+// 期待結果: リストに入ったまま破棄されていないことを確認する
+template<typename Tag>
+IntrusiveListHook<Tag>::~IntrusiveListHook() {
+    assert(!IsLinked());
+}
+
+// ConstIterator のコンストラクタ
+// 引数: Hook* hook - 現在の要素のフック
+//       const IntrusiveDoublyLinkedList* list - 関連するリスト
+// 期待結果: ConstIterator が初期化される
+template<typename T, typename Tag>
+IntrusiveDoublyLinkedList<T, Tag>::ConstIterator::ConstIterator(Hook* hook, const IntrusiveDoublyLinkedList* list) : current(hook), list(list) {}
+
+// ConstIterator のコピーコンストラクタ
+// 引数: const ConstIterator& other - コピー元のイテレータ
+// 期待結果: ConstIterator がコピーされる
+template<typename T, typename Tag>
+IntrusiveDoublyLinkedList<T, Tag>::ConstIterator::ConstIterator(const ConstIterator& other) : current(other.current), list(other.list) {}
+
+// 前置デクリメント演算子
+// 期待結果: イテレータが前の要素に移動する (先頭からは番兵、番兵からは末尾に移る)
+// 戻り値: 自身の参照
+template<typename T, typename Tag>
+typename IntrusiveDoublyLinkedList<T, Tag>::ConstIterator& IntrusiveDoublyLinkedList<T, Tag>::ConstIterator::operator--() {
+    assert(list != nullptr);
+    assert(list->size > 0);
+
+    current = current->prev;
+    return *this;
+}
+
+// 後置デクリメント演算子
+// 期待結果: イテレータが前の要素に移動する
+// 戻り値: 移動前のイテレータのコピー
+template<typename T, typename Tag>
+typename IntrusiveDoublyLinkedList<T, Tag>::ConstIterator IntrusiveDoublyLinkedList<T, Tag>::ConstIterator::operator--(int) {
+    assert(list != nullptr);
+    assert(list->size > 0);
+
+    ConstIterator temp = *this;
+    --(*this);
+    return temp;
+}
+
+// 前置インクリメント演算子
+// 期待結果: イテレータが次の要素に移動する (末尾からは番兵、番兵からは先頭に移る)
+// 戻り値: 自身の参照
+template<typename T, typename Tag>
+typename IntrusiveDoublyLinkedList<T, Tag>::ConstIterator& IntrusiveDoublyLinkedList<T, Tag>::ConstIterator::operator++() {
+    assert(list != nullptr);
+    assert(list->size > 0);
+
+    current = current->next;
+    return *this;
+}
+
+// 後置インクリメント演算子
+// 期待結果: イテレータが次の要素に移動する
+// 戻り値: 移動前のイテレータのコピー
+template<typename T, typename Tag>
+typename IntrusiveDoublyLinkedList<T, Tag>::ConstIterator IntrusiveDoublyLinkedList<T, Tag>::ConstIterator::operator++(int) {
+    assert(list != nullptr);
+    assert(list->size > 0);
+
+    ConstIterator temp = *this;
+    ++(*this);
+    return temp;
+}
+
+// デリファレンス演算子
+// 期待結果: 現在の要素を返す
+// 戻り値: 現在の要素の参照
+template<typename T, typename Tag>
+const T& IntrusiveDoublyLinkedList<T, Tag>::ConstIterator::operator*() const {
+    assert(list != nullptr && current != &list->sentinel);
+    return *static_cast<const T*>(current);
+}
+
+// アロー演算子
+// 期待結果: 現在の要素へのポインタを返す
+// 戻り値: 現在の要素へのポインタ
+template<typename T, typename Tag>
+const T* IntrusiveDoublyLinkedList<T, Tag>::ConstIterator::operator->() const {
+    assert(list != nullptr && current != &list->sentinel);
+    return static_cast<const T*>(current);
+}
+
+// 代入演算子
+// 期待結果: イテレータの状態をコピーする
+// 引数: const ConstIterator& other - コピー元のイテレータ
+template<typename T, typename Tag>
+void IntrusiveDoublyLinkedList<T, Tag>::ConstIterator::operator=(const ConstIterator& other) {
+    current = other.current;
+    list = other.list;
+}
+
+// 等価比較演算子
+// 期待結果: イテレータが指している要素が同じ場合に true を返す
+// 引数: const ConstIterator& other - 比較対象のイテレータ
+// 戻り値: 等しい場合は true, それ以外は false
+template<typename T, typename Tag>
+bool IntrusiveDoublyLinkedList<T, Tag>::ConstIterator::operator==(const ConstIterator& other) const {
+    return current == other.current;
+}
+
+// 非等価比較演算子
+// 期待結果: イテレータが指している要素が異なる場合に true を返す
+// 引数: const ConstIterator& other - 比較対象のイテレータ
+// 戻り値: 異なる場合は true, それ以外は false
+template<typename T, typename Tag>
+bool IntrusiveDoublyLinkedList<T, Tag>::ConstIterator::operator!=(const ConstIterator& other) const {
+    return !(*this == other);
+}
+
+// Iterator のコンストラクタ
+// 引数: Hook* hook - 現在の要素のフック
+//       const IntrusiveDoublyLinkedList* list - 関連するリスト
+// 期待結果: Iterator が初期化される
+template<typename T, typename Tag>
+IntrusiveDoublyLinkedList<T, Tag>::Iterator::Iterator(Hook* hook, const IntrusiveDoublyLinkedList* list) : ConstIterator(hook, list) {}
+
+// 前置デクリメント演算子
+// 期待結果: イテレータが前の要素に移動する
+// 戻り値: 自身の参照
+template<typename T, typename Tag>
+typename IntrusiveDoublyLinkedList<T, Tag>::Iterator& IntrusiveDoublyLinkedList<T, Tag>::Iterator::operator--() {
+    assert(this->list != nullptr);
+    assert(this->list->size > 0);
+    assert(this->current != this->list->sentinel.next);
+
+    ConstIterator::operator--();
+    return *this;
+}
+
+// 後置デクリメント演算子
+// 期待結果: イテレータが前の要素に移動する
+// 戻り値: 移動前のイテレータのコピー
+template<typename T, typename Tag>
+typename IntrusiveDoublyLinkedList<T, Tag>::Iterator IntrusiveDoublyLinkedList<T, Tag>::Iterator::operator--(int) {
+    assert(this->list != nullptr);
+    assert(this->list->size > 0);
+    assert(this->current != this->list->sentinel.next);
+
+    Iterator temp = *this;
+    --(*this);
+    return temp;
+}
+
+// 前置インクリメント演算子
+// 期待結果: イテレータが次の要素に移動する
+// 戻り値: 自身の参照
+template<typename T, typename Tag>
+typename IntrusiveDoublyLinkedList<T, Tag>::Iterator& IntrusiveDoublyLinkedList<T, Tag>::Iterator::operator++() {
+    assert(this->list != nullptr && this->current != &this->list->sentinel);
+    this->current = this->current->next;
+    return *this;
+}
+
+// 後置インクリメント演算子
+// 期待結果: イテレータが次の要素に移動する
+// 戻り値: 移動前のイテレータのコピー
+template<typename T, typename Tag>
+typename IntrusiveDoublyLinkedList<T, Tag>::Iterator IntrusiveDoublyLinkedList<T, Tag>::Iterator::operator++(int) {
+    assert(this->list != nullptr && this->current != &this->list->sentinel);
+
+    Iterator temp = *this;
+    ++(*this);
+    return temp;
+}
+
+// デリファレンス演算子
+// 期待結果: 現在の要素を返す
+// 戻り値: 現在の要素の参照
+template<typename T, typename Tag>
+T& IntrusiveDoublyLinkedList<T, Tag>::Iterator::operator*() {
+    assert(this->list != nullptr && this->current != &this->list->sentinel);
+    return *static_cast<T*>(this->current);
+}
+
+// アロー演算子
+// 期待結果: 現在の要素へのポインタを返す
+// 戻り値: 現在の要素へのポインタ
+template<typename T, typename Tag>
+T* IntrusiveDoublyLinkedList<T, Tag>::Iterator::operator->() {
+    assert(this->list != nullptr && this->current != &this->list->sentinel);
+    return static_cast<T*>(this->current);
+}
+
+// IntrusiveDoublyLinkedList のコンストラクタ
+// 期待結果: 番兵が自身を指す空のリストが初期化される
+template<typename T, typename Tag>
+IntrusiveDoublyLinkedList<T, Tag>::IntrusiveDoublyLinkedList() : size(0) {
+    sentinel.prev = &sentinel;
+    sentinel.next = &sentinel;
+}
+
+// リストのサイズを取得する関数
+// 期待結果: リストのサイズを返す
+// 戻り値: リストのサイズ
+template<typename T, typename Tag>
+int IntrusiveDoublyLinkedList<T, Tag>::GetSize() const {
+    return size;
+}
+
+// 要素を挿入
+// 引数: const Iterator& または ConstIterator& iter - 挿入位置のイテレータ, T& data - 挿入する要素
+// 期待結果: イテレータが指す要素の前 (end() の場合は末尾) に要素がつながる (コピーしない)
+// 戻り値: 挿入が成功した場合はtrue、失敗した場合はfalse
+template<typename T, typename Tag>
+template<typename Iter>
+bool IntrusiveDoublyLinkedList<T, Tag>::Insert(const Iter& iter, T& data) {
+    Hook& hook = data;
+    if (iter.list != this || hook.IsLinked()) return false;
+
+    Hook* before = iter.current;
+    hook.prev = before->prev;
+    hook.next = before;
+    before->prev->next = &hook;
+    before->prev = &hook;
+
+    size++;
+    return true;
+}
+
+// 指定された位置の要素を削除する関数
+// 引数: const Iterator& または ConstIterator& iter - 削除位置のイテレータ
+// 期待結果: 指定された位置の要素がリストから外れる (要素は破棄しない)
+// 戻り値: 削除に成功した場合は true, それ以外は false
+template<typename T, typename Tag>
+template<typename Iter>
+bool IntrusiveDoublyLinkedList<T, Tag>::Delete(const Iter& iter) {
+    Hook* current = iter.current;
+
+    if (iter.list != this || current == &sentinel) return false;
+
+    current->prev->next = current->next;
+    current->next->prev = current->prev;
+    current->prev = nullptr;
+    current->next = nullptr;
+
+    size--;
+    return true;
+}
+
+// リストの先頭のイテレータを返す関数
+// 期待結果: リストの先頭のイテレータを返す
+// 戻り値: リストの先頭のイテレータ
+template<typename T, typename Tag>
+typename IntrusiveDoublyLinkedList<T, Tag>::Iterator IntrusiveDoublyLinkedList<T, Tag>::begin() {
+    return Iterator(sentinel.next, this);
+}
+
+// リストの先頭のイテレータを返す関数（const版）
+// 期待結果: リストの先頭のイテレータを返す
+// 戻り値: リストの先頭のイテレータ
+template<typename T, typename Tag>
+typename IntrusiveDoublyLinkedList<T, Tag>::ConstIterator IntrusiveDoublyLinkedList<T, Tag>::begin() const {
+    return ConstIterator(sentinel.next, this);
+}
+
+// リストの末尾のイテレータを返す関数
+// 期待結果: 番兵を指すイテレータを返す
+// 戻り値: リストの末尾のイテレータ
+template<typename T, typename Tag>
+typename IntrusiveDoublyLinkedList<T, Tag>::Iterator IntrusiveDoublyLinkedList<T, Tag>::end() {
+    return Iterator(&sentinel, this);
+}
+
+// リストの末尾のイテレータを返す関数（const版）
+// 期待結果: 番兵を指すイテレータを返す
+// 戻り値: リストの末尾のイテレータ
+template<typename T, typename Tag>
+typename IntrusiveDoublyLinkedList<T, Tag>::ConstIterator IntrusiveDoublyLinkedList<T, Tag>::end() const {
+    return ConstIterator(const_cast<Hook*>(&sentinel), this);
+}
+
+// リストの全要素を外す関数
+// 期待結果: 全要素のつながりが外れ、空のリストになる
+template<typename T, typename Tag>
+void IntrusiveDoublyLinkedList<T, Tag>::Clear() {
+    Hook* current = sentinel.next;
+    while (current != &sentinel) {
+        Hook* next = current->next;
+        current->prev = nullptr;
+        current->next = nullptr;
+        current = next;
+    }
+    sentinel.prev = &sentinel;
+    sentinel.next = &sentinel;
+    size = 0;
+}
+
+// IntrusiveDoublyLinkedList のデストラクタ
+// 期待結果: リストの全要素が外される
+template<typename T, typename Tag>
+IntrusiveDoublyLinkedList<T, Tag>::~IntrusiveDoublyLinkedList() {
+    Clear();
+    sentinel.prev = nullptr;
+    sentinel.next = nullptr;
+}
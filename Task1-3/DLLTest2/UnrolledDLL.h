@@ -0,0 +1,208 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include "NodePool.h"
+
+// テンプレートクラス UnrolledDoublyLinkedList
+// 1 つのノード (ブロック) に複数の要素を並べて持つ、展開 (unrolled) ダブルリンクリストの実装
+// ブロックは BlockBytes バイト分の要素 (最低 4 要素) を先頭から詰めて持ち、前後のブロックとつながる
+// 要素ごとの前後のポインタがなく、走査はブロック内を配列として進むため、順次走査が配列に近い速さになる
+// Iterator / ConstIterator / Insert / Delete の使い方は DoublyLinkedList と同じ
+//
+// イテレータの有効性:
+//   Insert / Delete は、挿入・削除を行ったブロックの要素を指すイテレータを無効にする
+//   (ブロック内で後ろの要素が 1 つずつずれ、ブロックが満杯の場合は後半が新しいブロックに移り、
+//    要素が少なくなったブロックは次のブロックを取り込むため、そのブロックの要素を指すイテレータも無効になる)
+//   それ以外のブロックの要素を指すイテレータと end() は有効なまま
+//   DoublyLinkedList と異なり、挿入位置・削除位置の前後の要素を指すイテレータは保たれないため、挿入・削除の後は取得し直すこと
+template<typename T, size_t BlockBytes = 512, typename Allocator = PoolAllocator<T>>
+class UnrolledDoublyLinkedList {
+public:
+    static const int BlockCapacity = BlockBytes / sizeof(T) >= 4 ? static_cast<int>(BlockBytes / sizeof(T)) : 4; // 1 ブロックの要素数
+
+private:
+    // ブロックの定義
+    struct Block {
+        Block* prev;
+        Block* next;
+        int count; // 使用中の要素数 (先頭から詰めて使う)
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type items[BlockCapacity];
+
+        Block();
+
+        // 要素を取得する関数
+        // 入力: 位置 (int index)
+        // 戻り値: index 番目の要素
+        T& at(int index);
+    };
+
+    Block* head; // リストの先頭ブロック
+    Block* tail; // リストの末尾ブロック
+    int size;    // リストの要素数
+
+    typedef typename std::allocator_traits<Allocator>::template rebind_alloc<Block> BlockAllocator;
+    typedef std::allocator_traits<BlockAllocator> BlockTraits;
+
+    BlockAllocator allocator; // ブロックを確保するアロケータ
+
+    // ブロックを生成して後ろにつなぐ関数
+    // 入力: つなぐ位置の前のブロック (Block* prev、nullptr の場合は先頭)
+    // 戻り値: 要素を持たない新しいブロック
+    Block* insertBlockAfter(Block* prev);
+
+    // ブロックを外して破棄する関数
+    // 入力: 破棄するブロック (Block*、要素を持たないこと)
+    // 期待結果: ブロックがリストから外れ、領域がアロケータに返される
+    void removeBlock(Block* block);
+
+    // ブロックの指定位置に要素を挿入する関数
+    // 入力: ブロック (Block*、満杯でないこと), 位置 (int index), 挿入するデータ (const T&)
+    // 期待結果: index 以降の要素が 1 つ後ろにずれ、index にデータが入る
+    void insertAt(Block* block, int index, const T& data);
+
+    // ブロックの指定位置の要素を削除する関数
+    // 入力: ブロック (Block*), 位置 (int index)
+    // 期待結果: index の要素が破棄され、後ろの要素が 1 つ前にずれる
+    void eraseAt(Block* block, int index);
+
+    // 満杯のブロックを 2 つに分ける関数
+    // 入力: ブロック (Block*)
+    // 期待結果: 後半の要素が後ろにつないだ新しいブロックに移る
+    void split(Block* block);
+
+    // 要素が少なくなったブロックに次のブロックを取り込む関数
+    // 入力: ブロック (Block*)
+    // 期待結果: 半分以下になったブロックと次のブロックの要素が 1 つのブロックに収まる場合は、次のブロックの要素を移して次のブロックを破棄する
+    void mergeWithNext(Block* block);
+
+public:
+    // 定数イテレータクラス
+    class ConstIterator {
+    private:
+        Block* block;                           // 現在のブロック
+        int index;                              // ブロック内の位置
+        const UnrolledDoublyLinkedList* list;   // 所属するリスト
+
+        friend class UnrolledDoublyLinkedList;
+
+    public:
+        // コンストラクタ
+        // 入力: ブロック (Block*), リスト (const UnrolledDoublyLinkedList*), ブロック内の位置 (int、省略時は 0)
+        // 期待結果: 定数イテレータが生成される
+        ConstIterator(Block* block, const UnrolledDoublyLinkedList* list, int index = 0);
+        // コピーコンストラクタ
+        // 入力: 既存のConstIterator
+        // 期待結果: 新しいConstIteratorが既存のものと同じ位置を指す
+        ConstIterator(const ConstIterator& other);
+
+        // イテレータを前に進める
+        // 期待結果: イテレータが一つ前の要素を指すようになる
+        ConstIterator& operator--();
+        // イテレータを前に進める（ポストデクリメント）
+        // 期待結果: イテレータが一つ前の要素を指し、以前の状態のコピーが返される
+        ConstIterator operator--(int);
+        // イテレータを次に進める
+        // 期待結果: イテレータが一つ次の要素を指すようになる
+        ConstIterator& operator++();
+        // イテレータを次に進める（ポストインクリメント）
+        // 期待結果: イテレータが一つ次の要素を指し、以前の状態のコピーが返される
+        ConstIterator operator++(int);
+
+        // イテレータが指しているデータを取得
+        // 期待結果: 要素のデータが返される
+        const T& operator*() const;
+        // イテレータが指しているデータのポインタを取得
+        // 期待結果: 要素のデータへのポインタが返される
+        const T* operator->() const;
+
+        // イテレータの代入
+        // 入力: 既存のConstIterator
+        // 期待結果: イテレータが既存のものと同じ位置を指すようになる
+        void operator=(const ConstIterator& other);
+        // イテレータの等価比較
+        // 入力: 既存のConstIterator
+        // 期待結果: イテレータが同じ位置を指している場合はtrue、それ以外はfalseが返される
+        bool operator==(const ConstIterator& other) const;
+        // イテレータの非等価比較
+        // 入力: 既存のConstIterator
+        // 期待結果: イテレータが異なる位置を指している場合はtrue、それ以外はfalseが返される
+        bool operator!=(const ConstIterator& other) const;
+    };
+
+    // 非定数イテレータクラス
+    class Iterator : public ConstIterator {
+    public:
+        // コンストラクタ
+        // 入力: ブロック (Block*), リスト (const UnrolledDoublyLinkedList*), ブロック内の位置 (int、省略時は 0)
+        // 期待結果: イテレータが生成される
+        Iterator(Block* block, const UnrolledDoublyLinkedList* list, int index = 0);
+
+        // イテレータを前に進める
+        // 期待結果: イテレータが一つ前の要素を指すようになる
+        Iterator& operator--();
+        // イテレータを前に進める（ポストデクリメント）
+        // 期待結果: イテレータが一つ前の要素を指し、以前の状態のコピーが返される
+        Iterator operator--(int);
+        // イテレータを次に進める
+        // 期待結果: イテレータが一つ次の要素を指すようになる
+        Iterator& operator++();
+        // イテレータを次に進める（ポストインクリメント）
+        // 期待結果: イテレータが一つ次の要素を指し、以前の状態のコピーが返される
+        Iterator operator++(int);
+
+        // イテレータが指しているデータを取得
+        // 期待結果: 要素のデータが返される
+        T& operator*();
+        // イテレータが指しているデータのポインタを取得
+        // 期待結果: 要素のデータへのポインタが返される
+        T* operator->();
+    };
+
+    // コンストラクタ
+    // 入力: ブロックの確保に使うアロケータ (const Allocator&、省略時は既定のアロケータ)
+    // 期待結果: 空のリストが生成される
+    explicit UnrolledDoublyLinkedList(const Allocator& allocator = Allocator());
+
+    UnrolledDoublyLinkedList(const UnrolledDoublyLinkedList&) = delete;
+    UnrolledDoublyLinkedList& operator=(const UnrolledDoublyLinkedList&) = delete;
+
+    // リストのサイズを取得
+    // 期待結果: リストの要素数が返される
+    int GetSize() const;
+    // 要素を挿入
+    // 入力: 挿入位置のイテレータ (const Iterator& または ConstIterator&), 挿入するデータ (const T&)
+    // 戻り値: 挿入が成功した場合はtrue、イテレータが別のリストのものである場合はfalse
+    // 期待結果: イテレータが指す要素の前 (end() の場合は末尾) にデータが入る
+    template<typename Iter>
+    bool Insert(const Iter& iter, const T& data);
+
+    // 要素を削除
+    // 入力: 削除する位置のイテレータ (const Iterator& または ConstIterator&)
+    // 戻り値: 削除が成功した場合はtrue、end() や別のリストのイテレータの場合はfalse
+    template<typename Iter>
+    bool Delete(const Iter& iter);
+
+    // リストの先頭を指すイテレータを取得
+    // 期待結果: 先頭の要素を指すイテレータが返される
+    Iterator begin();
+    // リストの先頭を指す定数イテレータを取得
+    // 期待結果: 先頭の要素を指す定数イテレータが返される
+    ConstIterator begin() const;
+    // リストの末尾を指すイテレータを取得
+    // 期待結果: nullptrを指すイテレータが返される
+    Iterator end();
+    // リストの末尾を指す定数イテレータを取得
+    // 期待結果: nullptrを指す定数イテレータが返される
+    ConstIterator end() const;
+
+    // リストの全要素を削除
+    // 期待結果: リストが空になり、全ブロックが解放される
+    void Clear();
+
+    // デストラクタ
+    // 期待結果: リストの全ブロックが解放される
+    ~UnrolledDoublyLinkedList();
+};
+
+#include "UnrolledDLL.inl"
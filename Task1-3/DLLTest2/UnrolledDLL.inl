@@ -0,0 +1,476 @@
+#include <cassert>
+#include <new>
+#include <utility>
+
+// ブロックのコンストラクタ
+// 期待結果: 要素を持たないブロックが初期化される (要素の領域は初期化しない)
+template<typename T, size_t BlockBytes, typename Allocator>
+UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::Block::Block() : prev(nullptr), next(nullptr), count(0) {}
+
+// 要素を取得する関数
+// 引数: int index - ブロック内の位置
+// 戻り値: index 番目の要素
+template<typename T, size_t BlockBytes, typename Allocator>
+T& UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::Block::at(int index) {
+    return *reinterpret_cast<T*>(&items[index]);
+}
+
+// ConstIterator のコンストラクタ
+// 引数: Block* block - 現在のブロック
+//       const UnrolledDoublyLinkedList* list - 関連するリスト
+//       int index - ブロック内の位置
+// 期待結果: ConstIterator が初期化される
+template<typename T, size_t BlockBytes, typename Allocator>
+UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::ConstIterator::ConstIterator(Block* block, const UnrolledDoublyLinkedList* list, int index)
+    : block(block), index(index), list(list) {}
+
+// ConstIterator のコピーコンストラクタ
+// 引数: const ConstIterator& other - コピー元のイテレータ
+// 期待結果: ConstIterator がコピーされる
+template<typename T, size_t BlockBytes, typename Allocator>
+UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::ConstIterator::ConstIterator(const ConstIterator& other)
+    : block(other.block), index(other.index), list(other.list) {}
+
+// 前置デクリメント演算子
+// 期待結果: イテレータが前の要素に移動する (先頭の要素からは end() に移動する)
+// 戻り値: 自身の参照
+template<typename T, size_t BlockBytes, typename Allocator>
+typename UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::ConstIterator& UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::ConstIterator::operator--() {
+    assert(list != nullptr);
+    assert(list->tail != nullptr);
+
+    if (block == nullptr) {
+        block = list->tail;
+        index = block->count - 1;
+    }
+    else if (index > 0) {
+        index--;
+    }
+    else {
+        block = block->prev;
+        index = block != nullptr ? block->count - 1 : 0;
+    }
+    return *this;
+}
+
+// 後置デクリメント演算子
+// 期待結果: イテレータが前の要素に移動する
+// 戻り値: 移動前のイテレータのコピー
+template<typename T, size_t BlockBytes, typename Allocator>
+typename UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::ConstIterator UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::ConstIterator::operator--(int) {
+    assert(list != nullptr);
+    assert(list->tail != nullptr);
+
+    ConstIterator temp = *this;
+    --(*this);
+    return temp;
+}
+
+// 前置インクリメント演算子
+// 期待結果: イテレータが次の要素に移動する (end() からは先頭の要素に移動する)
+// 戻り値: 自身の参照
+template<typename T, size_t BlockBytes, typename Allocator>
+typename UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::ConstIterator& UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::ConstIterator::operator++() {
+    assert(list != nullptr);
+    assert(list->tail != nullptr);
+
+    if (block == nullptr) {
+        block = list->head;
+        index = 0;
+    }
+    else if (++index == block->count) {
+        block = block->next;
+        index = 0;
+    }
+    return *this;
+}
+
+// 後置インクリメント演算子
+// 期待結果: イテレータが次の要素に移動する
+// 戻り値: 移動前のイテレータのコピー
+template<typename T, size_t BlockBytes, typename Allocator>
+typename UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::ConstIterator UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::ConstIterator::operator++(int) {
+    assert(list != nullptr);
+    assert(list->tail != nullptr);
+
+    ConstIterator temp = *this;
+    ++(*this);
+    return temp;
+}
+
+// デリファレンス演算子
+// 期待結果: 現在の要素のデータを返す
+// 戻り値: 現在の要素のデータの参照
+template<typename T, size_t BlockBytes, typename Allocator>
+const T& UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::ConstIterator::operator*() const {
+    assert(block != nullptr);
+    return block->at(index);
+}
+
+// アロー演算子
+// 期待結果: 現在の要素のデータへのポインタを返す
+// 戻り値: 現在の要素のデータへのポインタ
+template<typename T, size_t BlockBytes, typename Allocator>
+const T* UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::ConstIterator::operator->() const {
+    assert(block != nullptr);
+    return &block->at(index);
+}
+
+// 代入演算子
+// 期待結果: イテレータの状態をコピーする
+// 引数: const ConstIterator& other - コピー元のイテレータ
+template<typename T, size_t BlockBytes, typename Allocator>
+void UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::ConstIterator::operator=(const ConstIterator& other) {
+    block = other.block;
+    index = other.index;
+    list = other.list;
+}
+
+// 等価比較演算子
+// 期待結果: イテレータが指している要素が同じ場合に true を返す
+// 引数: const ConstIterator& other - 比較対象のイテレータ
+// 戻り値: 等しい場合は true, それ以外は false
+template<typename T, size_t BlockBytes, typename Allocator>
+bool UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::ConstIterator::operator==(const ConstIterator& other) const {
+    return block == other.block && index == other.index;
+}
+
+// 非等価比較演算子
+// 期待結果: イテレータが指している要素が異なる場合に true を返す
+// 引数: const ConstIterator& other - 比較対象のイテレータ
+// 戻り値: 異なる場合は true, それ以外は false
+template<typename T, size_t BlockBytes, typename Allocator>
+bool UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::ConstIterator::operator!=(const ConstIterator& other) const {
+    return block != other.block || index != other.index;
+}
+
+// Iterator のコンストラクタ
+// 引数: Block* block - 現在のブロック
+//       const UnrolledDoublyLinkedList* list - 関連するリスト
+//       int index - ブロック内の位置
+// 期待結果: Iterator が初期化される
+template<typename T, size_t BlockBytes, typename Allocator>
+UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::Iterator::Iterator(Block* block, const UnrolledDoublyLinkedList* list, int index)
+    : ConstIterator(block, list, index) {}
+
+// 前置デクリメント演算子
+// 期待結果: イテレータが前の要素に移動する
+// 戻り値: 自身の参照
+template<typename T, size_t BlockBytes, typename Allocator>
+typename UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::Iterator& UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::Iterator::operator--() {
+    assert(this->list != nullptr);
+    assert(this->list->tail != nullptr);
+    assert(this->block != this->list->head || this->index != 0);
+
+    ConstIterator::operator--();
+    return *this;
+}
+
+// 後置デクリメント演算子
+// 期待結果: イテレータが前の要素に移動する
+// 戻り値: 移動前のイテレータのコピー
+template<typename T, size_t BlockBytes, typename Allocator>
+typename UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::Iterator UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::Iterator::operator--(int) {
+    assert(this->list != nullptr);
+    assert(this->list->tail != nullptr);
+    assert(this->block != this->list->head || this->index != 0);
+
+    Iterator temp = *this;
+    --(*this);
+    return temp;
+}
+
+// 前置インクリメント演算子
+// 期待結果: イテレータが次の要素に移動する
+// 戻り値: 自身の参照
+template<typename T, size_t BlockBytes, typename Allocator>
+typename UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::Iterator& UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::Iterator::operator++() {
+    assert(this->block != nullptr);
+    if (++this->index == this->block->count) {
+        this->block = this->block->next;
+        this->index = 0;
+    }
+    return *this;
+}
+
+// 後置インクリメント演算子
+// 期待結果: イテレータが次の要素に移動する
+// 戻り値: 移動前のイテレータのコピー
+template<typename T, size_t BlockBytes, typename Allocator>
+typename UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::Iterator UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::Iterator::operator++(int) {
+    assert(this->block != nullptr);
+
+    Iterator temp = *this;
+    ++(*this);
+    return temp;
+}
+
+// デリファレンス演算子
+// 期待結果: 現在の要素のデータを返す
+// 戻り値: 現在の要素のデータの参照
+template<typename T, size_t BlockBytes, typename Allocator>
+T& UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::Iterator::operator*() {
+    assert(this->block != nullptr);
+    return this->block->at(this->index);
+}
+
+// アロー演算子
+// 期待結果: 現在の要素のデータへのポインタを返す
+// 戻り値: 現在の要素のデータへのポインタ
+template<typename T, size_t BlockBytes, typename Allocator>
+T* UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::Iterator::operator->() {
+    assert(this->block != nullptr);
+    return &this->block->at(this->index);
+}
+
+// UnrolledDoublyLinkedList のコンストラクタ
+// 引数: const Allocator& allocator - ブロックの確保に使うアロケータ
+// 期待結果: 空のリストが初期化される
+template<typename T, size_t BlockBytes, typename Allocator>
+UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::UnrolledDoublyLinkedList(const Allocator& allocator)
+    : head(nullptr), tail(nullptr), size(0), allocator(allocator) {}
+
+// ブロックを生成して後ろにつなぐ関数
+// 引数: Block* prev - つなぐ位置の前のブロック (nullptr の場合は先頭)
+// 戻り値: 要素を持たない新しいブロック
+template<typename T, size_t BlockBytes, typename Allocator>
+typename UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::Block* UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::insertBlockAfter(Block* prev) {
+    Block* block = BlockTraits::allocate(allocator, 1);
+    BlockTraits::construct(allocator, block);
+
+    block->prev = prev;
+    block->next = prev != nullptr ? prev->next : head;
+    if (block->next != nullptr) {
+        block->next->prev = block;
+    }
+    else {
+        tail = block;
+    }
+    if (prev != nullptr) {
+        prev->next = block;
+    }
+    else {
+        head = block;
+    }
+    return block;
+}
+
+// ブロックを外して破棄する関数
+// 引数: Block* block - 破棄するブロック (要素を持たないこと)
+// 期待結果: ブロックがリストから外れ、領域がアロケータに返される
+template<typename T, size_t BlockBytes, typename Allocator>
+void UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::removeBlock(Block* block) {
+    assert(block->count == 0);
+
+    if (block->prev != nullptr) {
+        block->prev->next = block->next;
+    }
+    else {
+        head = block->next;
+    }
+    if (block->next != nullptr) {
+        block->next->prev = block->prev;
+    }
+    else {
+        tail = block->prev;
+    }
+    BlockTraits::destroy(allocator, block);
+    BlockTraits::deallocate(allocator, block, 1);
+}
+
+// ブロックの指定位置に要素を挿入する関数
+// 引数: Block* block - ブロック (満杯でないこと), int index - 位置, const T& data - 挿入するデータ
+// 期待結果: index 以降の要素が 1 つ後ろにずれ、index にデータが入る
+template<typename T, size_t BlockBytes, typename Allocator>
+void UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::insertAt(Block* block, int index, const T& data) {
+    assert(block->count < BlockCapacity);
+
+    if (index == block->count) {
+        new (&block->items[index]) T(data);
+    }
+    else {
+        // data がこのブロックの要素を指している場合に備えて、ずらす前にコピーしておく
+        T value(data);
+        new (&block->items[block->count]) T(std::move(block->at(block->count - 1)));
+        for (int i = block->count - 1; i > index; --i) {
+            block->at(i) = std::move(block->at(i - 1));
+        }
+        block->at(index) = std::move(value);
+    }
+    block->count++;
+}
+
+// ブロックの指定位置の要素を削除する関数
+// 引数: Block* block - ブロック, int index - 位置
+// 期待結果: index の要素が破棄され、後ろの要素が 1 つ前にずれる
+template<typename T, size_t BlockBytes, typename Allocator>
+void UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::eraseAt(Block* block, int index) {
+    for (int i = index; i + 1 < block->count; ++i) {
+        block->at(i) = std::move(block->at(i + 1));
+    }
+    block->at(block->count - 1).~T();
+    block->count--;
+}
+
+// 満杯のブロックを 2 つに分ける関数
+// 引数: Block* block - ブロック
+// 期待結果: 後半の要素が後ろにつないだ新しいブロックに移る
+template<typename T, size_t BlockBytes, typename Allocator>
+void UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::split(Block* block) {
+    Block* next = insertBlockAfter(block);
+    int keep = block->count / 2;
+    for (int i = keep; i < block->count; ++i) {
+        new (&next->items[i - keep]) T(std::move(block->at(i)));
+        block->at(i).~T();
+    }
+    next->count = block->count - keep;
+    block->count = keep;
+}
+
+// 要素が少なくなったブロックに次のブロックを取り込む関数
+// 引数: Block* block - ブロック
+// 期待結果: 次のブロックの要素が block の末尾に移り、次のブロックが破棄される
+template<typename T, size_t BlockBytes, typename Allocator>
+void UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::mergeWithNext(Block* block) {
+    Block* next = block->next;
+    if (next == nullptr || block->count > BlockCapacity / 2 || block->count + next->count > BlockCapacity) return;
+
+    for (int i = 0; i < next->count; ++i) {
+        new (&block->items[block->count + i]) T(std::move(next->at(i)));
+        next->at(i).~T();
+    }
+    block->count += next->count;
+    next->count = 0;
+    removeBlock(next);
+}
+
+// リストのサイズを取得する関数
+// 期待結果: リストの要素数を返す
+// 戻り値: リストの要素数
+template<typename T, size_t BlockBytes, typename Allocator>
+int UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::GetSize() const {
+    return size;
+}
+
+// 要素を挿入する関数
+// 引数: const Iterator& または ConstIterator& iter - 挿入位置のイテレータ, const T& data - 挿入するデータ
+// 期待結果: イテレータが指す要素の前にデータが入る
+//           末尾やブロックの先頭への挿入で、前のブロックに空きがあれば要素をずらさずにそこへ入れる
+//           満杯のブロックは半分に分けてから入れる
+// 戻り値: 挿入が成功した場合は true, それ以外は false
+template<typename T, size_t BlockBytes, typename Allocator>
+template<typename Iter>
+bool UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::Insert(const Iter& iter, const T& data) {
+    if (iter.list != this) return false;
+
+    Block* block = iter.block;
+    int index = iter.index;
+
+    if (block == nullptr) { // 末尾に挿入
+        block = tail;
+        if (block == nullptr || block->count == BlockCapacity) {
+            block = insertBlockAfter(tail);
+        }
+        index = block->count;
+    }
+    else if (index == 0 && block->prev != nullptr && block->prev->count < BlockCapacity) {
+        block = block->prev; // 前のブロックの末尾に入れれば要素をずらさずに済む
+        index = block->count;
+    }
+    else if (block->count == BlockCapacity) {
+        // 分割で後半の要素は移動・破棄されるため、data がこのブロックの要素を指している場合に備えて先にコピーしておく
+        T value(data);
+        split(block);
+        if (index > block->count) {
+            index -= block->count;
+            block = block->next;
+        }
+        insertAt(block, index, value);
+        size++;
+        return true;
+    }
+
+    insertAt(block, index, data);
+    size++;
+    return true;
+}
+
+// 指定された位置の要素を削除する関数
+// 引数: const Iterator& または ConstIterator& iter - 削除位置のイテレータ
+// 期待結果: 指定された位置の要素が削除される。空になったブロックは破棄し、半分以下になったブロックは次のブロックと併合する
+// 戻り値: 削除に成功した場合は true, それ以外は false
+template<typename T, size_t BlockBytes, typename Allocator>
+template<typename Iter>
+bool UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::Delete(const Iter& iter) {
+    Block* block = iter.block;
+
+    if (block == nullptr || iter.list != this) return false;
+
+    eraseAt(block, iter.index);
+    if (block->count == 0) {
+        removeBlock(block);
+    }
+    else {
+        mergeWithNext(block);
+    }
+    size--;
+    return true;
+}
+
+// リストの先頭のイテレータを返す関数
+// 期待結果: リストの先頭のイテレータを返す
+// 戻り値: リストの先頭のイテレータ
+template<typename T, size_t BlockBytes, typename Allocator>
+typename UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::Iterator UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::begin() {
+    return Iterator(head, this);
+}
+
+// リストの先頭のイテレータを返す関数（const版）
+// 期待結果: リストの先頭のイテレータを返す
+// 戻り値: リストの先頭のイテレータ
+template<typename T, size_t BlockBytes, typename Allocator>
+typename UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::ConstIterator UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::begin() const {
+    return ConstIterator(head, this);
+}
+
+// リストの末尾のイテレータを返す関数
+// 期待結果: リストの末尾のイテレータを返す
+// 戻り値: リストの末尾のイテレータ
+template<typename T, size_t BlockBytes, typename Allocator>
+typename UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::Iterator UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::end() {
+    return Iterator(nullptr, this);
+}
+
+// リストの末尾のイテレータを返す関数（const版）
+// 期待結果: リストの末尾のイテレータを返す
+// 戻り値: リストの末尾のイテレータ
+template<typename T, size_t BlockBytes, typename Allocator>
+typename UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::ConstIterator UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::end() const {
+    return ConstIterator(nullptr, this);
+}
+
+// UnrolledDoublyLinkedList のデストラクタ
+// 期待結果: リストの全ブロックが削除される
+template<typename T, size_t BlockBytes, typename Allocator>
+UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::~UnrolledDoublyLinkedList() {
+    Clear();
+}
+
+// リストの全要素を削除する関数
+// 期待結果: 全要素が破棄され、全ブロックがアロケータに返される
+template<typename T, size_t BlockBytes, typename Allocator>
+void UnrolledDoublyLinkedList<T, BlockBytes, Allocator>::Clear() {
+    Block* block = head;
+    while (block != nullptr) {
+        Block* next = block->next;
+        for (int i = 0; i < block->count; ++i) {
+            block->at(i).~T();
+        }
+        BlockTraits::destroy(allocator, block);
+        BlockTraits::deallocate(allocator, block, 1);
+        block = next;
+    }
+    head = nullptr;
+    tail = nullptr;
+    size = 0;
+}
@@ -0,0 +1,181 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include "NodePool.h"
+
+// テンプレートクラス XorDoublyLinkedList
+// 前後のノードのアドレスの排他的論理和 (XOR) を 1 ワードだけ持つダブルリンクリストの実装
+// ノードごとのつなぎの領域が DoublyLinkedList の半分 (ポインタ 1 つ分) で済み、両方向に走査できる
+// イテレータは現在のノードと前のノードを持ち、前のノードのアドレスとの XOR で次のノードを求める
+// Iterator / ConstIterator / Insert / Delete の使い方は DoublyLinkedList と同じ
+//
+// イテレータの有効性:
+//   イテレータは前のノードも覚えているため、前のノードが変わるとそのイテレータは無効になる
+//   Insert は挿入位置のイテレータ (と同じ要素を指すイテレータ) を、Delete は削除した要素と次の要素を指すイテレータを無効にする
+//   それ以外の要素を指すイテレータと end() は有効なまま
+template<typename T, typename Allocator = PoolAllocator<T>>
+class XorDoublyLinkedList {
+private:
+    // ノードの定義
+    struct Node {
+        T data;
+        uintptr_t link; // 前のノードと次のノードのアドレスの XOR (先頭・末尾では nullptr を 0 とする)
+
+        Node(const T& rd);
+    };
+
+    Node* head; // リストの先頭ノード
+    Node* tail; // リストの末尾ノード
+    int size;   // リストのサイズ
+
+    typedef typename std::allocator_traits<Allocator>::template rebind_alloc<Node> NodeAllocator;
+    typedef std::allocator_traits<NodeAllocator> NodeTraits;
+
+    NodeAllocator allocator; // ノードを確保するアロケータ
+
+    // 隣のノードを求める関数
+    // 入力: ノード (const Node*), 片側の隣のノード (const Node*、先頭・末尾では nullptr)
+    // 戻り値: 反対側の隣のノード
+    static Node* neighbor(const Node* node, const Node* other);
+
+    // ノードを生成する関数
+    // 入力: ノードに格納するデータ (const T&)
+    // 戻り値: アロケータから確保して初期化したノード
+    Node* createNode(const T& data);
+
+    // ノードを破棄する関数
+    // 入力: 破棄するノード (Node*)
+    // 期待結果: データが破棄され、領域がアロケータに返される
+    void destroyNode(Node* node);
+
+public:
+    // 定数イテレータクラス
+    class ConstIterator {
+    private:
+        Node* current;                          // 現在のノード
+        Node* prev;                             // 前のノード (current が先頭・nullptr の場合は使わない)
+        const XorDoublyLinkedList* list;        // 所属するリスト
+
+        friend class XorDoublyLinkedList;
+
+    public:
+        // コンストラクタ
+        // 入力: ノード (Node*), 前のノード (Node*), リスト (const XorDoublyLinkedList*)
+        // 期待結果: 定数イテレータが生成される
+        ConstIterator(Node* node, Node* prev, const XorDoublyLinkedList* list);
+        // コピーコンストラクタ
+        // 入力: 既存のConstIterator
+        // 期待結果: 新しいConstIteratorが既存のものと同じ位置を指す
+        ConstIterator(const ConstIterator& other);
+
+        // イテレータを前に進める
+        // 期待結果: イテレータが一つ前のノードを指すようになる
+        ConstIterator& operator--();
+        // イテレータを前に進める（ポストデクリメント）
+        // 期待結果: イテレータが一つ前のノードを指し、以前の状態のコピーが返される
+        ConstIterator operator--(int);
+        // イテレータを次に進める
+        // 期待結果: イテレータが一つ次のノードを指すようになる
+        ConstIterator& operator++();
+        // イテレータを次に進める（ポストインクリメント）
+        // 期待結果: イテレータが一つ次のノードを指し、以前の状態のコピーが返される
+        ConstIterator operator++(int);
+
+        // イテレータが指しているデータを取得
+        // 期待結果: ノードのデータが返される
+        const T& operator*() const;
+        // イテレータが指しているデータのポインタを取得
+        // 期待結果: ノードのデータへのポインタが返される
+        const T* operator->() const;
+
+        // イテレータの代入
+        // 入力: 既存のConstIterator
+        // 期待結果: イテレータが既存のものと同じ位置を指すようになる
+        void operator=(const ConstIterator& other);
+        // イテレータの等価比較
+        // 入力: 既存のConstIterator
+        // 期待結果: イテレータが同じ位置を指している場合はtrue、それ以外はfalseが返される
+        bool operator==(const ConstIterator& other) const;
+        // イテレータの非等価比較
+        // 入力: 既存のConstIterator
+        // 期待結果: イテレータが異なる位置を指している場合はtrue、それ以外はfalseが返される
+        bool operator!=(const ConstIterator& other) const;
+    };
+
+    // 非定数イテレータクラス
+    class Iterator : public ConstIterator {
+    public:
+        // コンストラクタ
+        // 入力: ノード (Node*), 前のノード (Node*), リスト (const XorDoublyLinkedList*)
+        // 期待結果: イテレータが生成される
+        Iterator(Node* node, Node* prev, const XorDoublyLinkedList* list);
+
+        // イテレータを前に進める
+        // 期待結果: イテレータが一つ前のノードを指すようになる
+        Iterator& operator--();
+        // イテレータを前に進める（ポストデクリメント）
+        // 期待結果: イテレータが一つ前のノードを指し、以前の状態のコピーが返される
+        Iterator operator--(int);
+        // イテレータを次に進める
+        // 期待結果: イテレータが一つ次のノードを指すようになる
+        Iterator& operator++();
+        // イテレータを次に進める（ポストインクリメント）
+        // 期待結果: イテレータが一つ次のノードを指し、以前の状態のコピーが返される
+        Iterator operator++(int);
+
+        // イテレータが指しているデータを取得
+        // 期待結果: ノードのデータが返される
+        T& operator*();
+        // イテレータが指しているデータのポインタを取得
+        // 期待結果: ノードのデータへのポインタが返される
+        T* operator->();
+    };
+
+    // コンストラクタ
+    // 入力: ノードの確保に使うアロケータ (const Allocator&、省略時は既定のアロケータ)
+    // 期待結果: 空のリストが生成される
+    explicit XorDoublyLinkedList(const Allocator& allocator = Allocator());
+
+    XorDoublyLinkedList(const XorDoublyLinkedList&) = delete;
+    XorDoublyLinkedList& operator=(const XorDoublyLinkedList&) = delete;
+
+    // リストのサイズを取得
+    // 期待結果: リストのサイズが返される
+    int GetSize() const;
+
+    // ノードを挿入
+    // 入力: 挿入位置のイテレータ (const Iterator& または ConstIterator&), 挿入するデータ (const T&)
+    // 戻り値: 挿入が成功した場合はtrue、イテレータが別のリストのものである場合はfalse
+    // 期待結果: イテレータが指すノードの前 (end() の場合は末尾) にデータが入る
+    template<typename Iter>
+    bool Insert(const Iter& iter, const T& data);
+
+    // ノードを削除
+    // 入力: 削除する位置のイテレータ (const Iterator& または ConstIterator&)
+    // 戻り値: 削除が成功した場合はtrue、end() や別のリストのイテレータの場合はfalse
+    template<typename Iter>
+    bool Delete(const Iter& iter);
+
+    // リストの先頭を指すイテレータを取得
+    // 期待結果: 先頭ノードを指すイテレータが返される
+    Iterator begin();
+    // リストの先頭を指す定数イテレータを取得
+    // 期待結果: 先頭ノードを指す定数イテレータが返される
+    ConstIterator begin() const;
+    // リストの末尾を指すイテレータを取得
+    // 期待結果: nullptrを指すイテレータが返される
+    Iterator end();
+    // リストの末尾を指す定数イテレータを取得
+    // 期待結果: nullptrを指す定数イテレータが返される
+    ConstIterator end() const;
+
+    // リストの全ノードを削除
+    // 期待結果: リストが空になり、全ノードが解放される
+    void Clear();
+
+    // デストラクタ
+    // 期待結果: リストの全ノードが解放される
+    ~XorDoublyLinkedList();
+};
+
+#include "XorDLL.inl"
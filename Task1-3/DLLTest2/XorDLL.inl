@@ -0,0 +1,384 @@
+#include <cassert>
+
+// ノードのコンストラクタ
+// 引数: const T& rd - ノードに格納するデータ
+// 期待結果: つながりのないノードが初期化される
+template<typename T, typename Allocator>
+XorDoublyLinkedList<T, Allocator>::Node::Node(const T& rd) : data(rd), link(0) {}
+
+// 隣のノードを求める関数
+// 引数: const Node* node - ノード, const Node* other - 片側の隣のノード
+// 戻り値: 反対側の隣のノード
+template<typename T, typename Allocator>
+typename XorDoublyLinkedList<T, Allocator>::Node* XorDoublyLinkedList<T, Allocator>::neighbor(const Node* node, const Node* other) {
+    return reinterpret_cast<Node*>(node->link ^ reinterpret_cast<uintptr_t>(other));
+}
+
+// ConstIterator のコンストラクタ
+// 引数: Node* node - 現在のノード
+//       Node* prev - 前のノード
+//       const XorDoublyLinkedList* list - 関連するリスト
+// 期待結果: ConstIterator が初期化される
+template<typename T, typename Allocator>
+XorDoublyLinkedList<T, Allocator>::ConstIterator::ConstIterator(Node* node, Node* prev, const XorDoublyLinkedList* list) : current(node), prev(prev), list(list) {}
+
+// ConstIterator のコピーコンストラクタ
+// 引数: const ConstIterator& other - コピー元のイテレータ
+// 期待結果: ConstIterator がコピーされる
+template<typename T, typename Allocator>
+XorDoublyLinkedList<T, Allocator>::ConstIterator::ConstIterator(const ConstIterator& other) : current(other.current), prev(other.prev), list(other.list) {}
+
+// 前置デクリメント演算子
+// 期待結果: イテレータが前のノードに移動する (先頭からは nullptr、nullptr からは末尾に移る)
+// 戻り値: 自身の参照
+template<typename T, typename Allocator>
+typename XorDoublyLinkedList<T, Allocator>::ConstIterator& XorDoublyLinkedList<T, Allocator>::ConstIterator::operator--() {
+    assert(list != nullptr);
+    assert(list->tail != nullptr);
+
+    if (current == nullptr) {
+        current = list->tail;
+        prev = neighbor(current, nullptr);
+    }
+    else if (current == list->head) {
+        current = nullptr;
+        prev = nullptr;
+    }
+    else {
+        Node* before = neighbor(prev, current);
+        current = prev;
+        prev = before;
+    }
+    return *this;
+}
+
+// 後置デクリメント演算子
+// 期待結果: イテレータが前のノードに移動する
+// 戻り値: 移動前のイテレータのコピー
+template<typename T, typename Allocator>
+typename XorDoublyLinkedList<T, Allocator>::ConstIterator XorDoublyLinkedList<T, Allocator>::ConstIterator::operator--(int) {
+    assert(list != nullptr);
+    assert(list->tail != nullptr);
+
+    ConstIterator temp = *this;
+    --(*this);
+    return temp;
+}
+
+// 前置インクリメント演算子
+// 期待結果: イテレータが次のノードに移動する (末尾からは nullptr、nullptr からは先頭に移る)
+// 戻り値: 自身の参照
+template<typename T, typename Allocator>
+typename XorDoublyLinkedList<T, Allocator>::ConstIterator& XorDoublyLinkedList<T, Allocator>::ConstIterator::operator++() {
+    assert(list != nullptr);
+    assert(list->tail != nullptr);
+
+    if (current == nullptr) {
+        current = list->head;
+        prev = nullptr;
+    }
+    else {
+        Node* next = neighbor(current, current == list->head ? nullptr : prev);
+        prev = current;
+        current = next;
+    }
+    return *this;
+}
+
+// 後置インクリメント演算子
+// 期待結果: イテレータが次のノードに移動する
+// 戻り値: 移動前のイテレータのコピー
+template<typename T, typename Allocator>
+typename XorDoublyLinkedList<T, Allocator>::ConstIterator XorDoublyLinkedList<T, Allocator>::ConstIterator::operator++(int) {
+    assert(list != nullptr);
+    assert(list->tail != nullptr);
+
+    ConstIterator temp = *this;
+    ++(*this);
+    return temp;
+}
+
+// デリファレンス演算子
+// 期待結果: 現在のノードのデータを返す
+// 戻り値: 現在のノードのデータの参照
+template<typename T, typename Allocator>
+const T& XorDoublyLinkedList<T, Allocator>::ConstIterator::operator*() const {
+    assert(current != nullptr);
+    return current->data;
+}
+
+// アロー演算子
+// 期待結果: 現在のノードのデータへのポインタを返す
+// 戻り値: 現在のノードのデータへのポインタ
+template<typename T, typename Allocator>
+const T* XorDoublyLinkedList<T, Allocator>::ConstIterator::operator->() const {
+    assert(current != nullptr);
+    return &current->data;
+}
+
+// 代入演算子
+// 期待結果: イテレータの状態をコピーする
+// 引数: const ConstIterator& other - コピー元のイテレータ
+template<typename T, typename Allocator>
+void XorDoublyLinkedList<T, Allocator>::ConstIterator::operator=(const ConstIterator& other) {
+    current = other.current;
+    prev = other.prev;
+    list = other.list;
+}
+
+// 等価比較演算子
+// 期待結果: イテレータが指しているノードが同じ場合に true を返す (前のノードは比較しない)
+// 引数: const ConstIterator& other - 比較対象のイテレータ
+// 戻り値: 等しい場合は true, それ以外は false
+template<typename T, typename Allocator>
+bool XorDoublyLinkedList<T, Allocator>::ConstIterator::operator==(const ConstIterator& other) const {
+    return current == other.current;
+}
+
+// 非等価比較演算子
+// 期待結果: イテレータが指しているノードが異なる場合に true を返す
+// 引数: const ConstIterator& other - 比較対象のイテレータ
+// 戻り値: 異なる場合は true, それ以外は false
+template<typename T, typename Allocator>
+bool XorDoublyLinkedList<T, Allocator>::ConstIterator::operator!=(const ConstIterator& other) const {
+    return !(*this == other);
+}
+
+// Iterator のコンストラクタ
+// 引数: Node* node - 現在のノード
+//       Node* prev - 前のノード
+//       const XorDoublyLinkedList* list - 関連するリスト
+// 期待結果: Iterator が初期化される
+template<typename T, typename Allocator>
+XorDoublyLinkedList<T, Allocator>::Iterator::Iterator(Node* node, Node* prev, const XorDoublyLinkedList* list) : ConstIterator(node, prev, list) {}
+
+// 前置デクリメント演算子
+// 期待結果: イテレータが前のノードに移動する
+// 戻り値: 自身の参照
+template<typename T, typename Allocator>
+typename XorDoublyLinkedList<T, Allocator>::Iterator& XorDoublyLinkedList<T, Allocator>::Iterator::operator--() {
+    assert(this->list != nullptr);
+    assert(this->list->tail != nullptr);
+    assert(this->current != this->list->head);
+
+    ConstIterator::operator--();
+    return *this;
+}
+
+// 後置デクリメント演算子
+// 期待結果: イテレータが前のノードに移動する
+// 戻り値: 移動前のイテレータのコピー
+template<typename T, typename Allocator>
+typename XorDoublyLinkedList<T, Allocator>::Iterator XorDoublyLinkedList<T, Allocator>::Iterator::operator--(int) {
+    assert(this->list != nullptr);
+    assert(this->list->tail != nullptr);
+    assert(this->current != this->list->head);
+
+    Iterator temp = *this;
+    --(*this);
+    return temp;
+}
+
+// 前置インクリメント演算子
+// 期待結果: イテレータが次のノードに移動する
+// 戻り値: 自身の参照
+template<typename T, typename Allocator>
+typename XorDoublyLinkedList<T, Allocator>::Iterator& XorDoublyLinkedList<T, Allocator>::Iterator::operator++() {
+    assert(this->current != nullptr);
+
+    ConstIterator::operator++();
+    return *this;
+}
+
+// 後置インクリメント演算子
+// 期待結果: イテレータが次のノードに移動する
+// 戻り値: 移動前のイテレータのコピー
+template<typename T, typename Allocator>
+typename XorDoublyLinkedList<T, Allocator>::Iterator XorDoublyLinkedList<T, Allocator>::Iterator::operator++(int) {
+    assert(this->current != nullptr);
+
+    Iterator temp = *this;
+    ++(*this);
+    return temp;
+}
+
+// デリファレンス演算子
+// 期待結果: 現在のノードのデータを返す
+// 戻り値: 現在のノードのデータの参照
+template<typename T, typename Allocator>
+T& XorDoublyLinkedList<T, Allocator>::Iterator::operator*() {
+    assert(this->current != nullptr);
+    return this->current->data;
+}
+
+// アロー演算子
+// 期待結果: 現在のノードのデータへのポインタを返す
+// 戻り値: 現在のノードのデータへのポインタ
+template<typename T, typename Allocator>
+T* XorDoublyLinkedList<T, Allocator>::Iterator::operator->() {
+    assert(this->current != nullptr);
+    return &this->current->data;
+}
+
+// XorDoublyLinkedList のコンストラクタ
+// 引数: const Allocator& allocator - ノードの確保に使うアロケータ
+// 期待結果: 空のリストが初期化される
+template<typename T, typename Allocator>
+XorDoublyLinkedList<T, Allocator>::XorDoublyLinkedList(const Allocator& allocator) : head(nullptr), tail(nullptr), size(0), allocator(allocator) {}
+
+// ノードを生成する関数
+// 引数: const T& data - ノードに格納するデータ
+// 戻り値: アロケータから確保して初期化したノード
+template<typename T, typename Allocator>
+typename XorDoublyLinkedList<T, Allocator>::Node* XorDoublyLinkedList<T, Allocator>::createNode(const T& data) {
+    Node* node = NodeTraits::allocate(allocator, 1);
+    try {
+        NodeTraits::construct(allocator, node, data);
+    }
+    catch (...) {
+        NodeTraits::deallocate(allocator, node, 1);
+        throw;
+    }
+    return node;
+}
+
+// ノードを破棄する関数
+// 引数: Node* node - 破棄するノード
+// 期待結果: データが破棄され、領域がアロケータに返される
+template<typename T, typename Allocator>
+void XorDoublyLinkedList<T, Allocator>::destroyNode(Node* node) {
+    NodeTraits::destroy(allocator, node);
+    NodeTraits::deallocate(allocator, node, 1);
+}
+
+// リストのサイズを取得する関数
+// 期待結果: リストのサイズを返す
+// 戻り値: リストのサイズ
+template<typename T, typename Allocator>
+int XorDoublyLinkedList<T, Allocator>::GetSize() const {
+    return size;
+}
+
+// ノードを挿入
+// 引数: const Iterator& または ConstIterator& iter - 挿入位置のイテレータ, const T& data - 挿入するデータ
+// 期待結果: イテレータが指すノードと前のノードの間 (end() の場合は末尾) に新しいノードが入り、両隣の XOR が付け替えられる
+// 戻り値: 挿入が成功した場合はtrue、失敗した場合はfalse
+template<typename T, typename Allocator>
+template<typename Iter>
+bool XorDoublyLinkedList<T, Allocator>::Insert(const Iter& iter, const T& data) {
+    if (iter.list != this) return false;
+
+    Node* next = iter.current;
+    Node* prev = next == nullptr ? tail : (next == head ? nullptr : iter.prev); // end() はいつでも末尾を前のノードとする
+    Node* newNode = createNode(data);
+    uintptr_t prevAddress = reinterpret_cast<uintptr_t>(prev);
+    uintptr_t nextAddress = reinterpret_cast<uintptr_t>(next);
+    uintptr_t newAddress = reinterpret_cast<uintptr_t>(newNode);
+
+    newNode->link = prevAddress ^ nextAddress;
+    if (prev != nullptr) {
+        prev->link ^= nextAddress ^ newAddress;
+    }
+    else {
+        head = newNode; // Insert at beginning or empty list
+    }
+    if (next != nullptr) {
+        next->link ^= prevAddress ^ newAddress;
+    }
+    else {
+        tail = newNode; // Insert at end or empty list
+    }
+
+    size++;
+    return true;
+}
+
+// 指定された位置のノードを削除する関数
+// 引数: const Iterator& または ConstIterator& iter - 削除位置のイテレータ
+// 期待結果: 指定された位置のノードが削除され、両隣の XOR が付け替えられる
+// 戻り値: 削除に成功した場合は true, それ以外は false
+template<typename T, typename Allocator>
+template<typename Iter>
+bool XorDoublyLinkedList<T, Allocator>::Delete(const Iter& iter) {
+    Node* current = iter.current;
+
+    if (current == nullptr || iter.list != this) return false;
+
+    Node* prev = current == head ? nullptr : iter.prev;
+    Node* next = neighbor(current, prev);
+    uintptr_t prevAddress = reinterpret_cast<uintptr_t>(prev);
+    uintptr_t nextAddress = reinterpret_cast<uintptr_t>(next);
+    uintptr_t currentAddress = reinterpret_cast<uintptr_t>(current);
+
+    if (prev != nullptr) {
+        prev->link ^= currentAddress ^ nextAddress;
+    }
+    else {
+        head = next; // Deleting the first node
+    }
+    if (next != nullptr) {
+        next->link ^= currentAddress ^ prevAddress;
+    }
+    else {
+        tail = prev; // Deleting the last node
+    }
+
+    destroyNode(current);
+    size--;
+    return true;
+}
+
+// リストの先頭のイテレータを返す関数
+// 期待結果: リストの先頭のイテレータを返す
+// 戻り値: リストの先頭のイテレータ
+template<typename T, typename Allocator>
+typename XorDoublyLinkedList<T, Allocator>::Iterator XorDoublyLinkedList<T, Allocator>::begin() {
+    return Iterator(head, nullptr, this);
+}
+
+// リストの先頭のイテレータを返す関数（const版）
+// 期待結果: リストの先頭のイテレータを返す
+// 戻り値: リストの先頭のイテレータ
+template<typename T, typename Allocator>
+typename XorDoublyLinkedList<T, Allocator>::ConstIterator XorDoublyLinkedList<T, Allocator>::begin() const {
+    return ConstIterator(head, nullptr, this);
+}
+
+// リストの末尾のイテレータを返す関数
+// 期待結果: リストの末尾のイテレータを返す
+// 戻り値: リストの末尾のイテレータ
+template<typename T, typename Allocator>
+typename XorDoublyLinkedList<T, Allocator>::Iterator XorDoublyLinkedList<T, Allocator>::end() {
+    return Iterator(nullptr, nullptr, this);
+}
+
+// リストの末尾のイテレータを返す関数（const版）
+// 期待結果: リストの末尾のイテレータを返す
+// 戻り値: リストの末尾のイテレータ
+template<typename T, typename Allocator>
+typename XorDoublyLinkedList<T, Allocator>::ConstIterator XorDoublyLinkedList<T, Allocator>::end() const {
+    return ConstIterator(nullptr, nullptr, this);
+}
+
+// XorDoublyLinkedList のデストラクタ
+// 期待結果: リストの全ノードが解放される
+template<typename T, typename Allocator>
+XorDoublyLinkedList<T, Allocator>::~XorDoublyLinkedList() {
+    Clear();
+}
+
+// リストの全ノードを削除する関数
+// 期待結果: リストの全ノードが解放され、空のリストになる
+template<typename T, typename Allocator>
+void XorDoublyLinkedList<T, Allocator>::Clear() {
+    Node* prev = nullptr;
+    Node* current = head;
+    while (current != nullptr) {
+        Node* next = neighbor(current, prev);
+        destroyNode(current);
+        prev = current;
+        current = next;
+    }
+    head = tail = nullptr;
+    size = 0;
+}
@@ -0,0 +1,60 @@
+#include "Arena.h"
+#include <cstdint>
+#include <new>
+
+// Arena のコンストラクタ
+// 引数: size_t pageSize - 1 ページの大きさ
+// 期待結果: ページを持たない空のアリーナが生成される
+Arena::Arena(size_t pageSize) : current(nullptr), cursor(nullptr), limit(nullptr), pageSize(pageSize), pageCount(0) {}
+
+// ページを追加する関数
+// 引数: size_t size - 切り出す領域の大きさ, size_t align - 境界
+// 期待結果: size バイトを align 境界で切り出せるページが切り出し中のページになる
+void Arena::addPage(size_t size, size_t align) {
+    size_t required = HeaderSize + size + (align > alignof(std::max_align_t) ? align : 0);
+    size_t bytes = required > pageSize ? required : pageSize;
+    Page* page = static_cast<Page*>(::operator new(bytes));
+    page->prev = current;
+    current = page;
+    cursor = reinterpret_cast<char*>(page) + HeaderSize;
+    limit = reinterpret_cast<char*>(page) + bytes;
+    pageCount++;
+}
+
+// 領域を確保する関数
+// 引数: size_t size - 大きさ, size_t align - 境界
+// 戻り値: 未初期化の領域
+void* Arena::Allocate(size_t size, size_t align) {
+    uintptr_t address = (reinterpret_cast<uintptr_t>(cursor) + align - 1) & ~static_cast<uintptr_t>(align - 1);
+    if (cursor == nullptr || address + size > reinterpret_cast<uintptr_t>(limit)) {
+        addPage(size, align);
+        address = (reinterpret_cast<uintptr_t>(cursor) + align - 1) & ~static_cast<uintptr_t>(align - 1);
+    }
+    cursor = reinterpret_cast<char*>(address + size);
+    return reinterpret_cast<void*>(address);
+}
+
+// 全てのページを返す関数
+// 期待結果: アリーナが空になる (ページを先頭から順に解放するだけで、個々の領域はたどらない)
+void Arena::Release() {
+    while (current != nullptr) {
+        Page* prev = current->prev;
+        ::operator delete(current);
+        current = prev;
+    }
+    cursor = nullptr;
+    limit = nullptr;
+    pageCount = 0;
+}
+
+// 確保しているページ数を取得する関数
+// 戻り値: ページ数
+size_t Arena::GetPageCount() const {
+    return pageCount;
+}
+
+// Arena のデストラクタ
+// 期待結果: 全てのページが解放される
+Arena::~Arena() {
+    Release();
+}
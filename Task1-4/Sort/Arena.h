@@ -0,0 +1,134 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+// アリーナクラス
+// ページの先頭から順に領域を切り出すだけの単調増加 (monotonic) なアロケータ
+// 個別の解放は行わず、Release またはデストラクタでページをまとめて返すため、
+// 一括で作って一括で捨てるリスト (ファイルから読み込み、ソートして表示し、破棄する) の確保・破棄が O(ページ数) で済む
+class Arena {
+private:
+    // ページの先頭に置く管理領域
+    struct Page {
+        Page* prev;  // 前に確保したページ
+    };
+
+    static const size_t HeaderSize = (sizeof(Page) + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t); // 管理領域の大きさ (境界に揃える)
+
+    Page* current;    // 切り出し中のページ (prev をたどると全てのページを回れる)
+    char* cursor;     // 切り出し中のページの未使用部分の先頭
+    char* limit;      // 切り出し中のページの末尾
+    size_t pageSize;  // 1 ページの大きさ (バイト)
+    size_t pageCount; // 確保しているページ数
+
+    // ページを追加する関数
+    // 入力: 切り出す領域の大きさ (size_t size), 境界 (size_t align)
+    // 期待結果: size バイトを align 境界で切り出せるページが切り出し中のページになる
+    //           pageSize に収まらない領域は専用の大きさのページを確保する
+    void addPage(size_t size, size_t align);
+
+public:
+    static const size_t DefaultPageSize = 64 * 1024; // 既定のページの大きさ (バイト)
+
+    // コンストラクタ
+    // 入力: 1 ページの大きさ (size_t pageSize、省略時は 64 KiB)
+    // 期待結果: ページを持たない空のアリーナが生成される
+    explicit Arena(size_t pageSize = DefaultPageSize);
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    // 領域を確保する関数
+    // 入力: 大きさ (size_t size), 境界 (size_t align、2 のべき乗であること)
+    // 戻り値: 未初期化の領域 (ポインタを境界に揃えて進めるだけで、ページが足りない場合だけページを追加する)
+    void* Allocate(size_t size, size_t align);
+
+    // 全てのページを返す関数
+    // 期待結果: アリーナが空になる (確保済みの領域は全て無効になる)
+    void Release();
+
+    // 確保しているページ数を取得する関数
+    // 戻り値: ページ数
+    size_t GetPageCount() const;
+
+    // デストラクタ
+    // 期待結果: 全てのページが解放される
+    ~Arena();
+};
+
+// テンプレートクラス ArenaAllocator
+// Arena から領域を確保するアロケータ
+// deallocate は何もせず、アリーナは最後のアロケータのコピー (リストの持つ分を含む) が破棄された時点でまとめて解放される
+// SkipDestructors が true の場合、リストの Clear / デストラクタでデータのデストラクタを呼ばずに捨てる
+// (データが解放の必要な資源を持たない場合だけ指定すること。T がトリビアルに破棄できる場合は指定しなくても省略される)
+template<typename T, bool SkipDestructors = false>
+class ArenaAllocator {
+private:
+    std::shared_ptr<Arena> arena; // 確保元のアリーナ
+
+    template<typename U, bool Skip>
+    friend class ArenaAllocator;
+
+public:
+    typedef T value_type;
+
+    // 別の要素型のアロケータ (SkipDestructors は引き継ぐ)
+    template<typename U>
+    struct rebind {
+        typedef ArenaAllocator<U, SkipDestructors> other;
+    };
+
+    // コンストラクタ
+    // 期待結果: 新しいアリーナを持つアロケータが生成される
+    ArenaAllocator();
+
+    // コンストラクタ
+    // 入力: 確保元のアリーナ (std::shared_ptr<Arena> arena、複数のリストで共有する場合)
+    // 期待結果: arena から確保するアロケータが生成される
+    explicit ArenaAllocator(std::shared_ptr<Arena> arena);
+
+    // 別の型のアロケータからのコンストラクタ
+    // 入力: 既存のアロケータ
+    // 期待結果: 同じアリーナから確保するアロケータが生成される
+    template<typename U>
+    ArenaAllocator(const ArenaAllocator<U, SkipDestructors>& other);
+
+    // 領域を確保する関数
+    // 入力: 要素数 (size_t count)
+    // 戻り値: count 要素分の未初期化の領域
+    T* allocate(size_t count);
+
+    // 領域を解放する関数
+    // 期待結果: 何もしない (領域はアリーナごとまとめて解放される)
+    void deallocate(T* memory, size_t count);
+
+    // 確保元のアリーナを取得する関数
+    // 戻り値: アリーナ
+    Arena& GetArena() const;
+
+    // アロケータの等価比較
+    // 入力: 既存のアロケータ
+    // 期待結果: 同じアリーナから確保する場合は true、それ以外は false が返される
+    template<typename U>
+    bool operator==(const ArenaAllocator<U, SkipDestructors>& other) const;
+
+    // アロケータの非等価比較
+    // 入力: 既存のアロケータ
+    // 期待結果: 異なるアリーナから確保する場合は true、それ以外は false が返される
+    template<typename U>
+    bool operator!=(const ArenaAllocator<U, SkipDestructors>& other) const;
+};
+
+// テンプレート構造体 SkipsDestruction
+// アロケータで確保した要素を、Clear / デストラクタで個別に破棄せずに捨ててよいかを判定する
+// 既定では false (全ての要素のデストラクタを呼び、領域をアロケータに返す)
+template<typename Allocator>
+struct SkipsDestruction : std::false_type {};
+
+// ArenaAllocator では領域を個別に返す必要がないため、デストラクタを呼ばなくてよい場合は true
+template<typename T, bool SkipDestructors>
+struct SkipsDestruction<ArenaAllocator<T, SkipDestructors>>
+    : std::integral_constant<bool, SkipDestructors || std::is_trivially_destructible<T>::value> {};
+
+#include "Arena.inl"
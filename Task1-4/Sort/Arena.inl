@@ -0,0 +1,55 @@
+// ArenaAllocator のコンストラクタ
+// 期待結果: 新しいアリーナを持つアロケータが生成される
+template<typename T, bool SkipDestructors>
+ArenaAllocator<T, SkipDestructors>::ArenaAllocator() : arena(std::make_shared<Arena>()) {}
+
+// ArenaAllocator のコンストラクタ
+// 入力: 確保元のアリーナ (std::shared_ptr<Arena> arena)
+// 期待結果: arena から確保するアロケータが生成される
+template<typename T, bool SkipDestructors>
+ArenaAllocator<T, SkipDestructors>::ArenaAllocator(std::shared_ptr<Arena> arena) : arena(std::move(arena)) {}
+
+// 別の型のアロケータからのコンストラクタ
+// 入力: 既存のアロケータ
+// 期待結果: 同じアリーナから確保するアロケータが生成される
+template<typename T, bool SkipDestructors>
+template<typename U>
+ArenaAllocator<T, SkipDestructors>::ArenaAllocator(const ArenaAllocator<U, SkipDestructors>& other) : arena(other.arena) {}
+
+// 領域を確保する関数
+// 入力: 要素数 (size_t count)
+// 戻り値: アリーナから切り出した count 要素分の未初期化の領域
+template<typename T, bool SkipDestructors>
+T* ArenaAllocator<T, SkipDestructors>::allocate(size_t count) {
+    return static_cast<T*>(arena->Allocate(count * sizeof(T), alignof(T)));
+}
+
+// 領域を解放する関数
+// 期待結果: 何もしない (領域はアリーナごとまとめて解放される)
+template<typename T, bool SkipDestructors>
+void ArenaAllocator<T, SkipDestructors>::deallocate(T*, size_t) {}
+
+// 確保元のアリーナを取得する関数
+// 戻り値: アリーナ
+template<typename T, bool SkipDestructors>
+Arena& ArenaAllocator<T, SkipDestructors>::GetArena() const {
+    return *arena;
+}
+
+// アロケータの等価比較
+// 入力: 既存のアロケータ
+// 戻り値: 同じアリーナから確保する場合は true、それ以外は false
+template<typename T, bool SkipDestructors>
+template<typename U>
+bool ArenaAllocator<T, SkipDestructors>::operator==(const ArenaAllocator<U, SkipDestructors>& other) const {
+    return arena == other.arena;
+}
+
+// アロケータの非等価比較
+// 入力: 既存のアロケータ
+// 戻り値: 異なるアリーナから確保する場合は true、それ以外は false
+template<typename T, bool SkipDestructors>
+template<typename U>
+bool ArenaAllocator<T, SkipDestructors>::operator!=(const ArenaAllocator<U, SkipDestructors>& other) const {
+    return arena != other.arena;
+}
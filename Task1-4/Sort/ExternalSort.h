@@ -0,0 +1,101 @@
+#pragma once
+#include <cstddef>
+#include <fstream>
+#include <functional>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "Sort.h"
+
+// 一時ファイル名に使う番号を払い出す関数
+// 戻り値: プロセス内で重複しない通し番号 (全てのソーター・スレッドで共有する)
+inline unsigned long long NextTempFileId();
+
+// 一時ファイル名に使うプロセス ID を取得する関数
+// 戻り値: 現在のプロセス ID
+inline long CurrentProcessId();
+
+// テンプレートクラス ExternalSorter
+// メモリに載り切らない行単位のデータをソートする外部マージソート
+// 入力をメモリ予算に収まるチャンクごとにリストへ読み込んでソートし、一時ファイルに書き出したランを敗者木で k-way マージする
+// チャンクの読み込みと、1 つ前のチャンクのソート・書き出しは並行して行う (ダブルバッファリング)
+template<typename T>
+class ExternalSorter {
+public:
+    using Parser = std::function<bool(const std::string&, T&)>;      // 1 行をデータに変換する関数 (変換できない行は false)
+    using Formatter = std::function<void(std::ostream&, const T&)>; // データを 1 行分 (改行なし) 書き出す関数
+
+private:
+    // 一時ファイルのランを先頭から読むリーダー
+    struct RunReader {
+        std::ifstream file; // ランのファイル
+        T current;          // 現在の先頭データ
+        bool valid;         // 先頭データがある場合は true
+    };
+
+    std::function<bool(const T&, const T&)> comp; // 比較関数
+    Parser parse;                                 // 行の変換関数
+    Formatter format;                             // 行の書き出し関数
+    size_t memoryBudget;                          // チャンクに使うメモリの上限 (バイト)
+    std::string tempDirectory;                    // 一時ファイルを置くディレクトリ
+    size_t fanIn;                                 // 1 回のマージで同時に開くランの最大数
+    size_t runCount;                              // 直前のソートで書き出したランの数
+    size_t peakChunkBytes;                        // 直前のソートで読み込んだチャンクの最大見積もりサイズ
+
+    // 1 件分のメモリ使用量を見積もる関数
+    // 入力: 行の長さ (size_t length)
+    // 戻り値: リストのノードとソート用の作業領域を含めたバイト数
+    static size_t estimateSize(size_t length);
+
+    // 次の一時ファイルのパスを作る関数
+    // 戻り値: 一時ディレクトリ内の重複しないファイルパス (プロセス ID とプロセス内の通し番号で区別する)
+    std::string makeTempPath();
+
+    // メモリ予算の半分に収まるだけ入力を読み込む関数
+    // 入力: 入力ストリーム (std::istream& input), 格納先のリスト (DoublyLinkedList<T>& chunk)
+    // 戻り値: 読み込んだチャンクの見積もりサイズ
+    size_t readChunk(std::istream& input, DoublyLinkedList<T>& chunk) const;
+
+    // チャンクをソートして書き出す関数
+    // 入力: チャンク (DoublyLinkedList<T>& chunk), 出力ストリーム (std::ostream& output)
+    // 戻り値: 書き出しに成功した場合は true
+    bool writeSorted(DoublyLinkedList<T>& chunk, std::ostream& output) const;
+
+    // ランを k-way マージする関数
+    // 入力: ランのファイルパス (const std::vector<std::string>& runs), 出力ストリーム (std::ostream& output)
+    // 戻り値: 全てのランを開いて書き出せた場合は true
+    bool mergeRuns(const std::vector<std::string>& runs, std::ostream& output) const;
+
+    // 一時ファイルを削除する関数
+    // 入力: ファイルパス (const std::vector<std::string>& paths)
+    static void removeFiles(const std::vector<std::string>& paths);
+
+public:
+    // コンストラクタ
+    // 入力: 比較関数, 行の変換関数, 行の書き出し関数, メモリ予算 (バイト), 一時ファイルを置くディレクトリ, マージの最大ファンイン
+    // 期待結果: ソーターが生成される
+    ExternalSorter(const std::function<bool(const T&, const T&)>& comp, const Parser& parse, const Formatter& format,
+        size_t memoryBudget, const std::string& tempDirectory = ".", size_t fanIn = 64);
+
+    ExternalSorter(const ExternalSorter&) = delete;
+    ExternalSorter& operator=(const ExternalSorter&) = delete;
+
+    // 入力ストリームの全行をソートして出力する
+    // 入力: 入力ストリーム (std::istream& input), 出力ストリーム (std::ostream& output)
+    // 戻り値: ソートに成功した場合は true、比較関数が null の場合や一時ファイルを読み書きできない場合は false
+    // 期待結果: 変換できた行が比較関数の順に 1 行ずつ出力される (等しい要素は入力の順序を保つ)
+    //           一時ファイルは成功・失敗にかかわらず削除される
+    bool Sort(std::istream& input, std::ostream& output);
+
+    // 直前のソートで書き出したランの数を取得
+    // 戻り値: ランの数 (入力が 1 チャンクに収まった場合は 0)
+    size_t GetRunCount() const;
+
+    // 直前のソートで読み込んだチャンクの最大見積もりサイズを取得
+    // 戻り値: バイト数 (メモリ予算の半分を 1 件分だけ超えることがある)
+    size_t GetPeakChunkBytes() const;
+};
+
+#include "ExternalSort.inl"
@@ -0,0 +1,255 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <future>
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+// 一時ファイル名に使う番号を払い出す関数
+// 戻り値: プロセス内で重複しない通し番号
+// 期待結果: 別のソーターや、破棄されたソーターと同じアドレスに作られたソーターとも番号が重ならない
+inline unsigned long long NextTempFileId() {
+    static std::atomic<unsigned long long> nextId(0);
+    return nextId.fetch_add(1, std::memory_order_relaxed);
+}
+
+// 一時ファイル名に使うプロセス ID を取得する関数
+// 戻り値: 現在のプロセス ID (同じディレクトリを使う別のプロセスとファイル名を区別する)
+inline long CurrentProcessId() {
+#ifdef _WIN32
+    return static_cast<long>(_getpid());
+#else
+    return static_cast<long>(getpid());
+#endif
+}
+
+// ExternalSorter のコンストラクタ
+// 引数: const std::function<bool(const T&, const T&)>& comp - 比較関数
+//       const Parser& parse - 1 行をデータに変換する関数
+//       const Formatter& format - データを 1 行分書き出す関数
+//       size_t memoryBudget - チャンクに使うメモリの上限 (バイト)
+//       const std::string& tempDirectory - 一時ファイルを置くディレクトリ
+//       size_t fanIn - 1 回のマージで同時に開くランの最大数 (2 未満の場合は 2)
+// 期待結果: ソーターが初期化される
+template<typename T>
+ExternalSorter<T>::ExternalSorter(const std::function<bool(const T&, const T&)>& comp, const Parser& parse, const Formatter& format,
+    size_t memoryBudget, const std::string& tempDirectory, size_t fanIn)
+    : comp(comp), parse(parse), format(format), memoryBudget(memoryBudget), tempDirectory(tempDirectory),
+    fanIn(std::max<size_t>(fanIn, 2)), runCount(0), peakChunkBytes(0) {}
+
+// 1 件分のメモリ使用量を見積もる関数
+// 引数: size_t length - 行の長さ
+// 戻り値: 行の長さ + ノード (データと前後のポインタ) + ソート時のノード配列と位置の配列 2 本分のバイト数
+template<typename T>
+size_t ExternalSorter<T>::estimateSize(size_t length) {
+    return length + sizeof(T) + 3 * sizeof(void*) + 2 * sizeof(int);
+}
+
+// 次の一時ファイルのパスを作る関数
+// 戻り値: 一時ディレクトリ内の重複しないファイルパス
+// 期待結果: ソーターのアドレスは別のプロセスや後から作られたソーターと重なりうるため、プロセス ID とプロセス内の通し番号で名前を付ける
+template<typename T>
+std::string ExternalSorter<T>::makeTempPath() {
+    return tempDirectory + "/ExternalSort_" + std::to_string(CurrentProcessId()) +
+        "_" + std::to_string(NextTempFileId()) + ".tmp";
+}
+
+// メモリ予算の半分に収まるだけ入力を読み込む関数
+// 引数: std::istream& input - 入力ストリーム
+//       DoublyLinkedList<T>& chunk - 格納先のリスト
+// 戻り値: 読み込んだチャンクの見積もりサイズ
+// 期待結果: 変換できない行は読み飛ばされる (残りの半分は並行してソート・書き出し中のチャンクに使う)
+template<typename T>
+size_t ExternalSorter<T>::readChunk(std::istream& input, DoublyLinkedList<T>& chunk) const {
+    size_t bytes = 0;
+    std::string line;
+    T data;
+    while (bytes < memoryBudget / 2 && std::getline(input, line)) {
+        if (!parse(line, data)) continue;
+        chunk.Insert(chunk.end(), data);
+        bytes += estimateSize(line.size());
+    }
+    return bytes;
+}
+
+// チャンクをソートして書き出す関数
+// 引数: DoublyLinkedList<T>& chunk - チャンク
+//       std::ostream& output - 出力ストリーム
+// 戻り値: 書き出しに成功した場合は true
+// 期待結果: 安定ソートしたチャンクが 1 行ずつ書き出される
+template<typename T>
+bool ExternalSorter<T>::writeSorted(DoublyLinkedList<T>& chunk, std::ostream& output) const {
+    chunk.Sort(comp, ExecutionPolicy::Sequential);
+    for (auto it = chunk.begin(); it != chunk.end(); ++it) {
+        format(output, *it);
+        output << '\n';
+    }
+    return static_cast<bool>(output);
+}
+
+// ランを k-way マージする関数
+// 引数: const std::vector<std::string>& runs - ランのファイルパス (入力の順)
+//       std::ostream& output - 出力ストリーム
+// 戻り値: 全てのランを開いて書き出せた場合は true
+// 期待結果: 敗者木で最小の先頭データを選び続け、1 件につき O(log k) 回の比較でマージされる
+//           等しい要素は前のランが勝つため、マージ後も入力の順序を保つ
+template<typename T>
+bool ExternalSorter<T>::mergeRuns(const std::vector<std::string>& runs, std::ostream& output) const {
+    const size_t k = runs.size();
+    std::vector<std::unique_ptr<RunReader>> readers;
+
+    // 先頭データを次の行に進める
+    auto advance = [this](RunReader& reader) {
+        std::string line;
+        reader.valid = false;
+        while (std::getline(reader.file, line)) {
+            if (parse(line, reader.current)) {
+                reader.valid = true;
+                break;
+            }
+        }
+    };
+
+    for (const std::string& path : runs) {
+        readers.push_back(std::unique_ptr<RunReader>(new RunReader()));
+        readers.back()->file.open(path);
+        if (!readers.back()->file.is_open()) return false;
+        advance(*readers.back());
+    }
+
+    // ラン a の先頭がラン b の先頭に勝つかどうか (読み終えたランは常に負ける)
+    auto beats = [this, &readers](size_t a, size_t b) {
+        if (!readers[a]->valid) return false;
+        if (!readers[b]->valid) return true;
+        if (comp(readers[a]->current, readers[b]->current)) return true;
+        return !comp(readers[b]->current, readers[a]->current) && a < b;
+    };
+
+    // 内部ノード tree[1, k) に各試合の敗者、tree[0] に優勝者を持つ (葉 i は位置 k + i)
+    std::vector<size_t> tree(k, 0);
+    std::vector<size_t> winners(2 * k);
+    for (size_t i = 0; i < k; ++i) {
+        winners[k + i] = i;
+    }
+    for (size_t t = k - 1; t > 0; --t) {
+        size_t a = winners[2 * t];
+        size_t b = winners[2 * t + 1];
+        winners[t] = beats(a, b) ? a : b;
+        tree[t] = beats(a, b) ? b : a;
+    }
+    tree[0] = k > 1 ? winners[1] : 0;
+
+    while (readers[tree[0]]->valid) {
+        size_t winner = tree[0];
+        format(output, readers[winner]->current);
+        output << '\n';
+        advance(*readers[winner]);
+
+        // 葉から根まで、記録された敗者とだけ再試合する
+        for (size_t t = (winner + k) / 2; t > 0; t /= 2) {
+            if (beats(tree[t], winner)) {
+                std::swap(tree[t], winner);
+            }
+        }
+        tree[0] = winner;
+    }
+    return static_cast<bool>(output);
+}
+
+// 一時ファイルを削除する関数
+// 引数: const std::vector<std::string>& paths - ファイルパス (存在しないファイルは無視する)
+template<typename T>
+void ExternalSorter<T>::removeFiles(const std::vector<std::string>& paths) {
+    for (const std::string& path : paths) {
+        std::remove(path.c_str());
+    }
+}
+
+// 入力ストリームの全行をソートして出力する
+// 引数: std::istream& input - 入力ストリーム
+//       std::ostream& output - 出力ストリーム
+// 戻り値: ソートに成功した場合は true、比較関数が null の場合や一時ファイルを読み書きできない場合は false
+// 期待結果: 1 つ前のチャンクを別スレッドでソート・書き出ししている間に次のチャンクを読み込む
+//           ランがファンインより多い場合は、ファンインごとにまとめてマージする段を重ねる
+template<typename T>
+bool ExternalSorter<T>::Sort(std::istream& input, std::ostream& output) {
+    runCount = 0;
+    peakChunkBytes = 0;
+    if (comp == nullptr) return false;
+
+    std::vector<std::string> temporaries; // 作成した全ての一時ファイル
+    std::vector<std::string> runs;        // マージ待ちのラン
+    std::future<bool> pending;            // 書き出し中のラン
+    bool ok = true;
+
+    std::shared_ptr<DoublyLinkedList<T>> chunk = std::make_shared<DoublyLinkedList<T>>();
+    peakChunkBytes = readChunk(input, *chunk);
+    while (ok && chunk->Getsize() > 0) {
+        // 入力が 1 チャンクに収まった場合は一時ファイルを使わない
+        if (runs.empty() && input.peek() == std::char_traits<char>::eof()) {
+            ok = writeSorted(*chunk, output);
+            chunk.reset();
+            break;
+        }
+
+        std::string path = makeTempPath();
+        temporaries.push_back(path);
+        runs.push_back(path);
+
+        // メモリ上のチャンクを 2 つまでに抑えるため、前のランの書き出しを待ってから次を始める
+        if (pending.valid() && !pending.get()) {
+            ok = false;
+            break;
+        }
+        pending = std::async(std::launch::async, [this, chunk, path] {
+            std::ofstream file(path);
+            return file.is_open() && writeSorted(*chunk, file);
+        });
+
+        chunk = std::make_shared<DoublyLinkedList<T>>();
+        peakChunkBytes = std::max(peakChunkBytes, readChunk(input, *chunk));
+    }
+    if (pending.valid() && !pending.get()) {
+        ok = false;
+    }
+    runCount = runs.size();
+
+    while (ok && runs.size() > fanIn) {
+        std::vector<std::string> merged;
+        for (size_t i = 0; ok && i < runs.size(); i += fanIn) {
+            std::vector<std::string> group(runs.begin() + i, runs.begin() + std::min(i + fanIn, runs.size()));
+            std::string path = makeTempPath();
+            temporaries.push_back(path);
+            merged.push_back(path);
+
+            std::ofstream file(path);
+            ok = file.is_open() && mergeRuns(group, file);
+            file.close();
+            removeFiles(group);
+        }
+        runs = merged;
+    }
+    if (ok && !runs.empty()) {
+        ok = mergeRuns(runs, output);
+    }
+
+    removeFiles(temporaries);
+    return ok;
+}
+
+// 直前のソートで書き出したランの数を取得
+// 戻り値: ランの数 (入力が 1 チャンクに収まった場合は 0)
+template<typename T>
+size_t ExternalSorter<T>::GetRunCount() const {
+    return runCount;
+}
+
+// 直前のソートで読み込んだチャンクの最大見積もりサイズを取得
+// 戻り値: バイト数
+template<typename T>
+size_t ExternalSorter<T>::GetPeakChunkBytes() const {
+    return peakChunkBytes;
+}
@@ -0,0 +1,151 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+// テンプレートクラス NodePool
+// 同じ大きさのノード領域を 64 KiB のページから切り出して配るメモリプール
+// 解放された領域は空きリストで再利用するため、確保・解放はポインタの付け替えだけで済む
+// スレッドごとに (領域の大きさと境界ごとに) 1 つを持ち、プール上の領域が全て解放された時点で
+// 切り出し中のページ 1 枚を残してページをまとめて返す
+// 各領域の前に確保元のプールを記録し (malloc の管理領域と同程度の 1 ワード)、
+// 他のスレッドで解放された領域は確保元のプールの別のリストに積んで、確保元のスレッドが次に確保する時にまとめて回収する
+template<size_t Size, size_t Align>
+class NodePool {
+private:
+    // ノード領域
+    struct Slot {
+        NodePool* owner; // 確保元のプール
+        union {
+            Slot* next;  // 空いている間は次の空き領域
+            typename std::aligned_storage<Size, Align>::type storage;
+        };
+    };
+
+    // スレッドが終了した時にプールを手放すための保持クラス
+    struct LocalHolder {
+        NodePool* pool = nullptr; // 呼び出し元スレッドのプール
+        ~LocalHolder();
+    };
+
+    static const size_t PageSize = 64 * 1024; // ページの大きさ (バイト)
+
+    std::vector<Slot*> pages;        // 確保したページ (末尾が切り出し中のページ)
+    Slot* freeList;                  // 空き領域のリスト
+    Slot* cursor;                    // 切り出し中のページの未使用部分の先頭
+    Slot* limit;                     // 切り出し中のページの末尾
+    size_t live;                     // 使用中の領域数 (他のスレッドで解放されて未回収の領域を含む)
+    std::mutex remoteMutex;          // 以下の 3 つを保護するミューテックス
+    Slot* remoteList;                // 他のスレッドから解放された領域のリスト
+    size_t remoteCount;              // remoteList の領域数
+    bool orphaned;                   // 確保元のスレッドが終了した場合は true
+    std::atomic<bool> hasRemote;     // remoteList が空でない場合は true
+
+    // 呼び出し元スレッドのプールの保持クラスを取得する関数
+    // 戻り値: スレッドローカルな保持クラスの参照
+    static LocalHolder& holder();
+
+    // 呼び出し元スレッドのプールを取得する関数
+    // 戻り値: スレッドローカルなプール (初回の呼び出しで生成する)
+    static NodePool& local();
+
+    // コンストラクタ
+    // 期待結果: ページを持たない空のプールが生成される
+    NodePool();
+
+    // デストラクタ
+    // 期待結果: 全てのページが解放される
+    ~NodePool();
+
+    // 領域を切り出す関数
+    // 戻り値: 空きリストまたは切り出し中のページから取り出した領域
+    Slot* allocateSlot();
+
+    // 確保元のスレッドで領域を解放する関数
+    // 入力: 解放する領域 (Slot* slot)
+    // 期待結果: 領域が空きリストに戻る。全ての領域が解放された場合はページを返す
+    void freeLocal(Slot* slot);
+
+    // 他のスレッドで領域を解放する関数
+    // 入力: 解放する領域 (Slot* slot)
+    // 期待結果: 領域が remoteList に積まれる。確保元のスレッドが終了していて最後の領域だった場合はプールを破棄する
+    void freeRemote(Slot* slot);
+
+    // ページを追加する関数
+    // 期待結果: 新しいページが切り出し中のページになる
+    void addPage();
+
+    // 他のスレッドから解放された領域を回収する関数
+    // 期待結果: remoteList の領域が空きリストに移り、使用中の領域数が減る
+    void collectRemote();
+
+    // 全ての領域が解放されたプールのページを返す関数
+    // 期待結果: 切り出し中のページ以外のページが解放され、切り出し中のページは先頭から使い直す
+    void releasePages();
+
+    // 確保元のスレッドの終了時にプールを手放す関数
+    // 期待結果: 使用中の領域がなければプールを破棄し、残っていれば最後の領域の解放時に破棄する
+    void abandon();
+
+public:
+    static const size_t SlotsPerPage = PageSize / sizeof(Slot); // 1 ページあたりの領域数
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    // 領域を確保する関数
+    // 戻り値: 呼び出し元スレッドのプールから確保した Size バイト・Align 境界の未初期化の領域
+    static void* Allocate();
+
+    // 領域を解放する関数
+    // 入力: Allocate で確保した領域 (void* memory、どのスレッドで確保したものでもよい)
+    // 期待結果: 領域が確保元のプールに戻る
+    static void Deallocate(void* memory);
+
+    // 呼び出し元スレッドのプールが確保しているページ数を取得する関数
+    // 戻り値: ページ数
+    static size_t GetPageCount();
+
+    // 呼び出し元スレッドのプールの使用中の領域数を取得する関数
+    // 戻り値: 使用中の領域数
+    static size_t GetLiveCount();
+};
+
+// テンプレートクラス PoolAllocator
+// NodePool から 1 要素ずつの領域を確保するアロケータ (複数要素の確保は operator new に任せる)
+// 状態を持たず、どのインスタンスで確保した領域もどのインスタンスでも解放できる
+template<typename T>
+class PoolAllocator {
+public:
+    typedef T value_type;
+    typedef NodePool<sizeof(T), alignof(T)> Pool;
+
+    static_assert(alignof(T) <= alignof(std::max_align_t), "PoolAllocator does not support over-aligned types");
+
+    // コンストラクタ
+    PoolAllocator() {}
+
+    // 別の型のアロケータからのコンストラクタ
+    template<typename U>
+    PoolAllocator(const PoolAllocator<U>&) {}
+
+    // 領域を確保する関数
+    // 入力: 要素数 (size_t count)
+    // 戻り値: count 要素分の未初期化の領域
+    T* allocate(size_t count);
+
+    // 領域を解放する関数
+    // 入力: allocate で確保した領域 (T* memory), 要素数 (size_t count)
+    // 期待結果: 領域が確保元に返される
+    void deallocate(T* memory, size_t count);
+};
+
+// アロケータの等価比較 (状態を持たないため常に等しい)
+template<typename T, typename U>
+bool operator==(const PoolAllocator<T>&, const PoolAllocator<U>&) { return true; }
+template<typename T, typename U>
+bool operator!=(const PoolAllocator<T>&, const PoolAllocator<U>&) { return false; }
+
+#include "NodePool.inl"
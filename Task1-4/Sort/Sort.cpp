@@ -40,16 +40,18 @@ inline bool SD(const PerformanceData& a, const PerformanceData& b) {
     return a.first > b.first;
 }
 
-// 昇順で名前を比較する関数
-// 入力: PerformanceData 型の a と b
-inline bool NameA(const PerformanceData& a, const PerformanceData& b) {
-    return a.second < b.second;
+// スコアをソートキーとして取り出す関数
+// 入力: PerformanceData 型の a
+// 戻り値: a のスコア
+inline long long Score(const PerformanceData& a) {
+    return a.first;
 }
 
-// 降順で名前を比較する関数
-// 入力: PerformanceData 型の a と b
-inline bool NameD(const PerformanceData& a, const PerformanceData& b) {
-    return a.second > b.second;
+// 名前をソートキーとして取り出す関数
+// 入力: PerformanceData 型の a
+// 戻り値: a のユーザー名への参照
+inline const std::string& UserName(const PerformanceData& a) {
+    return a.second;
 }
 
 // リストの内容を表示する関数
@@ -78,14 +80,19 @@ int main(int argc, char** argv) {
     std::cout << "Score After Sort (Descend)" << std::endl;
     DisplayList(list);
 
-    list.Sort(NameA);
+    list.StringSort(UserName);
     std::cout << "Username After Sort (Ascend)" << std::endl;
     DisplayList(list);
 
-    list.Sort(NameD);
+    list.StringSort(UserName, true);
     std::cout << "Username After Sort (Descend)" << std::endl;
     DisplayList(list);
 
+    list.SortBy({ SortKey<PerformanceData>::Integer(Score, SortOrder::Descending),
+                  SortKey<PerformanceData>::String(UserName, SortOrder::Ascending) });
+    std::cout << "Score (Descend) Then Username (Ascend)" << std::endl;
+    DisplayList(list);
+
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
 }
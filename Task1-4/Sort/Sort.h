@@ -1,9 +1,62 @@
 #pragma once
+#include <cstdint>
 #include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Arena.h"
+#include "NodePool.h"
+#include "TaskPool.h"
+
+// ソートの実行方式
+enum class ExecutionPolicy {
+    Sequential, // 呼び出し元スレッドだけでソートする
+    Parallel    // タスクプールで並列にソートする
+};
+
+// ソート順
+enum class SortOrder {
+    Ascending, // 昇順
+    Descending // 降順
+};
+
+// テンプレートクラス SortKey
+// 複合ソートの 1 列分のキー
+// データから取り出した値を、バイト列として比較 (memcmp 順) するだけで大小が決まる正規化キーに変換する
+template<typename T>
+class SortKey {
+private:
+    std::function<long long(const T&)> integerKey;          // 整数キーを取り出す関数
+    std::function<const std::string&(const T&)> stringKey; // 文字列キーを取り出す関数
+    SortOrder order;                                        // ソート順
+
+    // コンストラクタ
+    // 入力: 整数キーを取り出す関数, 文字列キーを取り出す関数 (どちらか一方だけを指定する), ソート順
+    // 期待結果: キーが生成される
+    SortKey(std::function<long long(const T&)> integerKey, std::function<const std::string&(const T&)> stringKey, SortOrder order);
+
+public:
+    // 整数キーを生成する関数
+    // 入力: キーを取り出す関数 (std::function<long long(const T&)> key), ソート順 (SortOrder order)
+    // 戻り値: 符号ビットを反転した 8 バイトのビッグエンディアンで比較されるキー
+    static SortKey Integer(std::function<long long(const T&)> key, SortOrder order = SortOrder::Ascending);
+
+    // 文字列キーを生成する関数
+    // 入力: キーを取り出す関数 (std::function<const std::string&(const T&)> key), ソート順 (SortOrder order)
+    // 戻り値: 0x00 を 0x00 0xFF に置き換え、0x00 0x00 で終端して比較されるキー
+    static SortKey String(std::function<const std::string&(const T&)> key, SortOrder order = SortOrder::Ascending);
+
+    // 正規化キーを追記する関数
+    // 入力: データ (const T& data), 追記先 (std::string& out)
+    // 期待結果: この列の正規化キーが out の末尾に追加される (降順の場合は全バイトを反転する)
+    void AppendTo(const T& data, std::string& out) const;
+};
 
 // テンプレートクラス DoublyLinkedList
 // ダブルリンクリストの実装
-template<typename T>
+// ノードは Allocator から確保する (既定では NodePool のページから切り出し、挿入・削除ごとの new / delete を避ける)
+// 一括で作って一括で捨てるリストは ArenaAllocator を指定すると、破棄がノード数ではなくページ数に比例する
+template<typename T, typename Allocator = PoolAllocator<T>>
 class DoublyLinkedList {
 private:
     // ノードの定義
@@ -22,22 +75,132 @@ private:
     Node* tail; // リストの末尾ノード
     int size;   // リストのサイズ
 
+    typedef typename std::allocator_traits<Allocator>::template rebind_alloc<Node> NodeAllocator;
+    typedef std::allocator_traits<NodeAllocator> NodeTraits;
+
+    NodeAllocator allocator; // ノードを確保するアロケータ
+
+    // ノードを生成する関数
+    // 入力: ノードに格納するデータ (const T& data)
+    // 戻り値: アロケータから確保して初期化したノード
+    Node* createNode(const T& data);
+
+    // ノードを破棄する関数
+    // 入力: 破棄するノード (Node* node)
+    // 期待結果: データが破棄され、領域がアロケータに返される
+    void destroyNode(Node* node);
+
     // クイックソートを実行する関数
     // 入力: 左端のノード (Node* left), 右端のノード (Node* right), 比較関数 (const std::function<bool(const T&, const T&)>& comp)
     // 期待結果: リストがソートされる
     void quickSort(Node* left, Node* right, const std::function<bool(const T&, const T&)>& comp);
 
+    // 3 分割パーティションの結果
+    struct PartitionResult {
+        Node* equalFirst; // ピボットと等しい範囲の先頭ノード
+        Node* equalLast;  // ピボットと等しい範囲の末尾ノード
+        int lessCount;    // ピボットより前に並ぶ要素数
+        int greaterCount; // ピボットより後に並ぶ要素数
+    };
+
     // パーティションを実行する関数
     // 入力: 左端のノード (Node* left), 右端のノード (Node* right), 比較関数 (const std::function<bool(const T&, const T&)>& comp)
-    // 期待結果: ピボットを基準に要素が分割される
-    // 戻り値: ピボットの位置のノード
-    Node* partition(Node* left, Node* right, const std::function<bool(const T&, const T&)>& comp);
+    // 期待結果: 範囲から取った 9 か所の中央値の中央値 (短い範囲では両端と中央の中央値) をピボットとして、ピボットより前・等しい・後の 3 つの範囲に要素が分割される
+    // 戻り値: ピボットと等しい範囲と、前後の範囲の要素数
+    PartitionResult partition(Node* left, Node* right, const std::function<bool(const T&, const T&)>& comp);
 
     // データを交換する関数
     // 入力: データ1 (T& data1), データ2 (T& data2)
     // 期待結果: データ1とデータ2が交換される
     void swap(T& data1, T& data2);
 
+    // 文字列ソート用のエントリ
+    // キーの一部 (8 バイト) を整数として保持し、比較時に文字列本体を参照しないようにする
+    struct StringKeyEntry {
+        uint64_t prefix; // 現在の深さから 8 バイト分のキーをビッグエンディアンで詰めた値
+        int index;       // ソート前のリスト上の位置
+    };
+
+    // リストの全ノードを先頭から順に取得する関数
+    // 期待結果: 先頭から末尾までのノードが順に格納された配列が返される
+    std::vector<Node*> collectNodes() const;
+
+    // 並び順に従ってノードのデータを並べ替える関数
+    // 入力: 先頭から順のノード配列 (const std::vector<Node*>& nodes), 並び順 (std::vector<int>& order)
+    //       order[i] は i 番目の位置に置くデータの元の位置
+    // 期待結果: ノードのつながりは変えずに、データが order の順に並ぶ (order は破壊される)
+    void applyOrder(const std::vector<Node*>& nodes, std::vector<int>& order);
+
+    // 文字列キーの並び順を求める関数
+    // 入力: 各位置のキー (const std::vector<const std::string*>& keys)
+    // 戻り値: キーの昇順に並べた元の位置の配列
+    static std::vector<int> stringSortOrder(const std::vector<const std::string*>& keys);
+
+    // キーの指定位置から 8 バイトを整数に詰める関数
+    // 入力: キー (const std::string& key), 開始位置 (size_t depth)
+    // 戻り値: 8 バイトをビッグエンディアンで詰めた値 (キーの末尾以降は 0 で埋める)
+    static uint64_t packPrefix(const std::string& key, size_t depth);
+
+    // マルチキー・クイックソートを実行する関数
+    // 入力: エントリ配列 (std::vector<StringKeyEntry>& entries), 範囲 [lo, hi) (int lo, int hi),
+    //       比較済みの深さ (size_t depth), 各位置のキー (const std::vector<const std::string*>& keys)
+    // 期待結果: 範囲内のエントリがキーの昇順に並ぶ
+    static void multikeyQuickSort(std::vector<StringKeyEntry>& entries, int lo, int hi, size_t depth, const std::vector<const std::string*>& keys);
+
+    // リストがほぼ整列済みかどうかを調べる関数
+    // 入力: 比較関数 (const std::function<bool(const T&, const T&)>& comp)
+    // 戻り値: 昇順または降順 (等しい要素を含む) のランの平均の長さが 32 以上の場合は true
+    bool isNearlySorted(const std::function<bool(const T&, const T&)>& comp) const;
+
+    // 位置の配列を適応型マージソート (TimSort 方式) で安定にソートする関数
+    // 入力: 先頭から順のノード配列 (const std::vector<Node*>& nodes), 位置の配列 (int* order), 作業領域 (int* buffer),
+    //       要素数 (int count), 比較関数 (const std::function<bool(const T&, const T&)>& comp)
+    // 期待結果: order[0, count) が指すデータの順に安定に並ぶ (buffer は count 要素以上必要)
+    //           既に並んでいるランをそのまま使うため、ほぼ整列済みの入力は線形に近い時間で終わる
+    static void adaptiveSortOrder(const std::vector<Node*>& nodes, int* order, int* buffer, int count, const std::function<bool(const T&, const T&)>& comp);
+
+    // 先頭のランの長さを求める関数
+    // 入力: 先頭から順のノード配列, 位置の配列 (int* order), 要素数 (int count), 比較関数
+    // 戻り値: 先頭から続く昇順または狭義の降順のランの長さ (降順のランは反転して昇順にする)
+    static int countRun(const std::vector<Node*>& nodes, int* order, int count, const std::function<bool(const T&, const T&)>& comp);
+
+    // 二分挿入ソートを実行する関数
+    // 入力: 先頭から順のノード配列, 位置の配列 (int* order), ソート済みの要素数 (int sorted), 要素数 (int count), 比較関数
+    // 期待結果: order[0, count) が安定に並ぶ
+    static void binaryInsertionSort(const std::vector<Node*>& nodes, int* order, int sorted, int count, const std::function<bool(const T&, const T&)>& comp);
+
+    // 隣り合う 2 つのランをマージする関数
+    // 入力: 先頭から順のノード配列, 1 つ目のランの先頭 (int* first), 各ランの長さ (int length1, int length2),
+    //       作業領域 (int* buffer), ギャロッピングに切り替える連続回数 (int& minGallop), 比較関数
+    // 期待結果: 2 つのランが安定にマージされる
+    //           一方のランが minGallop 回続けて選ばれると、指数探索でまとめて移動するギャロッピングに切り替える
+    static void mergeRuns(const std::vector<Node*>& nodes, int* first, int length1, int length2, int* buffer, int& minGallop, const std::function<bool(const T&, const T&)>& comp);
+
+    // ギャロッピング (指数探索 + 二分探索) で境界を探す関数
+    // 入力: 位置の配列 (const int* base), 要素数 (int count), 末尾から探す場合は true (bool fromEnd),
+    //       前半の条件 (Predicate before、前半で true・後半で false になること)
+    // 戻り値: before が true になる要素の数
+    template<typename Predicate>
+    static int gallop(const int* base, int count, bool fromEnd, Predicate before);
+
+    // ソート済みの位置の配列 2 つを安定にマージする関数
+    // 入力: 先頭から順のノード配列 (const std::vector<Node*>& nodes), 1 つ目の範囲 [first1, last1), 2 つ目の範囲 [first2, last2),
+    //       出力先 (int* out), 比較関数 (const std::function<bool(const T&, const T&)>& comp)
+    // 期待結果: 2 つの範囲がマージされて out に書き込まれる (等しい場合は 1 つ目の範囲が先)
+    static void mergeOrder(const std::vector<Node*>& nodes, const int* first1, const int* last1, const int* first2, const int* last2, int* out, const std::function<bool(const T&, const T&)>& comp);
+
+    // ソート済みの位置の配列 2 つを並列にマージする関数
+    // 入力: タスクプール (TaskPool& pool), その他は mergeOrder と同じ
+    // 期待結果: 大きい方の範囲の中央の要素の行き先を二分探索で求め、左右を別々のタスクでマージする
+    static void parallelMergeOrder(TaskPool& pool, const std::vector<Node*>& nodes, const int* first1, const int* last1, const int* first2, const int* last2, int* out, const std::function<bool(const T&, const T&)>& comp);
+
+    // 比較順で先頭から k 個の要素の位置を求める関数
+    // 入力: 先頭から順のノード配列 (const std::vector<Node*>& nodes), 求める個数 (int k),
+    //       比較関数 (const std::function<bool(const T&, const T&)>& comp)
+    // 戻り値: 先頭から k 個の要素の位置を比較順に並べた配列 (k 個の有界ヒープで O(n log k))
+    //         等しい要素はリスト上で前にある方を先とする
+    static std::vector<int> selectFirst(const std::vector<Node*>& nodes, int k, const std::function<bool(const T&, const T&)>& comp);
+
 public:
     // 定数イテレータクラス
     class ConstIterator {
@@ -124,8 +287,9 @@ public:
     };
 
     // コンストラクタ
+    // 入力: ノードの確保に使うアロケータ (const Allocator&、省略時は既定のアロケータ)
     // 期待結果: 空のダブルリンクリストが生成される
-    DoublyLinkedList();
+    explicit DoublyLinkedList(const Allocator& allocator = Allocator());
 
     // リストのサイズを取得
     // 期待結果: リストのサイズが返される
@@ -141,6 +305,23 @@ public:
     // 戻り値: 削除が成功した場合は true、失敗した場合は false
     bool Delete(const Iterator& iter);
 
+    // 別のリストの範囲を移動
+    // 入力: 挿入位置のイテレータ (const Iterator& pos), 移動元のリスト (DoublyLinkedList& other),
+    //       移動する範囲 [first, last) のイテレータ (const Iterator& first, const Iterator& last)
+    // 戻り値: 移動が成功した場合は true、イテレータが所属するリストと一致しない場合や pos が範囲内にある場合、
+    //         アロケータが等しくない場合は false
+    // 期待結果: 範囲のノードがつなぎ替えだけで pos の前に移動する (確保・解放・データのコピーは行わない)
+    //           other と this が同じリストでもよい。移動したノードを指すイテレータは取得し直すこと
+    bool Splice(const Iterator& pos, DoublyLinkedList& other, const Iterator& first, const Iterator& last);
+
+    // ソート済みのリストをマージ
+    // 入力: 比較関数の順にソート済みの移動元のリスト (DoublyLinkedList&& other),
+    //       比較関数 (const std::function<bool(const T&, const T&)>& comp)
+    // 戻り値: マージが成功した場合は true、比較関数が null の場合や other が自分自身の場合、アロケータが等しくない場合は false
+    // 期待結果: 両方のノードがつなぎ替えだけで 1 本のソート済みリストになり、other は空になる (O(n + m))
+    //           等しい要素は this の要素が先に並ぶ
+    bool Merge(DoublyLinkedList&& other, const std::function<bool(const T&, const T&)>& comp);
+
     // リストの先頭を指すイテレータを取得
     // 期待結果: 先頭ノードを指すイテレータが返される
     Iterator begin();
@@ -160,10 +341,61 @@ public:
     // リストをソートする関数
     // 入力: const std::function<bool(const T&, const T&)>& comp - 比較関数
     // 期待結果: リストがソートされる
+    //           ほぼ整列済みのリストは適応型マージソート (安定) で、それ以外はクイックソートでソートする
     void Sort(const std::function<bool(const T&, const T&)>& comp);
 
+    // 実行方式を指定してリストを安定ソートする関数
+    // 入力: const std::function<bool(const T&, const T&)>& comp - 比較関数
+    //       ExecutionPolicy policy - 実行方式
+    //       unsigned threadCount - Parallel の場合に使うスレッド数 (0 の場合はハードウェアのスレッド数)
+    // 期待結果: リストが安定にソートされる (Sequential と Parallel の結果は常に一致する)
+    //           Sequential では適応型マージソートでソートする
+    //           Parallel ではリストをスレッド数の数倍の区間に分けて並列にソートし、並列マージで 1 つにまとめる
+    void Sort(const std::function<bool(const T&, const T&)>& comp, ExecutionPolicy policy, unsigned threadCount = 0);
+
+    // リストの先頭 k 個だけをソートする関数
+    // 入力: int k - ソートする個数
+    //       const std::function<bool(const T&, const T&)>& comp - 比較関数
+    // 期待結果: 先頭 k 個の位置に、リスト全体をソートした場合の先頭 k 個が順に並ぶ (O(n log k))
+    //           残りの要素は元の相対順序のまま後ろに続く
+    void PartialSort(int k, const std::function<bool(const T&, const T&)>& comp);
+
+    // 比較順で先頭から k 個の要素を取得する関数
+    // 入力: int k - 取得する個数
+    //       const std::function<bool(const T&, const T&)>& comp - 比較関数
+    // 戻り値: リスト全体をソートした場合の先頭 k 個のコピー (O(n log k)、リストは変更されない)
+    std::vector<T> TopK(int k, const std::function<bool(const T&, const T&)>& comp) const;
+
+    // 複数の列でリストをソートする関数
+    // 入力: const std::vector<SortKey<T>>& keys - 優先度の高い順に並べた列のキー
+    // 期待結果: 各ノードの正規化キーを 1 回だけ作り、キーのバイト列の順にリストがソートされる
+    //           全ての列が等しい要素は元の順序を保つ
+    void SortBy(const std::vector<SortKey<T>>& keys);
+
+    // 射影したキーでリストをソートする関数 (シュワルツ変換)
+    // 入力: Projection projection - データからキーを取り出す関数 (const T& を受け取り、キーを値で返す)
+    //       Compare compare - キーの比較関数 (省略時は operator<)
+    // 期待結果: 各ノードのキーを 1 回だけ計算して配列に保持し、キーの順にリストが安定にソートされる
+    //           キーの計算が重い場合 (正規化した名前など) も、計算回数は O(n log n) ではなく n 回で済む
+    template<typename Projection, typename Compare = std::less<>>
+    void SortBy(Projection projection, Compare compare = Compare());
+
+    // 文字列キーでリストをソートする関数
+    // キーの先頭 8 バイトを整数として保持し、マルチキー・クイックソートで並べ替える
+    // 入力: const std::function<const std::string&(const T&)>& key - キーを取り出す関数 (データ内の文字列への参照を返すこと)
+    //       bool descending - 降順にする場合は true
+    // 期待結果: リストがキーの辞書順 (std::string の operator< と同じ順序) にソートされる
+    void StringSort(const std::function<const std::string&(const T&)>& key, bool descending = false);
+
+    // リストの全ノードを削除する関数
+    // 期待結果: リストが空になり、全ノードが解放される
+    //           ArenaAllocator でデータのデストラクタを省略できる場合は、ノードをたどらずに O(1) で空にする
+    //           (領域はアリーナごと解放されるまで再利用されない)
+    void Clear();
+
     // デストラクタ
     // 期待結果: リストの全ノードが解放される
+    //           ArenaAllocator の場合、最後のリストの破棄でアリーナのページがまとめて解放される
     ~DoublyLinkedList();
 };
 
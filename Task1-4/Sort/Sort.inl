@@ -1,23 +1,91 @@
+#include <algorithm>
 #include <cassert>
+#include <type_traits>
 #include <utility>
 
+// SortKey のコンストラクタ
+// 引数: 整数キーを取り出す関数, 文字列キーを取り出す関数 (どちらか一方だけを指定する), ソート順
+// 期待結果: キーが生成される
+template<typename T>
+SortKey<T>::SortKey(std::function<long long(const T&)> integerKey, std::function<const std::string&(const T&)> stringKey, SortOrder order)
+    : integerKey(std::move(integerKey)), stringKey(std::move(stringKey)), order(order) {}
+
+// 整数キーを生成する関数
+// 引数: std::function<long long(const T&)> key - キーを取り出す関数
+//       SortOrder order - ソート順
+// 戻り値: 整数キー
+template<typename T>
+SortKey<T> SortKey<T>::Integer(std::function<long long(const T&)> key, SortOrder order) {
+    return SortKey(std::move(key), nullptr, order);
+}
+
+// 文字列キーを生成する関数
+// 引数: std::function<const std::string&(const T&)> key - キーを取り出す関数
+//       SortOrder order - ソート順
+// 戻り値: 文字列キー
+template<typename T>
+SortKey<T> SortKey<T>::String(std::function<const std::string&(const T&)> key, SortOrder order) {
+    return SortKey(nullptr, std::move(key), order);
+}
+
+// 正規化キーを追記する関数
+// 引数: const T& data - データ
+//       std::string& out - 追記先
+// 期待結果: この列の正規化キーが out の末尾に追加される
+//           どちらの形式も他の値の接頭辞にならないため、列を連結しても列ごとの比較と同じ順序になる
+template<typename T>
+void SortKey<T>::AppendTo(const T& data, std::string& out) const {
+    size_t start = out.size();
+
+    if (integerKey) {
+        // 符号ビットを反転すると、符号なしのビッグエンディアンで比較できる
+        uint64_t value = static_cast<uint64_t>(integerKey(data)) ^ (uint64_t(1) << 63);
+        for (int shift = 56; shift >= 0; shift -= 8) {
+            out += static_cast<char>((value >> shift) & 0xFF);
+        }
+    }
+    else if (stringKey) {
+        for (char c : stringKey(data)) {
+            out += c;
+            if (c == '\0') {
+                out += static_cast<char>(0xFF);
+            }
+        }
+        out += '\0';
+        out += '\0';
+    }
+
+    if (order == SortOrder::Descending) {
+        for (size_t i = start; i < out.size(); ++i) {
+            out[i] = static_cast<char>(~static_cast<unsigned char>(out[i]));
+        }
+    }
+}
+
 // ノードのコンストラクタ
 // 引数: const T& rd - ノードのデータ
 // 期待結果: ノードが初期化される
-template<typename T>
-DoublyLinkedList<T>::Node::Node(const T& rd) : data(rd), prev(nullptr), next(nullptr) {}
+template<typename T, typename Allocator>
+DoublyLinkedList<T, Allocator>::Node::Node(const T& rd) : data(rd), prev(nullptr), next(nullptr) {}
 
 // クイックソートを実行する関数
 // 引数: Node* left - 左端のノード
 //       Node* right - 右端のノード
 //       const std::function<bool(const T&, const T&)>& comp - 比較関数
 // 期待結果: リストがソートされる
-template<typename T>
-void DoublyLinkedList<T>::quickSort(Node* left, Node* right, const std::function<bool(const T&, const T&)>& comp) {
-    if (right != nullptr && left != right && left != right->next) {
-        Node* pivot = partition(left, right, comp);
-        quickSort(left, pivot->prev, comp);
-        quickSort(pivot->next, right, comp);
+//           ピボットと等しい要素は再帰の対象から外し、小さい側だけを再帰して大きい側はループで処理する
+template<typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::quickSort(Node* left, Node* right, const std::function<bool(const T&, const T&)>& comp) {
+    while (right != nullptr && left != right && left != right->next) {
+        PartitionResult result = partition(left, right, comp);
+        if (result.lessCount < result.greaterCount) {
+            quickSort(left, result.equalFirst->prev, comp);
+            left = result.equalLast->next;
+        }
+        else {
+            quickSort(result.equalLast->next, right, comp);
+            right = result.equalFirst->prev;
+        }
     }
 }
 
@@ -25,22 +93,84 @@ void DoublyLinkedList<T>::quickSort(Node* left, Node* right, const std::function
 // 引数: Node* left - 左端のノード
 //       Node* right - 右端のノード
 //       const std::function<bool(const T&, const T&)>& comp - 比較関数
-// 期待結果: ピボットを基準に要素が分割される
-// 戻り値: ピボットの位置のノード
-template<typename T>
-typename DoublyLinkedList<T>::Node* DoublyLinkedList<T>::partition(Node* left, Node* right, const std::function<bool(const T&, const T&)>& comp) {
+// 期待結果: 範囲を 8 等分する 9 か所の中央値の中央値 (ninther、40 要素未満では両端と中央の中央値) をピボットとして、
+//           前・等しい・後の 3 つの範囲に要素が分割される (オランダ国旗問題)
+//           入力がランダムな順序であることを仮定しないため、整列済み・逆順やそれに近い範囲でも偏った分割にならない
+//           (両端と中央の 3 か所だけでは、分割時の入れ替えで崩れた逆順の範囲で偏り、O(n^1.5) 程度の比較回数になる)
+//           同じキーが多い入力でも、等しい要素は 1 回の走査で確定する
+// 戻り値: ピボットと等しい範囲と、前後の範囲の要素数
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::PartitionResult DoublyLinkedList<T, Allocator>::partition(Node* left, Node* right, const std::function<bool(const T&, const T&)>& comp) {
+    // 3 つのノードのうち中央値を持つノードを返す (c と等しい場合は c を返す)
+    auto medianOf3 = [&comp](Node* a, Node* b, Node* c) {
+        if (comp(c->data, a->data) && comp(c->data, b->data)) {
+            return comp(b->data, a->data) ? b : a;
+        }
+        if (comp(a->data, c->data) && comp(b->data, c->data)) {
+            return comp(a->data, b->data) ? b : a;
+        }
+        return c;
+    };
+
+    int length = 1;
+    for (Node* node = left; node != right; node = node->next) {
+        ++length;
+    }
+
+    // 範囲を 8 等分する 9 か所 (短い範囲では両端と中央の 3 か所) を取り出す
+    const int sampleCount = length >= 40 ? 9 : 3;
+    Node* samples[9];
+    int step = (length - 1) / (sampleCount - 1);
+    Node* node = left;
+    for (int k = 0; k < sampleCount - 1; ++k) {
+        samples[k] = node;
+        for (int j = 0; j < step; ++j) {
+            node = node->next;
+        }
+    }
+    samples[sampleCount - 1] = right;
+
+    // 3 か所の中央値、または 3 組の中央値の中央値 (ninther) を右端に移し、右端をピボットとして使う
+    Node* median = sampleCount == 9
+        ? medianOf3(medianOf3(samples[0], samples[1], samples[2]), medianOf3(samples[3], samples[4], samples[5]), medianOf3(samples[6], samples[7], samples[8]))
+        : medianOf3(samples[0], samples[1], samples[2]);
+    if (median != right) {
+        swap(median->data, right->data);
+    }
+
     T pivot = right->data;
-    Node* i = left->prev;
+    PartitionResult result = { nullptr, nullptr, 0, 0 };
 
-    for (Node* j = left; j != right; j = j->next) {
-        if (comp(j->data, pivot) || (!comp(pivot, j->data) && !comp(j->data, pivot))) {
-            i = (i == nullptr) ? left : i->next;
-            swap(i->data, j->data);
+    // [left, lt) は前、[lt, i) は等しい、[i, gt] は未分類、[greater, right) は後の範囲
+    Node* lt = left;
+    Node* i = left;
+    Node* gt = right->prev;
+    Node* greater = right;
+    bool done = false;
+    while (!done) {
+        done = i == gt;
+        if (comp(i->data, pivot)) {
+            swap(lt->data, i->data);
+            lt = lt->next;
+            i = i->next;
+            ++result.lessCount;
+        }
+        else if (comp(pivot, i->data)) {
+            swap(i->data, gt->data);
+            greater = gt;
+            gt = gt->prev;
+            ++result.greaterCount;
+        }
+        else {
+            i = i->next;
         }
     }
-    i = (i == nullptr) ? left : i->next;
-    swap(i->data, right->data);
-    return i;
+
+    // ピボットを後の範囲の先頭と入れ替え、等しい範囲の末尾に置く
+    swap(greater->data, right->data);
+    result.equalFirst = lt;
+    result.equalLast = greater;
+    return result;
 }
 
 
@@ -49,31 +179,620 @@ typename DoublyLinkedList<T>::Node* DoublyLinkedList<T>::partition(Node* left, N
 // 引数: T& data1 - データ1
 //       T& data2 - データ2
 // 期待結果: データ1とデータ2が交換される
-template<typename T>
-void DoublyLinkedList<T>::swap(T& data1, T& data2) {
+template<typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::swap(T& data1, T& data2) {
     T temp = std::move(data1);
     data1 = std::move(data2);
     data2 = std::move(temp);
 }
 
+// リストの全ノードを先頭から順に取得する関数
+// 期待結果: 先頭から末尾までのノードが順に格納された配列が返される
+template<typename T, typename Allocator>
+std::vector<typename DoublyLinkedList<T, Allocator>::Node*> DoublyLinkedList<T, Allocator>::collectNodes() const {
+    std::vector<Node*> nodes;
+    nodes.reserve(size);
+    for (Node* node = head; node != nullptr; node = node->next) {
+        nodes.push_back(node);
+    }
+    return nodes;
+}
+
+// 並び順に従ってノードのデータを並べ替える関数
+// 引数: const std::vector<Node*>& nodes - 先頭から順のノード配列
+//       std::vector<int>& order - i 番目の位置に置くデータの元の位置
+// 期待結果: ノードのつながりは変えずに、データが order の順に並ぶ
+//           置換を巡回ごとにたどるため、データの移動は要素数 + 巡回数回で済む
+template<typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::applyOrder(const std::vector<Node*>& nodes, std::vector<int>& order) {
+    const int count = static_cast<int>(order.size());
+    for (int start = 0; start < count; ++start) {
+        if (order[start] == start) continue;
+
+        T temp = std::move(nodes[start]->data);
+        int current = start;
+        while (order[current] != start) {
+            int source = order[current];
+            nodes[current]->data = std::move(nodes[source]->data);
+            order[current] = current;
+            current = source;
+        }
+        nodes[current]->data = std::move(temp);
+        order[current] = current;
+    }
+}
+
+// 文字列キーの並び順を求める関数
+// 引数: const std::vector<const std::string*>& keys - 各位置のキー
+// 戻り値: キーの昇順に並べた元の位置の配列
+template<typename T, typename Allocator>
+std::vector<int> DoublyLinkedList<T, Allocator>::stringSortOrder(const std::vector<const std::string*>& keys) {
+    const int count = static_cast<int>(keys.size());
+    std::vector<StringKeyEntry> entries(count);
+    for (int i = 0; i < count; ++i) {
+        entries[i].prefix = packPrefix(*keys[i], 0);
+        entries[i].index = i;
+    }
+
+    multikeyQuickSort(entries, 0, count, 0, keys);
+
+    std::vector<int> order(count);
+    for (int i = 0; i < count; ++i) {
+        order[i] = entries[i].index;
+    }
+    return order;
+}
+
+// キーの指定位置から 8 バイトを整数に詰める関数
+// 引数: const std::string& key - キー
+//       size_t depth - 開始位置
+// 戻り値: 8 バイトをビッグエンディアンで詰めた値 (キーの末尾以降は 0 で埋める)
+//         整数としての大小がバイト列の辞書順と一致する
+template<typename T, typename Allocator>
+uint64_t DoublyLinkedList<T, Allocator>::packPrefix(const std::string& key, size_t depth) {
+    uint64_t prefix = 0;
+    for (size_t i = 0; i < 8; ++i) {
+        prefix <<= 8;
+        if (depth + i < key.size()) {
+            prefix |= static_cast<unsigned char>(key[depth + i]);
+        }
+    }
+    return prefix;
+}
+
+// マルチキー・クイックソートを実行する関数
+// 引数: std::vector<StringKeyEntry>& entries - エントリ配列
+//       int lo, int hi - ソートする範囲 [lo, hi)
+//       size_t depth - 範囲内のキーが一致していることが分かっている先頭からのバイト数
+//       const std::vector<const std::string*>& keys - 各位置のキー
+// 期待結果: 範囲内のエントリがキーの昇順に並ぶ
+//           比較はキャッシュした 8 バイトの整数だけで行い、等しい範囲だけ次の 8 バイトを読み直す
+template<typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::multikeyQuickSort(std::vector<StringKeyEntry>& entries, int lo, int hi, size_t depth, const std::vector<const std::string*>& keys) {
+    while (hi - lo > 1) {
+        // 小さな範囲は挿入ソートで仕上げる
+        if (hi - lo <= 16) {
+            for (int i = lo + 1; i < hi; ++i) {
+                StringKeyEntry entry = entries[i];
+                int j = i;
+                while (j > lo && (entry.prefix < entries[j - 1].prefix ||
+                    (entry.prefix == entries[j - 1].prefix && *keys[entry.index] < *keys[entries[j - 1].index]))) {
+                    entries[j] = entries[j - 1];
+                    --j;
+                }
+                entries[j] = entry;
+            }
+            return;
+        }
+
+        // 3 点の中央値をピボットにする
+        uint64_t a = entries[lo].prefix;
+        uint64_t b = entries[lo + (hi - lo) / 2].prefix;
+        uint64_t c = entries[hi - 1].prefix;
+        uint64_t pivot = std::max(std::min(a, b), std::min(std::max(a, b), c));
+
+        // ピボットより小さい・等しい・大きいの 3 つに分割する
+        int lt = lo;
+        int i = lo;
+        int gt = hi;
+        while (i < gt) {
+            if (entries[i].prefix < pivot) {
+                std::swap(entries[lt++], entries[i++]);
+            }
+            else if (entries[i].prefix > pivot) {
+                std::swap(entries[i], entries[--gt]);
+            }
+            else {
+                ++i;
+            }
+        }
+
+        multikeyQuickSort(entries, lo, lt, depth, keys);
+        multikeyQuickSort(entries, gt, hi, depth, keys);
+
+        // 等しい範囲のうち、この 8 バイト以内で終わるキーは確定しているので前に集める
+        // 0 埋めで同じ値になったキー同士は短い方が小さい
+        int finished = lt;
+        for (int k = lt; k < gt; ++k) {
+            if (keys[entries[k].index]->size() <= depth + 8) {
+                std::swap(entries[finished++], entries[k]);
+            }
+        }
+        std::sort(entries.begin() + lt, entries.begin() + finished,
+            [&keys](const StringKeyEntry& x, const StringKeyEntry& y) {
+                return keys[x.index]->size() < keys[y.index]->size();
+            });
+
+        // 残りは次の 8 バイトを読み直して続ける
+        depth += 8;
+        for (int k = finished; k < gt; ++k) {
+            entries[k].prefix = packPrefix(*keys[entries[k].index], depth);
+        }
+        lo = finished;
+        hi = gt;
+    }
+}
+
+// リストがほぼ整列済みかどうかを調べる関数
+// 引数: const std::function<bool(const T&, const T&)>& comp - 比較関数
+// 戻り値: 昇順または降順 (等しい要素を含む) のランの平均の長さが 32 以上の場合は true
+// 期待結果: ランが短いと分かった時点で走査を打ち切る
+//           同じキーを含む降順の入力 (昇順にソートした後に降順でソートし直す場合など) も 1 つのランとして数え、
+//           クイックソートに回さないようにする (マージ側は同じキーの箇所でランを区切るが、マージで線形に近い比較回数で済む)
+template<typename T, typename Allocator>
+bool DoublyLinkedList<T, Allocator>::isNearlySorted(const std::function<bool(const T&, const T&)>& comp) const {
+    const int minAverageRun = 32;
+    int runs = 0;
+    Node* node = head;
+    while (node != nullptr) {
+        ++runs;
+        if (runs * minAverageRun > size) return false;
+
+        // 先頭の等しい要素は、どちらの向きのランにも含める
+        Node* next = node->next;
+        while (next != nullptr && !comp(next->data, node->data) && !comp(node->data, next->data)) {
+            node = next;
+            next = next->next;
+        }
+        if (next != nullptr && comp(next->data, node->data)) {
+            while (next != nullptr && !comp(node->data, next->data)) {
+                node = next;
+                next = next->next;
+            }
+        }
+        else {
+            while (next != nullptr && !comp(next->data, node->data)) {
+                node = next;
+                next = next->next;
+            }
+        }
+        node = next;
+    }
+    return true;
+}
+
+// 位置の配列を適応型マージソート (TimSort 方式) で安定にソートする関数
+// 引数: const std::vector<Node*>& nodes - 先頭から順のノード配列
+//       int* order - ソートする位置の配列
+//       int* buffer - 作業領域 (count 要素以上)
+//       int count - 要素数
+//       const std::function<bool(const T&, const T&)>& comp - 比較関数
+// 期待結果: order[0, count) が指すデータの順に安定に並ぶ
+//           短いランは二分挿入ソートで最小ラン長まで伸ばし、ランの長さの不変条件を保つようにスタック上でマージする
+template<typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::adaptiveSortOrder(const std::vector<Node*>& nodes, int* order, int* buffer, int count, const std::function<bool(const T&, const T&)>& comp) {
+    if (count < 2) return;
+
+    // 要素数を 2 のべき乗に近い数のランに分けられるように、32 から 64 の最小ラン長を決める
+    int minRun = count;
+    int remainder = 0;
+    while (minRun >= 64) {
+        remainder |= minRun & 1;
+        minRun >>= 1;
+    }
+    minRun += remainder;
+
+    std::vector<std::pair<int, int>> runs; // 未マージのラン (先頭の位置, 長さ)
+    int minGallop = 7;
+
+    // runs[index] と runs[index + 1] をマージする
+    auto mergeAt = [&](size_t index) {
+        mergeRuns(nodes, order + runs[index].first, runs[index].second, runs[index + 1].second, buffer, minGallop, comp);
+        runs[index].second += runs[index + 1].second;
+        runs.erase(runs.begin() + index + 1);
+    };
+
+    for (int lo = 0; lo < count;) {
+        int length = countRun(nodes, order + lo, count - lo, comp);
+        if (length < minRun) {
+            int forced = std::min(minRun, count - lo);
+            binaryInsertionSort(nodes, order + lo, length, forced, comp);
+            length = forced;
+        }
+        runs.push_back(std::make_pair(lo, length));
+        lo += length;
+
+        // 下から順に X > Y + Z, Y > Z (Z が最上段) が成り立つまでマージする
+        while (runs.size() > 1) {
+            size_t n = runs.size() - 2;
+            if ((n > 0 && runs[n - 1].second <= runs[n].second + runs[n + 1].second) ||
+                (n > 1 && runs[n - 2].second <= runs[n - 1].second + runs[n].second)) {
+                if (runs[n - 1].second < runs[n + 1].second) {
+                    --n;
+                }
+            }
+            else if (runs[n].second > runs[n + 1].second) {
+                break;
+            }
+            mergeAt(n);
+        }
+    }
+
+    while (runs.size() > 1) {
+        size_t n = runs.size() - 2;
+        if (n > 0 && runs[n - 1].second < runs[n + 1].second) {
+            --n;
+        }
+        mergeAt(n);
+    }
+}
+
+// 先頭のランの長さを求める関数
+// 引数: const std::vector<Node*>& nodes - 先頭から順のノード配列
+//       int* order - 位置の配列
+//       int count - 要素数
+//       const std::function<bool(const T&, const T&)>& comp - 比較関数
+// 戻り値: 先頭から続く昇順または狭義の降順のランの長さ
+// 期待結果: 狭義の降順のランは反転して昇順にする (等しい要素を含まないので安定性は崩れない)
+template<typename T, typename Allocator>
+int DoublyLinkedList<T, Allocator>::countRun(const std::vector<Node*>& nodes, int* order, int count, const std::function<bool(const T&, const T&)>& comp) {
+    if (count <= 1) return count;
+
+    int length = 2;
+    if (comp(nodes[order[1]]->data, nodes[order[0]]->data)) {
+        while (length < count && comp(nodes[order[length]]->data, nodes[order[length - 1]]->data)) {
+            ++length;
+        }
+        std::reverse(order, order + length);
+    }
+    else {
+        while (length < count && !comp(nodes[order[length]]->data, nodes[order[length - 1]]->data)) {
+            ++length;
+        }
+    }
+    return length;
+}
+
+// 二分挿入ソートを実行する関数
+// 引数: const std::vector<Node*>& nodes - 先頭から順のノード配列
+//       int* order - 位置の配列
+//       int sorted - 先頭からソート済みの要素数
+//       int count - 要素数
+//       const std::function<bool(const T&, const T&)>& comp - 比較関数
+// 期待結果: order[0, count) が安定に並ぶ
+template<typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::binaryInsertionSort(const std::vector<Node*>& nodes, int* order, int sorted, int count, const std::function<bool(const T&, const T&)>& comp) {
+    for (int i = std::max(sorted, 1); i < count; ++i) {
+        int index = order[i];
+        int* position = std::upper_bound(order, order + i, index, [&nodes, &comp](int a, int b) {
+            return comp(nodes[a]->data, nodes[b]->data);
+        });
+        std::copy_backward(position, order + i, order + i + 1);
+        *position = index;
+    }
+}
+
+// 隣り合う 2 つのランをマージする関数
+// 引数: const std::vector<Node*>& nodes - 先頭から順のノード配列
+//       int* first - 1 つ目のランの先頭 (2 つ目のランはその直後に続く)
+//       int length1, int length2 - 各ランの長さ
+//       int* buffer - 作業領域
+//       int& minGallop - ギャロッピングに切り替える連続回数 (ギャロッピングの効果に応じて増減する)
+//       const std::function<bool(const T&, const T&)>& comp - 比較関数
+// 期待結果: 2 つのランが安定にマージされる
+template<typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::mergeRuns(const std::vector<Node*>& nodes, int* first, int length1, int length2, int* buffer, int& minGallop, const std::function<bool(const T&, const T&)>& comp) {
+    auto less = [&nodes, &comp](int a, int b) {
+        return comp(nodes[a]->data, nodes[b]->data);
+    };
+
+    // 1 つ目のランの先頭のうち、2 つ目のランの先頭以下の要素は既に正しい位置にある
+    int* run1 = first;
+    int* run2 = first + length1;
+    int skipped = gallop(run1, length1, false, [&](int x) { return !less(*run2, x); });
+    run1 += skipped;
+    length1 -= skipped;
+    if (length1 == 0) return;
+
+    // 2 つ目のランの末尾のうち、1 つ目のランの末尾以上の要素も既に正しい位置にある
+    int last1 = run1[length1 - 1];
+    length2 = gallop(run2, length2, true, [&](int x) { return less(x, last1); });
+    if (length2 == 0) return;
+
+    bool done = false;
+    if (length1 <= length2) {
+        // 短い 1 つ目のランを作業領域に移し、先頭から詰めていく
+        std::copy(run1, run1 + length1, buffer);
+        int* a = buffer;
+        int* aEnd = buffer + length1;
+        int* b = run2;
+        int* bEnd = run2 + length2;
+        int* dest = run1;
+
+        while (!done) {
+            // 1 要素ずつ比較してマージする
+            int count1 = 0;
+            int count2 = 0;
+            while (!done && count1 < minGallop && count2 < minGallop) {
+                if (less(*b, *a)) {
+                    *dest++ = *b++;
+                    ++count2;
+                    count1 = 0;
+                    done = b == bEnd;
+                }
+                else {
+                    *dest++ = *a++;
+                    ++count1;
+                    count2 = 0;
+                    done = a == aEnd;
+                }
+            }
+
+            // 一方が続けて選ばれている間はまとめて移動する
+            while (!done) {
+                int key2 = *b;
+                int run = gallop(a, static_cast<int>(aEnd - a), false, [&](int x) { return !less(key2, x); });
+                dest = std::copy(a, a + run, dest);
+                a += run;
+                if ((done = a == aEnd)) break;
+                *dest++ = *b++;
+                if ((done = b == bEnd)) break;
+
+                int key1 = *a;
+                int run2Count = gallop(b, static_cast<int>(bEnd - b), false, [&](int x) { return less(x, key1); });
+                dest = std::copy(b, b + run2Count, dest);
+                b += run2Count;
+                if ((done = b == bEnd)) break;
+                *dest++ = *a++;
+                if ((done = a == aEnd)) break;
+
+                if (minGallop > 1) {
+                    --minGallop;
+                }
+                if (run < 7 && run2Count < 7) {
+                    minGallop += 2;
+                    break;
+                }
+            }
+        }
+        std::copy(a, aEnd, dest);
+    }
+    else {
+        // 短い 2 つ目のランを作業領域に移し、末尾から詰めていく
+        std::copy(run2, run2 + length2, buffer);
+        int* a = run1 + length1;
+        int* b = buffer + length2;
+        int* dest = run2 + length2;
+
+        while (!done) {
+            int count1 = 0;
+            int count2 = 0;
+            while (!done && count1 < minGallop && count2 < minGallop) {
+                if (less(b[-1], a[-1])) {
+                    *--dest = *--a;
+                    ++count1;
+                    count2 = 0;
+                    done = a == run1;
+                }
+                else {
+                    *--dest = *--b;
+                    ++count2;
+                    count1 = 0;
+                    done = b == buffer;
+                }
+            }
+
+            while (!done) {
+                // 1 つ目のランの末尾のうち、2 つ目のランの末尾より大きい要素をまとめて移動する
+                int key2 = b[-1];
+                int remaining1 = static_cast<int>(a - run1);
+                int run = remaining1 - gallop(run1, remaining1, true, [&](int x) { return !less(key2, x); });
+                dest = std::copy_backward(a - run, a, dest);
+                a -= run;
+                if ((done = a == run1)) break;
+                *--dest = *--b;
+                if ((done = b == buffer)) break;
+
+                // 2 つ目のランの末尾のうち、1 つ目のランの末尾以上の要素をまとめて移動する
+                int key1 = a[-1];
+                int remaining2 = static_cast<int>(b - buffer);
+                int run2Count = remaining2 - gallop(buffer, remaining2, true, [&](int x) { return less(x, key1); });
+                dest = std::copy_backward(b - run2Count, b, dest);
+                b -= run2Count;
+                if ((done = b == buffer)) break;
+                *--dest = *--a;
+                if ((done = a == run1)) break;
+
+                if (minGallop > 1) {
+                    --minGallop;
+                }
+                if (run < 7 && run2Count < 7) {
+                    minGallop += 2;
+                    break;
+                }
+            }
+        }
+        std::copy_backward(buffer, b, dest);
+    }
+}
+
+// ギャロッピング (指数探索 + 二分探索) で境界を探す関数
+// 引数: const int* base - 位置の配列
+//       int count - 要素数
+//       bool fromEnd - 末尾から探す場合は true
+//       Predicate before - 前半で true・後半で false になる条件
+// 戻り値: before が true になる要素の数
+// 期待結果: 境界までの距離を d として O(log d) 回の判定で見つかる
+template<typename T, typename Allocator>
+template<typename Predicate>
+int DoublyLinkedList<T, Allocator>::gallop(const int* base, int count, bool fromEnd, Predicate before) {
+    int lo;
+    int hi;
+    if (!fromEnd) {
+        // 先頭から 1, 2, 4, ... 個先を調べる
+        if (count == 0 || !before(base[0])) return 0;
+        int known = 0;
+        int step = 1;
+        while (known + step < count && before(base[known + step])) {
+            known += step;
+            step *= 2;
+        }
+        lo = known + 1;
+        hi = std::min(known + step, count);
+    }
+    else {
+        // 末尾から 1, 2, 4, ... 個前を調べる
+        if (count == 0 || before(base[count - 1])) return count;
+        int known = count - 1;
+        int step = 1;
+        while (known - step >= 0 && !before(base[known - step])) {
+            known -= step;
+            step *= 2;
+        }
+        lo = std::max(known - step + 1, 0);
+        hi = known;
+    }
+
+    // 境界は [lo, hi] にある
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (before(base[mid])) {
+            lo = mid + 1;
+        }
+        else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+// ソート済みの位置の配列 2 つを安定にマージする関数
+// 引数: const std::vector<Node*>& nodes - 先頭から順のノード配列
+//       const int* first1, const int* last1 - 1 つ目の範囲
+//       const int* first2, const int* last2 - 2 つ目の範囲
+//       int* out - 出力先
+//       const std::function<bool(const T&, const T&)>& comp - 比較関数
+// 期待結果: 2 つの範囲がマージされて out に書き込まれる (等しい場合は 1 つ目の範囲が先)
+template<typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::mergeOrder(const std::vector<Node*>& nodes, const int* first1, const int* last1, const int* first2, const int* last2, int* out, const std::function<bool(const T&, const T&)>& comp) {
+    while (first1 != last1 && first2 != last2) {
+        if (comp(nodes[*first2]->data, nodes[*first1]->data)) {
+            *out++ = *first2++;
+        }
+        else {
+            *out++ = *first1++;
+        }
+    }
+    out = std::copy(first1, last1, out);
+    std::copy(first2, last2, out);
+}
+
+// ソート済みの位置の配列 2 つを並列にマージする関数
+// 引数: TaskPool& pool - タスクプール
+//       その他は mergeOrder と同じ
+// 期待結果: 大きい方の範囲の中央の要素で両方の範囲を二分し、前半と後半を別々のタスクでマージする
+//           等しい要素は 1 つ目の範囲が先になるように分割するため、結果は mergeOrder と一致する
+template<typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::parallelMergeOrder(TaskPool& pool, const std::vector<Node*>& nodes, const int* first1, const int* last1, const int* first2, const int* last2, int* out, const std::function<bool(const T&, const T&)>& comp) {
+    const std::ptrdiff_t grain = 8192;
+    std::ptrdiff_t size1 = last1 - first1;
+    std::ptrdiff_t size2 = last2 - first2;
+    if (size1 + size2 <= grain) {
+        mergeOrder(nodes, first1, last1, first2, last2, out, comp);
+        return;
+    }
+
+    auto less = [&nodes, &comp](int a, int b) {
+        return comp(nodes[a]->data, nodes[b]->data);
+    };
+
+    const int* mid1;
+    const int* mid2;
+    if (size1 >= size2) {
+        // 1 つ目の中央の要素より小さい要素を 2 つ目から前半に含める
+        mid1 = first1 + size1 / 2;
+        mid2 = std::lower_bound(first2, last2, *mid1, less);
+    }
+    else {
+        // 2 つ目の中央の要素以下の要素を 1 つ目から前半に含める
+        mid2 = first2 + size2 / 2;
+        mid1 = std::upper_bound(first1, last1, *mid2, less);
+    }
+    int* outMid = out + (mid1 - first1) + (mid2 - first2);
+
+    TaskGroup group;
+    pool.Run(group, [&pool, &nodes, &comp, first1, mid1, first2, mid2, out] {
+        parallelMergeOrder(pool, nodes, first1, mid1, first2, mid2, out, comp);
+    });
+    parallelMergeOrder(pool, nodes, mid1, last1, mid2, last2, outMid, comp);
+    pool.Wait(group);
+}
+
+// 比較順で先頭から k 個の要素の位置を求める関数
+// 引数: const std::vector<Node*>& nodes - 先頭から順のノード配列
+//       int k - 求める個数
+//       const std::function<bool(const T&, const T&)>& comp - 比較関数
+// 戻り値: 先頭から k 個の要素の位置を比較順に並べた配列
+// 期待結果: k 個の候補を最大ヒープで保持し、ヒープの先頭より前に来る要素だけを入れ替える
+template<typename T, typename Allocator>
+std::vector<int> DoublyLinkedList<T, Allocator>::selectFirst(const std::vector<Node*>& nodes, int k, const std::function<bool(const T&, const T&)>& comp) {
+    const int count = static_cast<int>(nodes.size());
+    k = std::min(k, count);
+    if (k <= 0) return std::vector<int>();
+
+    // 等しい要素は位置で順序付け、安定ソートの先頭 k 個と同じ要素を選ぶ
+    auto less = [&nodes, &comp](int a, int b) {
+        if (comp(nodes[a]->data, nodes[b]->data)) return true;
+        if (comp(nodes[b]->data, nodes[a]->data)) return false;
+        return a < b;
+    };
+
+    std::vector<int> heap(k);
+    for (int i = 0; i < k; ++i) {
+        heap[i] = i;
+    }
+    std::make_heap(heap.begin(), heap.end(), less);
+
+    for (int i = k; i < count; ++i) {
+        if (less(i, heap.front())) {
+            std::pop_heap(heap.begin(), heap.end(), less);
+            heap.back() = i;
+            std::push_heap(heap.begin(), heap.end(), less);
+        }
+    }
+
+    std::sort_heap(heap.begin(), heap.end(), less);
+    return heap;
+}
+
 // ConstIterator のコンストラクタ
 // 引数: Node* node - 現在のノード
 //       const DoublyLinkedList* list - 関連するリスト
 // 期待結果: ConstIterator が初期化される
-template<typename T>
-DoublyLinkedList<T>::ConstIterator::ConstIterator(Node* node, const DoublyLinkedList* list) : current(node), list(list) {}
+template<typename T, typename Allocator>
+DoublyLinkedList<T, Allocator>::ConstIterator::ConstIterator(Node* node, const DoublyLinkedList* list) : current(node), list(list) {}
 
 // ConstIterator のコピーコンストラクタ
 // 引数: const ConstIterator& other - コピー元のイテレータ
 // 期待結果: ConstIterator がコピーされる
-template<typename T>
-DoublyLinkedList<T>::ConstIterator::ConstIterator(const ConstIterator& other) : current(other.current), list(other.list) {}
+template<typename T, typename Allocator>
+DoublyLinkedList<T, Allocator>::ConstIterator::ConstIterator(const ConstIterator& other) : current(other.current), list(other.list) {}
 
 // 前置デクリメント演算子
 // 期待結果: イテレータが前のノードに移動する
 // 戻り値: 自身の参照
-template<typename T>
-typename DoublyLinkedList<T>::ConstIterator& DoublyLinkedList<T>::ConstIterator::operator--() {
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::ConstIterator& DoublyLinkedList<T, Allocator>::ConstIterator::operator--() {
     assert(list != nullptr);
     assert(list->tail != nullptr);
 
@@ -89,8 +808,8 @@ typename DoublyLinkedList<T>::ConstIterator& DoublyLinkedList<T>::ConstIterator:
 // 後置デクリメント演算子
 // 期待結果: イテレータが前のノードに移動する
 // 戻り値: 移動前のイテレータのコピー
-template<typename T>
-typename DoublyLinkedList<T>::ConstIterator DoublyLinkedList<T>::ConstIterator::operator--(int) {
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::ConstIterator DoublyLinkedList<T, Allocator>::ConstIterator::operator--(int) {
     assert(list != nullptr);
     assert(list->tail != nullptr);
 
@@ -102,8 +821,8 @@ typename DoublyLinkedList<T>::ConstIterator DoublyLinkedList<T>::ConstIterator::
 // 前置インクリメント演算子
 // 期待結果: イテレータが次のノードに移動する
 // 戻り値: 自身の参照
-template<typename T>
-typename DoublyLinkedList<T>::ConstIterator& DoublyLinkedList<T>::ConstIterator::operator++() {
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::ConstIterator& DoublyLinkedList<T, Allocator>::ConstIterator::operator++() {
     assert(list != nullptr);
     assert(list->tail != nullptr);
 
@@ -119,8 +838,8 @@ typename DoublyLinkedList<T>::ConstIterator& DoublyLinkedList<T>::ConstIterator:
 // 後置インクリメント演算子
 // 期待結果: イテレータが次のノードに移動する
 // 戻り値: 移動前のイテレータのコピー
-template<typename T>
-typename DoublyLinkedList<T>::ConstIterator DoublyLinkedList<T>::ConstIterator::operator++(int) {
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::ConstIterator DoublyLinkedList<T, Allocator>::ConstIterator::operator++(int) {
     assert(list != nullptr);
     assert(list->tail != nullptr);
 
@@ -132,8 +851,8 @@ typename DoublyLinkedList<T>::ConstIterator DoublyLinkedList<T>::ConstIterator::
 // デリファレンス演算子
 // 期待結果: 現在のノードのデータを返す
 // 戻り値: 現在のノードのデータの参照
-template<typename T>
-const T& DoublyLinkedList<T>::ConstIterator::operator*() const {
+template<typename T, typename Allocator>
+const T& DoublyLinkedList<T, Allocator>::ConstIterator::operator*() const {
     assert(current != nullptr);
 
     return current->data;
@@ -142,8 +861,8 @@ const T& DoublyLinkedList<T>::ConstIterator::operator*() const {
 // 代入演算子
 // 期待結果: イテレータの状態をコピーする
 // 引数: const ConstIterator& other - コピー元のイテレータ
-template<typename T>
-void  DoublyLinkedList<T>::ConstIterator::operator=(const ConstIterator& other) {
+template<typename T, typename Allocator>
+void  DoublyLinkedList<T, Allocator>::ConstIterator::operator=(const ConstIterator& other) {
     current = other.current;
 }
 
@@ -151,8 +870,8 @@ void  DoublyLinkedList<T>::ConstIterator::operator=(const ConstIterator& other)
 // 期待結果: イテレータが指しているノードが同じ場合に true を返す
 // 引数: const ConstIterator& other - 比較対象のイテレータ
 // 戻り値: 等しい場合は true, それ以外は false
-template<typename T>
-bool DoublyLinkedList<T>::ConstIterator::operator==(const ConstIterator& other) const {
+template<typename T, typename Allocator>
+bool DoublyLinkedList<T, Allocator>::ConstIterator::operator==(const ConstIterator& other) const {
     return current == other.current;
 }
 
@@ -160,8 +879,8 @@ bool DoublyLinkedList<T>::ConstIterator::operator==(const ConstIterator& other)
 // 期待結果: イテレータが指しているノードが異なる場合に true を返す
 // 引数: const ConstIterator& other - 比較対象のイテレータ
 // 戻り値: 異なる場合は true, それ以外は false
-template<typename T>
-bool DoublyLinkedList<T>::ConstIterator::operator!=(const ConstIterator& other) const {
+template<typename T, typename Allocator>
+bool DoublyLinkedList<T, Allocator>::ConstIterator::operator!=(const ConstIterator& other) const {
     return current != other.current;
 }
 
@@ -169,14 +888,14 @@ bool DoublyLinkedList<T>::ConstIterator::operator!=(const ConstIterator& other)
 // 引数: Node* node - 現在のノード
 //       const DoublyLinkedList* list - 関連するリスト
 // 期待結果: Iterator が初期化される
-template<typename T>
-DoublyLinkedList<T>::Iterator::Iterator(Node* node, const DoublyLinkedList* list) : ConstIterator(node, list) {}
+template<typename T, typename Allocator>
+DoublyLinkedList<T, Allocator>::Iterator::Iterator(Node* node, const DoublyLinkedList* list) : ConstIterator(node, list) {}
 
 // 前置デクリメント演算子
 // 期待結果: イテレータが前のノードに移動する
 // 戻り値: 自身の参照
-template<typename T>
-typename DoublyLinkedList<T>::Iterator& DoublyLinkedList<T>::Iterator::operator--() {
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::Iterator& DoublyLinkedList<T, Allocator>::Iterator::operator--() {
     assert(this->list != nullptr);
     assert(this->list->tail != nullptr);
     assert(this->current != this->list->head);
@@ -193,8 +912,8 @@ typename DoublyLinkedList<T>::Iterator& DoublyLinkedList<T>::Iterator::operator-
 // 後置デクリメント演算子
 // 期待結果: イテレータが前のノードに移動する
 // 戻り値: 移動前のイテレータのコピー
-template<typename T>
-typename DoublyLinkedList<T>::Iterator DoublyLinkedList<T>::Iterator::operator--(int) {
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::Iterator DoublyLinkedList<T, Allocator>::Iterator::operator--(int) {
     assert(this->list != nullptr);
     assert(this->list->tail != nullptr);
     assert(this->current != this->list->head);
@@ -207,8 +926,8 @@ typename DoublyLinkedList<T>::Iterator DoublyLinkedList<T>::Iterator::operator--
 // 前置インクリメント演算子
 // 期待結果: イテレータが次のノードに移動する
 // 戻り値: 自身の参照
-template<typename T>
-typename DoublyLinkedList<T>::Iterator& DoublyLinkedList<T>::Iterator::operator++() {
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::Iterator& DoublyLinkedList<T, Allocator>::Iterator::operator++() {
     assert(this->current != nullptr);
 
     this->current = this->current->next;
@@ -218,8 +937,8 @@ typename DoublyLinkedList<T>::Iterator& DoublyLinkedList<T>::Iterator::operator+
 // 後置インクリメント演算子
 // 期待結果: イテレータが次のノードに移動する
 // 戻り値: 移動前のイテレータのコピー
-template<typename T>
-typename DoublyLinkedList<T>::Iterator DoublyLinkedList<T>::Iterator::operator++(int) {
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::Iterator DoublyLinkedList<T, Allocator>::Iterator::operator++(int) {
     assert(this->current != nullptr);
 
     Iterator temp = *this;
@@ -230,36 +949,62 @@ typename DoublyLinkedList<T>::Iterator DoublyLinkedList<T>::Iterator::operator++
 // デリファレンス演算子
 // 期待結果: 現在のノードのデータを返す
 // 戻り値: 現在のノードのデータの参照
-template<typename T>
-T& DoublyLinkedList<T>::Iterator::operator*() {
+template<typename T, typename Allocator>
+T& DoublyLinkedList<T, Allocator>::Iterator::operator*() {
     assert(this->current != nullptr);
 
     return this->current->data;
 }
 
 // DoublyLinkedList のコンストラクタ
+// 入力: ノードの確保に使うアロケータ (const Allocator& allocator)
 // 期待結果: 空のリストが初期化される
-template<typename T>
-DoublyLinkedList<T>::DoublyLinkedList() : head(nullptr), tail(nullptr), size(0) {}
+template<typename T, typename Allocator>
+DoublyLinkedList<T, Allocator>::DoublyLinkedList(const Allocator& allocator) : head(nullptr), tail(nullptr), size(0), allocator(allocator) {}
+
+// ノードを生成する関数
+// 入力: ノードに格納するデータ (const T& data)
+// 戻り値: アロケータから確保して初期化したノード
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::Node* DoublyLinkedList<T, Allocator>::createNode(const T& data) {
+    Node* node = NodeTraits::allocate(allocator, 1);
+    try {
+        NodeTraits::construct(allocator, node, data);
+    }
+    catch (...) {
+        NodeTraits::deallocate(allocator, node, 1);
+        throw;
+    }
+    return node;
+}
+
+// ノードを破棄する関数
+// 入力: 破棄するノード (Node* node)
+// 期待結果: データが破棄され、領域がアロケータに返される
+template<typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::destroyNode(Node* node) {
+    NodeTraits::destroy(allocator, node);
+    NodeTraits::deallocate(allocator, node, 1);
+}
 
 // リストのサイズを取得する関数
 // 期待結果: リストのサイズを返す
 // 戻り値: リストのサイズ
-template<typename T>
-int DoublyLinkedList<T>::Getsize() const {
+template<typename T, typename Allocator>
+int DoublyLinkedList<T, Allocator>::Getsize() const {
     return size;
 }
 
 // ノードを挿入
 // 入力: 挿入位置のイテレータ (const Iterator&), 挿入するデータ (const T&)
 // 戻り値: 挿入が成功した場合は true、失敗した場合は false
-template<typename T>
-bool DoublyLinkedList<T>::Insert(const Iterator& iter, const T& data) {
-    Node* newNode = new Node(data);
-    Node* current = iter.current;
-
+template<typename T, typename Allocator>
+bool DoublyLinkedList<T, Allocator>::Insert(const Iterator& iter, const T& data) {
     if (iter.list != this) return false;
 
+    Node* newNode = createNode(data);
+    Node* current = iter.current;
+
     if (current == nullptr) {
         if (tail == nullptr) {
             head = tail = newNode;
@@ -289,8 +1034,8 @@ bool DoublyLinkedList<T>::Insert(const Iterator& iter, const T& data) {
 // ノードを削除
 // 入力: 削除する位置のイテレータ (const Iterator&)
 // 戻り値: 削除が成功した場合は true、失敗した場合は false
-template<typename T>
-bool DoublyLinkedList<T>::Delete(const Iterator& iter) {
+template<typename T, typename Allocator>
+bool DoublyLinkedList<T, Allocator>::Delete(const Iterator& iter) {
     Node* current = iter.current;
 
     if (current == nullptr || iter.list != this) return false;
@@ -309,54 +1054,371 @@ bool DoublyLinkedList<T>::Delete(const Iterator& iter) {
         tail = current->prev;
     }
 
-    delete current;
+    destroyNode(current);
     size--;
 
     return true;
 }
 
+// 別のリストの範囲を移動
+// 入力: 挿入位置のイテレータ (const Iterator& pos), 移動元のリスト (DoublyLinkedList& other),
+//       移動する範囲 [first, last) のイテレータ (const Iterator& first, const Iterator& last)
+// 戻り値: 移動が成功した場合は true、失敗した場合は false
+template<typename T, typename Allocator>
+bool DoublyLinkedList<T, Allocator>::Splice(const Iterator& pos, DoublyLinkedList& other, const Iterator& first, const Iterator& last) {
+    if (pos.list != this || first.list != &other || last.list != &other) return false;
+    if (allocator != other.allocator) return false; // 確保元の異なるノードは受け取れない
+    if (first.current == last.current) return true;
+
+    // 範囲をたどって要素数を数え、last に届かない範囲や pos を含む範囲を拒否する
+    int count = 0;
+    for (Node* node = first.current; node != last.current; node = node->next) {
+        if (node == nullptr || node == pos.current) return false;
+        ++count;
+    }
+
+    // 移動元から範囲を外す
+    Node* rangeFirst = first.current;
+    Node* rangeLast = last.current != nullptr ? last.current->prev : other.tail;
+    if (rangeFirst->prev) {
+        rangeFirst->prev->next = last.current;
+    }
+    else {
+        other.head = last.current;
+    }
+    if (last.current) {
+        last.current->prev = rangeFirst->prev;
+    }
+    else {
+        other.tail = rangeFirst->prev;
+    }
+    other.size -= count;
+
+    // pos の前につなぐ
+    Node* after = pos.current;
+    Node* before = after != nullptr ? after->prev : tail;
+    rangeFirst->prev = before;
+    rangeLast->next = after;
+    if (before) {
+        before->next = rangeFirst;
+    }
+    else {
+        head = rangeFirst;
+    }
+    if (after) {
+        after->prev = rangeLast;
+    }
+    else {
+        tail = rangeLast;
+    }
+    size += count;
+
+    return true;
+}
+
+// ソート済みのリストをマージ
+// 入力: 比較関数の順にソート済みの移動元のリスト (DoublyLinkedList&& other),
+//       比較関数 (const std::function<bool(const T&, const T&)>& comp)
+// 戻り値: マージが成功した場合は true、失敗した場合は false
+// 期待結果: other の要素の方が前にある場合だけ other のノードを選び、1 本のリストにつなぎ直す
+//           other の先頭が this の末尾より前にならない場合は、末尾につなぐだけで済む
+template<typename T, typename Allocator>
+bool DoublyLinkedList<T, Allocator>::Merge(DoublyLinkedList&& other, const std::function<bool(const T&, const T&)>& comp) {
+    if (comp == nullptr || &other == this || allocator != other.allocator) return false;
+    if (other.head == nullptr) return true;
+
+    if (head != nullptr && comp(other.head->data, tail->data)) {
+        Node* a = head;
+        Node* b = other.head;
+        Node* last = nullptr;
+        while (a != nullptr && b != nullptr) {
+            Node*& source = comp(b->data, a->data) ? b : a;
+            Node* node = source;
+            source = source->next;
+
+            node->prev = last;
+            if (last) {
+                last->next = node;
+            }
+            else {
+                head = node;
+            }
+            last = node;
+        }
+
+        // 残った側はそのままつなぐ
+        Node* rest = a != nullptr ? a : b;
+        last->next = rest;
+        rest->prev = last;
+        if (b != nullptr) {
+            tail = other.tail;
+        }
+    }
+    else if (head != nullptr) {
+        tail->next = other.head;
+        other.head->prev = tail;
+        tail = other.tail;
+    }
+    else {
+        head = other.head;
+        tail = other.tail;
+    }
+
+    size += other.size;
+    other.head = nullptr;
+    other.tail = nullptr;
+    other.size = 0;
+    return true;
+}
+
 // リストの先頭を指すイテレータを取得
 // 期待結果: 先頭ノードを指すイテレータが返される
-template<typename T>
-typename DoublyLinkedList<T>::Iterator DoublyLinkedList<T>::begin() {
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::Iterator DoublyLinkedList<T, Allocator>::begin() {
     return Iterator(head, this);
 }
 
 // リストの先頭を指す定数イテレータを取得
 // 期待結果: 先頭ノードを指す定数イテレータが返される
-template<typename T>
-typename DoublyLinkedList<T>::ConstIterator DoublyLinkedList<T>::beginConst() const {
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::ConstIterator DoublyLinkedList<T, Allocator>::beginConst() const {
     return ConstIterator(head, this);
 }
 
 // リストの末尾を指すイテレータを取得
 // 期待結果: nullptrを指すイテレータが返される
-template<typename T>
-typename DoublyLinkedList<T>::Iterator DoublyLinkedList<T>::end() {
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::Iterator DoublyLinkedList<T, Allocator>::end() {
     return Iterator(nullptr, this);
 }
 
 // リストの末尾を指す定数イテレータを取得
 // 期待結果: nullptrを指す定数イテレータが返される
-template<typename T>
-typename DoublyLinkedList<T>::ConstIterator DoublyLinkedList<T>::endConst() const {
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::ConstIterator DoublyLinkedList<T, Allocator>::endConst() const {
     return ConstIterator(nullptr, this);
 }
 
 // リストをソートする関数
 // 入力: const std::function<bool(const T&, const T&)>& comp - 比較関数
 // 期待結果: リストがソートされる
-template<typename T>
-void DoublyLinkedList<T>::Sort(const std::function<bool(const T&, const T&)>& comp) {
+template<typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::Sort(const std::function<bool(const T&, const T&)>& comp) {
     if (head == nullptr || head->next == nullptr || comp == nullptr) return;
+
+    // 整列済みに近い入力はクイックソートの最悪ケースになるため、ランを活かしてマージする
+    if (isNearlySorted(comp)) {
+        Sort(comp, ExecutionPolicy::Sequential);
+        return;
+    }
     quickSort(head, tail, comp);
 }
 
+// 実行方式を指定してリストを安定ソートする関数
+// 入力: const std::function<bool(const T&, const T&)>& comp - 比較関数
+//       ExecutionPolicy policy - 実行方式
+//       unsigned threadCount - Parallel の場合に使うスレッド数 (0 の場合はハードウェアのスレッド数)
+// 期待結果: リストが安定にソートされる
+template<typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::Sort(const std::function<bool(const T&, const T&)>& comp, ExecutionPolicy policy, unsigned threadCount) {
+    if (head == nullptr || head->next == nullptr || comp == nullptr) return;
+
+    // 要素数がこれより少ない場合は並列化しても速くならない
+    const int parallelThreshold = 8192;
+
+    std::vector<Node*> nodes = collectNodes();
+    const int count = size;
+    std::vector<int> order(count);
+    std::vector<int> buffer(count);
+    for (int i = 0; i < count; ++i) {
+        order[i] = i;
+    }
+
+    if (policy == ExecutionPolicy::Sequential || threadCount == 1 || count < parallelThreshold) {
+        adaptiveSortOrder(nodes, order.data(), buffer.data(), count, comp);
+    }
+    else {
+        TaskPool pool(threadCount);
+
+        // スレッド数の数倍の区間に分け、区間ごとに並列にソートする
+        int runCount = static_cast<int>(pool.GetThreadCount()) * 4;
+        int runLength = (count + runCount - 1) / runCount;
+        TaskGroup sortGroup;
+        for (int lo = 0; lo < count; lo += runLength) {
+            int length = std::min(runLength, count - lo);
+            pool.Run(sortGroup, [&nodes, &order, &buffer, &comp, lo, length] {
+                adaptiveSortOrder(nodes, order.data() + lo, buffer.data() + lo, length, comp);
+            });
+        }
+        pool.Wait(sortGroup);
+
+        // 隣り合う区間を 2 つずつ並列にマージしていく
+        int* source = order.data();
+        int* target = buffer.data();
+        for (int width = runLength; width < count; width *= 2) {
+            TaskGroup mergeGroup;
+            for (int lo = 0; lo < count; lo += 2 * width) {
+                int mid = std::min(lo + width, count);
+                int hi = std::min(lo + 2 * width, count);
+                pool.Run(mergeGroup, [&pool, &nodes, &comp, source, target, lo, mid, hi] {
+                    parallelMergeOrder(pool, nodes, source + lo, source + mid, source + mid, source + hi, target + lo, comp);
+                });
+            }
+            pool.Wait(mergeGroup);
+            std::swap(source, target);
+        }
+        if (source != order.data()) {
+            std::copy(source, source + count, order.data());
+        }
+    }
+
+    applyOrder(nodes, order);
+}
+
+// リストの先頭 k 個だけをソートする関数
+// 入力: int k - ソートする個数
+//       const std::function<bool(const T&, const T&)>& comp - 比較関数
+// 期待結果: 先頭 k 個の位置に、リスト全体をソートした場合の先頭 k 個が順に並ぶ
+template<typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::PartialSort(int k, const std::function<bool(const T&, const T&)>& comp) {
+    if (head == nullptr || head->next == nullptr || comp == nullptr || k <= 0) return;
+
+    std::vector<Node*> nodes = collectNodes();
+    std::vector<int> order = selectFirst(nodes, k, comp);
+
+    // 選ばれなかった要素は元の相対順序のまま後ろに並べる
+    std::vector<bool> selected(nodes.size(), false);
+    for (int index : order) {
+        selected[index] = true;
+    }
+    for (int i = 0; i < size; ++i) {
+        if (!selected[i]) {
+            order.push_back(i);
+        }
+    }
+    applyOrder(nodes, order);
+}
+
+// 比較順で先頭から k 個の要素を取得する関数
+// 入力: int k - 取得する個数
+//       const std::function<bool(const T&, const T&)>& comp - 比較関数
+// 戻り値: リスト全体をソートした場合の先頭 k 個のコピー
+template<typename T, typename Allocator>
+std::vector<T> DoublyLinkedList<T, Allocator>::TopK(int k, const std::function<bool(const T&, const T&)>& comp) const {
+    std::vector<T> result;
+    if (comp == nullptr) return result;
+
+    std::vector<Node*> nodes = collectNodes();
+    std::vector<int> order = selectFirst(nodes, k, comp);
+    result.reserve(order.size());
+    for (int index : order) {
+        result.push_back(nodes[index]->data);
+    }
+    return result;
+}
+
+// 複数の列でリストをソートする関数
+// 入力: const std::vector<SortKey<T>>& keys - 優先度の高い順に並べた列のキー
+// 期待結果: 各ノードの正規化キーを 1 回だけ作り、キーのバイト列の順にリストがソートされる
+template<typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::SortBy(const std::vector<SortKey<T>>& keys) {
+    if (head == nullptr || head->next == nullptr || keys.empty()) return;
+
+    std::vector<Node*> nodes = collectNodes();
+    std::vector<std::string> normalized(nodes.size());
+    std::vector<const std::string*> keyPointers(nodes.size());
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        for (const SortKey<T>& key : keys) {
+            key.AppendTo(nodes[i]->data, normalized[i]);
+        }
+
+        // 最後に元の位置を付けて、等しい要素の順序を保つ
+        uint32_t position = static_cast<uint32_t>(i);
+        for (int shift = 24; shift >= 0; shift -= 8) {
+            normalized[i] += static_cast<char>((position >> shift) & 0xFF);
+        }
+        keyPointers[i] = &normalized[i];
+    }
+
+    std::vector<int> order = stringSortOrder(keyPointers);
+    applyOrder(nodes, order);
+}
+
+// 射影したキーでリストをソートする関数 (シュワルツ変換)
+// 入力: Projection projection - データからキーを取り出す関数
+//       Compare compare - キーの比較関数
+// 期待結果: キーを各ノードにつき 1 回だけ計算し、キーの配列上で位置を安定ソートしてから並べ替える
+template<typename T, typename Allocator>
+template<typename Projection, typename Compare>
+void DoublyLinkedList<T, Allocator>::SortBy(Projection projection, Compare compare) {
+    if (head == nullptr || head->next == nullptr) return;
+
+    using Key = typename std::decay<decltype(projection(std::declval<const T&>()))>::type;
+    std::vector<Node*> nodes = collectNodes();
+    std::vector<Key> keys;
+    keys.reserve(nodes.size());
+    for (Node* node : nodes) {
+        keys.push_back(projection(static_cast<const T&>(node->data)));
+    }
+
+    std::vector<int> order(nodes.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        order[i] = static_cast<int>(i);
+    }
+    std::stable_sort(order.begin(), order.end(), [&keys, &compare](int a, int b) {
+        return compare(keys[a], keys[b]);
+    });
+    applyOrder(nodes, order);
+}
+
+// 文字列キーでリストをソートする関数
+// 入力: const std::function<const std::string&(const T&)>& key - キーを取り出す関数
+//       bool descending - 降順にする場合は true
+// 期待結果: リストがキーの辞書順にソートされる
+template<typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::StringSort(const std::function<const std::string&(const T&)>& key, bool descending) {
+    if (head == nullptr || head->next == nullptr || key == nullptr) return;
+
+    std::vector<Node*> nodes = collectNodes();
+    std::vector<const std::string*> keys;
+    keys.reserve(nodes.size());
+    for (Node* node : nodes) {
+        keys.push_back(&key(node->data));
+    }
+
+    std::vector<int> order = stringSortOrder(keys);
+    if (descending) {
+        std::reverse(order.begin(), order.end());
+    }
+    applyOrder(nodes, order);
+}
+
 // DoublyLinkedList のデストラクタ
 // 期待結果: リストの全ノードが削除される
-template<typename T>
-DoublyLinkedList<T>::~DoublyLinkedList() {
-    while (head) {
-        Delete(begin());
+template<typename T, typename Allocator>
+DoublyLinkedList<T, Allocator>::~DoublyLinkedList() {
+    Clear();
+}
+
+// リストの全ノードを削除する関数
+// 期待結果: リストが空になる (既定のアロケータでは、プール上のノードが全て解放された時点でページがまとめて返される)
+//           個別に破棄しなくてよいアロケータ (ArenaAllocator) では、ノードをたどらずに先頭と末尾を外すだけで済ませる
+template<typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::Clear() {
+    if (SkipsDestruction<NodeAllocator>::value) {
+        head = nullptr;
+        tail = nullptr;
+        size = 0;
+        return;
+    }
+
+    Node* current = head;
+    while (current != nullptr) {
+        Node* next = current->next;
+        destroyNode(current);
+        current = next;
     }
+    head = nullptr;
+    tail = nullptr;
+    size = 0;
 }
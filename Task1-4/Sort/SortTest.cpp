@@ -1,7 +1,14 @@
+#include <algorithm>
+#include <cctype>
 #include <iostream>
+#include <random>
+#include <sstream>
 #include <string>
+#include <vector>
 #include "gtest/gtest.h"
 #include "Sort.h"
+#include "ExternalSort.h"
+#include "SortedList.h"
 
 using PerformanceData = std::pair<int, std::string>;
 
@@ -25,6 +32,25 @@ inline bool NameD(const PerformanceData& a, const PerformanceData& b) {
     return a.second > b.second;
 }
 
+// 名前をソートキーとして取り出すための関数
+inline const std::string& UserName(const PerformanceData& a) {
+    return a.second;
+}
+
+// スコアをソートキーとして取り出すための関数
+inline long long Score(const PerformanceData& a) {
+    return a.first;
+}
+
+// リストの内容を配列として取り出すための関数
+std::vector<PerformanceData> ToVector(DoublyLinkedList<PerformanceData>& list) {
+    std::vector<PerformanceData> result;
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        result.push_back(*it);
+    }
+    return result;
+}
+
 // 無効な比較関数
 bool compareInvalid(const std::string& a, const std::string& b) {
     return a < b;
@@ -361,3 +387,862 @@ TEST(SortTest, TestConst) {
 #endif //SKIP_TEST
     SUCCEED();
 }
+
+// 文字列ソートで空のリストをソートするテスト
+// 期待結果: ソート後もリストのサイズが0であること
+TEST(SortTest, StringSortEmpty) {
+    DoublyLinkedList<PerformanceData> list;
+    list.StringSort(UserName);
+    EXPECT_EQ(0, list.Getsize());
+
+    list.StringSort(UserName, true);
+    EXPECT_EQ(0, list.Getsize());
+}
+
+// 先頭 8 バイトが等しい名前を文字列ソートするテスト
+// 期待結果: 9 バイト目以降と長さの違いで正しく昇順・降順に並ぶこと
+TEST(SortTest, StringSortSharedPrefix) {
+    DoublyLinkedList<PerformanceData> list;
+    list.Insert(list.end(), PerformanceData{ 1, "PlayerName_20" });
+    list.Insert(list.end(), PerformanceData{ 2, "PlayerName" });
+    list.Insert(list.end(), PerformanceData{ 3, "" });
+    list.Insert(list.end(), PerformanceData{ 4, "PlayerName_100" });
+    list.Insert(list.end(), PerformanceData{ 5, "PlayerNa" });
+    list.Insert(list.end(), PerformanceData{ 6, "PlayerName_2" });
+
+    auto it = list.begin();
+    list.StringSort(UserName);
+    EXPECT_EQ("", (*it).second);
+    EXPECT_EQ(3, (*it).first);
+    const char* ascending[] = { "", "PlayerNa", "PlayerName", "PlayerName_100", "PlayerName_2", "PlayerName_20" };
+    for (const char* name : ascending) {
+        EXPECT_EQ(name, (*it).second);
+        ++it;
+    }
+
+    it = list.begin();
+    list.StringSort(UserName, true);
+    for (int i = 5; i >= 0; --i) {
+        EXPECT_EQ(ascending[i], (*it).second);
+        ++it;
+    }
+}
+
+// 多数の名前を文字列ソートするテスト
+// 期待結果: std::sort で名前順に並べた結果と名前の並びが一致すること
+TEST(SortTest, StringSortMatchesComparisonSort) {
+    std::mt19937 rng(12345);
+    std::uniform_int_distribution<int> length(0, 20);
+    std::uniform_int_distribution<int> letter(0, 3);
+
+    DoublyLinkedList<PerformanceData> list;
+    std::vector<PerformanceData> expected;
+    for (int i = 0; i < 5000; ++i) {
+        // 共通の接頭辞と重複が多くなるよう、少ない文字種で名前を作る
+        std::string name = "User";
+        int count = length(rng);
+        for (int j = 0; j < count; ++j) {
+            name += static_cast<char>('a' + letter(rng));
+        }
+        list.Insert(list.end(), PerformanceData{ i, name });
+        expected.push_back(PerformanceData{ i, name });
+    }
+
+    list.StringSort(UserName);
+    std::sort(expected.begin(), expected.end(), NameA);
+    std::vector<PerformanceData> actual = ToVector(list);
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(expected[i].second, actual[i].second);
+    }
+
+    list.StringSort(UserName, true);
+    actual = ToVector(list);
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(expected[expected.size() - 1 - i].second, actual[i].second);
+    }
+}
+
+// 重複の多いスコアでリストを作るための関数
+// 入力: 要素数 (int count), 乱数の種 (unsigned seed), リスト, 同じ内容の配列
+void FillRandomScores(int count, unsigned seed, DoublyLinkedList<PerformanceData>& list, std::vector<PerformanceData>& data) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> score(0, 99);
+    for (int i = 0; i < count; ++i) {
+        PerformanceData item{ score(rng), "User" + std::to_string(i) };
+        list.Insert(list.end(), item);
+        data.push_back(item);
+    }
+}
+
+// 並列ソートの結果が逐次の安定ソートと一致するかのテスト
+// 期待結果: Sequential と Parallel のどちらでも std::stable_sort と同じ並びになること
+TEST(SortTest, ParallelSortMatchesStableSort) {
+    DoublyLinkedList<PerformanceData> sequential;
+    DoublyLinkedList<PerformanceData> parallel;
+    std::vector<PerformanceData> expected;
+    std::vector<PerformanceData> unused;
+    FillRandomScores(100000, 2024, sequential, expected);
+    FillRandomScores(100000, 2024, parallel, unused);
+
+    std::stable_sort(expected.begin(), expected.end(), SD);
+    sequential.Sort(SD, ExecutionPolicy::Sequential);
+    parallel.Sort(SD, ExecutionPolicy::Parallel, 4);
+
+    EXPECT_EQ(expected, ToVector(sequential));
+    EXPECT_EQ(expected, ToVector(parallel));
+}
+
+// スレッド数を変えて並列ソートするテスト
+// 期待結果: どのスレッド数でも結果が std::stable_sort と一致すること
+TEST(SortTest, ParallelSortThreadCounts) {
+    for (unsigned threads = 1; threads <= 8; ++threads) {
+        DoublyLinkedList<PerformanceData> list;
+        std::vector<PerformanceData> expected;
+        FillRandomScores(30001, threads, list, expected);
+
+        std::stable_sort(expected.begin(), expected.end(), SA);
+        list.Sort(SA, ExecutionPolicy::Parallel, threads);
+        EXPECT_EQ(expected, ToVector(list)) << "threads = " << threads;
+    }
+}
+
+// 要素数が少ないリストと null 比較関数で並列ソートするテスト
+// 期待結果: 空のリストはそのまま、null 比較関数ではリストが変更されないこと
+TEST(SortTest, ParallelSortSmallAndNull) {
+    DoublyLinkedList<PerformanceData> list;
+    list.Sort(SA, ExecutionPolicy::Parallel);
+    EXPECT_EQ(0, list.Getsize());
+
+    PerformanceData data = { 20, "User1" };
+    PerformanceData data1 = { 10, "User" };
+    list.Insert(list.end(), data);
+    list.Insert(list.end(), data1);
+
+    list.Sort(nullptr, ExecutionPolicy::Parallel);
+    auto it = list.begin();
+    EXPECT_EQ(data.first, (*it).first);
+
+    list.Sort(SA, ExecutionPolicy::Parallel);
+    it = list.begin();
+    EXPECT_EQ(data1.first, (*it).first);
+    ++it;
+    EXPECT_EQ(data.first, (*it).first);
+}
+
+// ほぼ整列済みのリストをソートするテスト
+// 期待結果: 少数の要素が入れ替わった昇順・降順のリストが安定ソートと同じ順序になること
+TEST(SortTest, AdaptiveSortNearlySorted) {
+    std::vector<PerformanceData> data;
+    for (int i = 0; i < 50000; ++i) {
+        data.push_back(PerformanceData{ i / 4, "User" + std::to_string(i) });
+    }
+    std::mt19937 rng(32);
+    for (int i = 0; i < 100; ++i) {
+        std::swap(data[rng() % data.size()], data[rng() % data.size()]);
+    }
+    DoublyLinkedList<PerformanceData> list;
+    for (const PerformanceData& item : data) {
+        list.Insert(list.end(), item);
+    }
+
+    std::vector<PerformanceData> expected = data;
+    std::stable_sort(expected.begin(), expected.end(), SA);
+    list.Sort(SA);
+    EXPECT_EQ(expected, ToVector(list));
+
+    // 同じスコアを含む昇順のリストを降順でソートし直しても、比較回数が要素数に比例する程度で済む
+    std::stable_sort(expected.begin(), expected.end(), SD);
+    long long comparisons = 0;
+    list.Sort([&comparisons](const PerformanceData& a, const PerformanceData& b) {
+        ++comparisons;
+        return SD(a, b);
+    });
+    EXPECT_EQ(expected, ToVector(list));
+    EXPECT_LT(comparisons, 8LL * static_cast<long long>(data.size()));
+}
+
+// 昇順と降順のランが交互に並ぶリストをソートするテスト
+// 期待結果: 山型 (organ-pipe) とのこぎり型の入力が安定ソートと同じ順序になること
+TEST(SortTest, AdaptiveSortRuns) {
+    const int count = 40000;
+    std::vector<std::vector<PerformanceData>> inputs(2);
+    for (int i = 0; i < count; ++i) {
+        std::string name = "User" + std::to_string(i);
+        inputs[0].push_back(PerformanceData{ i < count / 2 ? i : count - i, name });
+        inputs[1].push_back(PerformanceData{ (i / 500) % 2 == 0 ? i % 500 : 500 - i % 500, name });
+    }
+
+    for (const std::vector<PerformanceData>& input : inputs) {
+        DoublyLinkedList<PerformanceData> list;
+        for (const PerformanceData& item : input) {
+            list.Insert(list.end(), item);
+        }
+
+        std::vector<PerformanceData> expected = input;
+        std::stable_sort(expected.begin(), expected.end(), SA);
+        list.Sort(SA);
+        EXPECT_EQ(expected, ToVector(list));
+    }
+}
+
+// 整列済みの大きなリストをソートするテスト
+// 期待結果: 比較回数が要素数に比例する程度で済み、順序が変わらないこと
+TEST(SortTest, AdaptiveSortAlreadySorted) {
+    const int count = 200000;
+    DoublyLinkedList<PerformanceData> list;
+    std::vector<PerformanceData> expected;
+    for (int i = 0; i < count; ++i) {
+        PerformanceData item{ i % 1000 == 0 ? i - 1 : i, "User" + std::to_string(i) };
+        list.Insert(list.end(), item);
+        expected.push_back(item);
+    }
+    std::stable_sort(expected.begin(), expected.end(), SA);
+
+    long long comparisons = 0;
+    list.Sort([&comparisons](const PerformanceData& a, const PerformanceData& b) {
+        ++comparisons;
+        return a.first < b.first;
+    });
+    EXPECT_EQ(expected, ToVector(list));
+    EXPECT_LT(comparisons, 4LL * count);
+}
+
+// 同じスコアを含む昇順のリストを降順でソートし直すテスト
+// 期待結果: 安定ソートと同じ順序になり、比較回数が要素数に比例する程度で済むこと (クイックソートに回らない)
+TEST(SortTest, AdaptiveSortReverseWithTies) {
+    const int count = 80000;
+    DoublyLinkedList<PerformanceData> list;
+    std::vector<PerformanceData> expected;
+    for (int i = 0; i < count; ++i) {
+        PerformanceData item{ i / 4, "User" + std::to_string(i) };
+        list.Insert(list.end(), item);
+        expected.push_back(item);
+    }
+    std::stable_sort(expected.begin(), expected.end(), SD);
+
+    long long comparisons = 0;
+    list.Sort([&comparisons](const PerformanceData& a, const PerformanceData& b) {
+        ++comparisons;
+        return SD(a, b);
+    });
+    EXPECT_EQ(expected, ToVector(list));
+    EXPECT_LT(comparisons, 8LL * count);
+}
+
+// 2 要素ずつ入れ替えた逆順のリストをソートするテスト
+// 期待結果: ランが短いためクイックソートで処理され、ピボットに ninther を使うので比較回数が n log n 程度で済むこと
+TEST(SortTest, SortNearlyReversedPairs) {
+    const int count = 100000;
+    DoublyLinkedList<PerformanceData> list;
+    std::vector<int> expected;
+    for (int i = 0; i < count; ++i) {
+        int score = count - (i ^ 1);
+        list.Insert(list.end(), PerformanceData{ score, "User" + std::to_string(i) });
+        expected.push_back(score);
+    }
+    std::sort(expected.begin(), expected.end());
+
+    long long comparisons = 0;
+    list.Sort([&comparisons](const PerformanceData& a, const PerformanceData& b) {
+        ++comparisons;
+        return a.first < b.first;
+    });
+
+    std::vector<int> scores;
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        scores.push_back((*it).first);
+    }
+    EXPECT_EQ(expected, scores);
+    EXPECT_LT(comparisons, 4LL * count * 17); // 4 n log2 n
+}
+
+// 同じスコアが大量に含まれるリストをソートするテスト
+// 期待結果: スコアが昇順に並び、比較回数が要素数に比例する程度で済むこと
+TEST(SortTest, SortManyDuplicates) {
+    const int count = 100000;
+    DoublyLinkedList<PerformanceData> list;
+    std::vector<int> expected;
+    std::mt19937 rng(33);
+    for (int i = 0; i < count; ++i) {
+        int score = static_cast<int>(rng() % 4);
+        list.Insert(list.end(), PerformanceData{ score, "User" + std::to_string(i) });
+        expected.push_back(score);
+    }
+    std::sort(expected.begin(), expected.end());
+
+    long long comparisons = 0;
+    list.Sort([&comparisons](const PerformanceData& a, const PerformanceData& b) {
+        ++comparisons;
+        return a.first < b.first;
+    });
+
+    std::vector<int> scores;
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        scores.push_back((*it).first);
+    }
+    EXPECT_EQ(expected, scores);
+    EXPECT_LT(comparisons, 16LL * count);
+}
+
+// 先頭 k 個だけをソートするテスト
+// 期待結果: 先頭 k 個が安定ソートの先頭 k 個と一致し、残りが元の相対順序のまま続くこと
+TEST(SortTest, PartialSortFirstK) {
+    DoublyLinkedList<PerformanceData> list;
+    std::vector<PerformanceData> data;
+    FillRandomScores(2000, 7, list, data);
+
+    std::vector<PerformanceData> expected = data;
+    std::stable_sort(expected.begin(), expected.end(), SD);
+
+    const int k = 100;
+    list.PartialSort(k, SD);
+    std::vector<PerformanceData> actual = ToVector(list);
+    ASSERT_EQ(data.size(), actual.size());
+    for (int i = 0; i < k; ++i) {
+        EXPECT_EQ(expected[i], actual[i]);
+    }
+
+    // 残りは選ばれなかった要素が元の順序で並んでいること
+    std::vector<PerformanceData> rest;
+    for (const PerformanceData& item : data) {
+        if (std::find(actual.begin(), actual.begin() + k, item) == actual.begin() + k) {
+            rest.push_back(item);
+        }
+    }
+    EXPECT_EQ(rest, std::vector<PerformanceData>(actual.begin() + k, actual.end()));
+}
+
+// 要素数以上や 0 以下の k で先頭 k 個をソートするテスト
+// 期待結果: 要素数以上ではリスト全体がソートされ、0 以下ではリストが変更されないこと
+TEST(SortTest, PartialSortBoundaries) {
+    DoublyLinkedList<PerformanceData> list;
+    PerformanceData data = { 10, "User" };
+    PerformanceData data1 = { 30, "User1" };
+    PerformanceData data2 = { 20, "User2" };
+    list.Insert(list.end(), data);
+    list.Insert(list.end(), data1);
+    list.Insert(list.end(), data2);
+
+    list.PartialSort(0, SD);
+    auto it = list.begin();
+    EXPECT_EQ(data.first, (*it).first);
+
+    list.PartialSort(10, SD);
+    it = list.begin();
+    EXPECT_EQ(data1.first, (*it).first);
+    ++it;
+    EXPECT_EQ(data2.first, (*it).first);
+    ++it;
+    EXPECT_EQ(data.first, (*it).first);
+}
+
+// 比較順で先頭 k 個を取得するテスト
+// 期待結果: 安定ソートの先頭 k 個のコピーが返され、リストは変更されないこと
+TEST(SortTest, TopKDoesNotModifyList) {
+    DoublyLinkedList<PerformanceData> list;
+    std::vector<PerformanceData> data;
+    FillRandomScores(2000, 11, list, data);
+
+    std::vector<PerformanceData> expected = data;
+    std::stable_sort(expected.begin(), expected.end(), SA);
+    expected.resize(10);
+
+    EXPECT_EQ(expected, list.TopK(10, SA));
+    EXPECT_EQ(data, ToVector(list));
+    EXPECT_TRUE(list.TopK(0, SA).empty());
+    EXPECT_EQ(data.size(), list.TopK(5000, SA).size());
+}
+
+// スコアの降順・名前の昇順の複合キーでソートするテスト
+// 期待結果: 比較関数をつないだ std::stable_sort と同じ並びになること
+TEST(SortTest, SortByScoreDescendingNameAscending) {
+    DoublyLinkedList<PerformanceData> list;
+    std::vector<PerformanceData> expected;
+    std::mt19937 rng(99);
+    std::uniform_int_distribution<int> score(-50, 50);
+    std::uniform_int_distribution<int> name(0, 30);
+    for (int i = 0; i < 3000; ++i) {
+        PerformanceData item{ score(rng), "User" + std::to_string(name(rng)) };
+        list.Insert(list.end(), item);
+        expected.push_back(item);
+    }
+
+    list.SortBy({ SortKey<PerformanceData>::Integer(Score, SortOrder::Descending),
+                  SortKey<PerformanceData>::String(UserName, SortOrder::Ascending) });
+    std::stable_sort(expected.begin(), expected.end(), [](const PerformanceData& a, const PerformanceData& b) {
+        return SD(a, b) || (!SD(b, a) && NameA(a, b));
+    });
+    EXPECT_EQ(expected, ToVector(list));
+}
+
+// 名前の降順の複合キーでソートするテスト
+// 期待結果: 接頭辞の関係にある名前や 0x00 を含む名前も降順に並ぶこと
+TEST(SortTest, SortByStringDescending) {
+    DoublyLinkedList<PerformanceData> list;
+    std::vector<PerformanceData> expected = {
+        { 1, "User" }, { 2, "User1" }, { 3, "" }, { 4, std::string("User\0", 5) }, { 5, "Usep" }, { 6, "User" }
+    };
+    for (const PerformanceData& item : expected) {
+        list.Insert(list.end(), item);
+    }
+
+    list.SortBy({ SortKey<PerformanceData>::String(UserName, SortOrder::Descending) });
+    std::stable_sort(expected.begin(), expected.end(), NameD);
+    EXPECT_EQ(expected, ToVector(list));
+}
+
+// キーを指定せずに複合ソートするテスト
+// 期待結果: リストが変更されないこと
+TEST(SortTest, SortByNoKeys) {
+    DoublyLinkedList<PerformanceData> list;
+    std::vector<PerformanceData> data;
+    FillRandomScores(10, 3, list, data);
+
+    list.SortBy({});
+    EXPECT_EQ(data, ToVector(list));
+}
+
+// ソート済みリストの内容を配列として取り出すための関数
+std::vector<PerformanceData> ToVector(SortedDoublyLinkedList<PerformanceData>& list) {
+    std::vector<PerformanceData> result;
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        result.push_back(*it);
+    }
+    return result;
+}
+
+// ソート済みリストに要素を挿入するテスト
+// 期待結果: 挿入のたびに順序が保たれ、等しいスコアは挿入順に並ぶこと
+TEST(SortTest, SortedListInsertKeepsOrder) {
+    SortedDoublyLinkedList<PerformanceData> list(SD);
+    std::vector<PerformanceData> expected;
+    std::mt19937 rng(5);
+    std::uniform_int_distribution<int> score(0, 200);
+    for (int i = 0; i < 3000; ++i) {
+        PerformanceData item{ score(rng), "User" + std::to_string(i) };
+        auto it = list.Insert(item);
+        EXPECT_EQ(item, *it);
+        expected.push_back(item);
+    }
+
+    std::stable_sort(expected.begin(), expected.end(), SD);
+    EXPECT_EQ(3000, list.Getsize());
+    EXPECT_EQ(expected, ToVector(list));
+}
+
+// ソート済みリストで位置を探すテスト
+// 期待結果: LowerBound がデータより前にならない最初の要素を指すこと
+TEST(SortTest, SortedListLowerBound) {
+    SortedDoublyLinkedList<PerformanceData> list(SA);
+    EXPECT_TRUE(list.LowerBound(PerformanceData{ 10, "" }) == list.end());
+
+    for (int i = 0; i < 1000; ++i) {
+        list.Insert(PerformanceData{ (i * 7) % 500 * 2, "User" + std::to_string(i) });
+    }
+
+    auto it = list.LowerBound(PerformanceData{ 301, "" });
+    EXPECT_EQ(302, (*it).first);
+    it = list.LowerBound(PerformanceData{ 300, "" });
+    EXPECT_EQ(300, (*it).first);
+    --it;
+    EXPECT_EQ(298, (*it).first);
+    EXPECT_TRUE(list.LowerBound(PerformanceData{ 999, "" }) == list.end());
+}
+
+// ソート済みリストから重複の多い要素を削除するテスト
+// 期待結果: 指定したノードだけが削除され、その後の挿入でも順序が保たれること
+TEST(SortTest, SortedListDeleteDuplicates) {
+    SortedDoublyLinkedList<PerformanceData> list(SA);
+    std::vector<PerformanceData> expected;
+    for (int i = 0; i < 500; ++i) {
+        PerformanceData item{ i % 5, "User" + std::to_string(i) };
+        list.Insert(item);
+        expected.push_back(item);
+    }
+    std::stable_sort(expected.begin(), expected.end(), SA);
+
+    // 各スコアの 2 番目の要素を削除する
+    for (int score = 0; score < 5; ++score) {
+        auto it = list.LowerBound(PerformanceData{ score, "" });
+        ++it;
+        PerformanceData removed = *it;
+        EXPECT_TRUE(list.Delete(it));
+        expected.erase(std::find(expected.begin(), expected.end(), removed));
+    }
+    EXPECT_FALSE(list.Delete(list.end()));
+    EXPECT_EQ(495, list.Getsize());
+    EXPECT_EQ(expected, ToVector(list));
+
+    // 全て削除してから再び挿入できること
+    while (list.Getsize() > 0) {
+        list.Delete(list.begin());
+    }
+    list.Insert(PerformanceData{ 3, "User" });
+    list.Insert(PerformanceData{ 1, "User1" });
+    EXPECT_EQ(1, (*list.begin()).first);
+}
+
+// 小文字に正規化した名前でソートするテスト
+// 期待結果: 射影が要素数と同じ回数だけ呼ばれ、正規化した名前の安定ソートと同じ順序になること
+TEST(SortTest, SortByProjectionCachesKeys) {
+    DoublyLinkedList<PerformanceData> list;
+    std::vector<PerformanceData> expected;
+    const char* names[] = { "alice", "Bob", "ALICE", "carol", "bob", "Alice", "Carol", "dave" };
+    for (int i = 0; i < 1000; ++i) {
+        PerformanceData item{ i, names[i % 8] };
+        list.Insert(list.end(), item);
+        expected.push_back(item);
+    }
+
+    auto lower = [](const PerformanceData& a) {
+        std::string key = a.second;
+        std::transform(key.begin(), key.end(), key.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return key;
+    };
+    std::stable_sort(expected.begin(), expected.end(), [&lower](const PerformanceData& a, const PerformanceData& b) {
+        return lower(a) < lower(b);
+    });
+
+    int calls = 0;
+    list.SortBy([&calls, &lower](const PerformanceData& a) {
+        ++calls;
+        return lower(a);
+    });
+    EXPECT_EQ(1000, calls);
+    EXPECT_EQ(expected, ToVector(list));
+}
+
+// 比較関数を指定して射影したキーでソートするテスト
+// 期待結果: スコアの降順に並び、同じスコアは元の順序を保つこと
+TEST(SortTest, SortByProjectionWithCompare) {
+    DoublyLinkedList<PerformanceData> list;
+    std::vector<PerformanceData> expected;
+    FillRandomScores(5000, 35, list, expected);
+    std::stable_sort(expected.begin(), expected.end(), SD);
+
+    list.SortBy(Score, std::greater<long long>());
+    EXPECT_EQ(expected, ToVector(list));
+
+    DoublyLinkedList<PerformanceData> empty;
+    empty.SortBy(Score);
+    EXPECT_EQ(0, empty.Getsize());
+}
+
+// ソート済みのリストをマージするテスト
+// 期待結果: 安定マージと同じ順序になり、ノードはつなぎ替えられるだけで移動元は空になること
+TEST(SortTest, MergeSortedLists) {
+    DoublyLinkedList<PerformanceData> list;
+    DoublyLinkedList<PerformanceData> other;
+    std::vector<PerformanceData> data1;
+    std::vector<PerformanceData> data2;
+    FillRandomScores(3000, 36, list, data1);
+    FillRandomScores(2000, 37, other, data2);
+    list.Sort(SD, ExecutionPolicy::Sequential);
+    other.Sort(SD, ExecutionPolicy::Sequential);
+    std::stable_sort(data1.begin(), data1.end(), SD);
+    std::stable_sort(data2.begin(), data2.end(), SD);
+
+    std::vector<const PerformanceData*> addresses;
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        addresses.push_back(&*it);
+    }
+    for (auto it = other.begin(); it != other.end(); ++it) {
+        addresses.push_back(&*it);
+    }
+
+    std::vector<PerformanceData> expected;
+    std::merge(data1.begin(), data1.end(), data2.begin(), data2.end(), std::back_inserter(expected), SD);
+    EXPECT_TRUE(list.Merge(std::move(other), SD));
+    EXPECT_EQ(expected, ToVector(list));
+    EXPECT_EQ(5000, list.Getsize());
+    EXPECT_EQ(0, other.Getsize());
+    EXPECT_TRUE(other.begin() == other.end());
+
+    std::vector<const PerformanceData*> merged;
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        merged.push_back(&*it);
+    }
+    std::sort(addresses.begin(), addresses.end());
+    std::sort(merged.begin(), merged.end());
+    EXPECT_EQ(addresses, merged);
+
+    // 末尾から逆向きにたどっても同じ順序であること
+    std::vector<PerformanceData> backward;
+    auto it = list.end();
+    while (it != list.begin()) {
+        --it;
+        backward.push_back(*it);
+    }
+    std::reverse(backward.begin(), backward.end());
+    EXPECT_EQ(expected, backward);
+}
+
+// 空のリストや連結で済むリストをマージするテスト
+// 期待結果: 空のリストとのマージ・末尾への連結が正しく行われ、null 比較関数や自分自身とのマージは失敗すること
+TEST(SortTest, MergeBoundaries) {
+    DoublyLinkedList<PerformanceData> list;
+    DoublyLinkedList<PerformanceData> other;
+    other.Insert(other.end(), PerformanceData{ 10, "User1" });
+    other.Insert(other.end(), PerformanceData{ 20, "User2" });
+
+    EXPECT_TRUE(list.Merge(std::move(other), SA));
+    EXPECT_EQ(2, list.Getsize());
+
+    DoublyLinkedList<PerformanceData> empty;
+    EXPECT_TRUE(list.Merge(std::move(empty), SA));
+    EXPECT_EQ(2, list.Getsize());
+
+    DoublyLinkedList<PerformanceData> after;
+    after.Insert(after.end(), PerformanceData{ 20, "User3" });
+    after.Insert(after.end(), PerformanceData{ 30, "User4" });
+    EXPECT_TRUE(list.Merge(std::move(after), SA));
+    std::vector<PerformanceData> expected = {
+        { 10, "User1" }, { 20, "User2" }, { 20, "User3" }, { 30, "User4" }
+    };
+    EXPECT_EQ(expected, ToVector(list));
+    EXPECT_EQ(30, (*--list.end()).first);
+
+    EXPECT_FALSE(list.Merge(std::move(after), nullptr));
+    EXPECT_FALSE(list.Merge(std::move(list), SA));
+    EXPECT_EQ(expected, ToVector(list));
+}
+
+// 範囲を別のリストや同じリストの中で移動するテスト
+// 期待結果: 範囲が挿入位置の前に移動し、サイズが更新されること
+TEST(SortTest, SpliceRange) {
+    DoublyLinkedList<PerformanceData> list;
+    DoublyLinkedList<PerformanceData> other;
+    for (int i = 0; i < 3; ++i) {
+        list.Insert(list.end(), PerformanceData{ i, "List" });
+    }
+    for (int i = 0; i < 5; ++i) {
+        other.Insert(other.end(), PerformanceData{ i, "Other" });
+    }
+
+    // other の 2 番目から 4 番目を list の 2 番目の前へ
+    auto first = other.begin();
+    ++first;
+    auto last = first;
+    ++last;
+    ++last;
+    ++last;
+    auto pos = list.begin();
+    ++pos;
+    EXPECT_TRUE(list.Splice(pos, other, first, last));
+    std::vector<PerformanceData> expected = {
+        { 0, "List" }, { 1, "Other" }, { 2, "Other" }, { 3, "Other" }, { 1, "List" }, { 2, "List" }
+    };
+    EXPECT_EQ(expected, ToVector(list));
+    EXPECT_EQ(6, list.Getsize());
+    std::vector<PerformanceData> rest = { { 0, "Other" }, { 4, "Other" } };
+    EXPECT_EQ(rest, ToVector(other));
+    EXPECT_EQ(2, other.Getsize());
+
+    // 同じリストの中で先頭の 2 つを末尾へ
+    auto second = list.begin();
+    ++second;
+    ++second;
+    EXPECT_TRUE(list.Splice(list.end(), list, list.begin(), second));
+    expected = {
+        { 2, "Other" }, { 3, "Other" }, { 1, "List" }, { 2, "List" }, { 0, "List" }, { 1, "Other" }
+    };
+    EXPECT_EQ(expected, ToVector(list));
+    EXPECT_EQ(6, list.Getsize());
+
+    // other の全体を list の先頭へ
+    EXPECT_TRUE(list.Splice(list.begin(), other, other.begin(), other.end()));
+    EXPECT_EQ(8, list.Getsize());
+    EXPECT_EQ(0, other.Getsize());
+    EXPECT_EQ(0, (*list.begin()).first);
+    EXPECT_EQ(1, (*--list.end()).first);
+
+    // 挿入位置が範囲内にある場合と、所属するリストが違う場合は失敗する
+    auto inside = list.begin();
+    ++inside;
+    EXPECT_FALSE(list.Splice(inside, list, list.begin(), list.end()));
+    EXPECT_FALSE(list.Splice(list.begin(), other, list.begin(), list.end()));
+    EXPECT_EQ(8, list.Getsize());
+}
+
+// アロケータを指定したリストをソートして空にするテスト
+// 期待結果: std::allocator のリストも既定のリストと同じ順序にソートされ、Clear で空になり再利用できること
+TEST(SortTest, StdAllocatorSortAndClear) {
+    DoublyLinkedList<PerformanceData, std::allocator<PerformanceData>> list;
+    for (int i = 0; i < 100; ++i) {
+        list.Insert(list.end(), PerformanceData{ (i * 37) % 100, "User" + std::to_string(i) });
+    }
+    list.Sort(SA);
+    int expected = 0;
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        EXPECT_EQ(expected++, (*it).first);
+    }
+
+    list.Clear();
+    EXPECT_EQ(0, list.Getsize());
+    EXPECT_TRUE(list.begin() == list.end());
+    list.Insert(list.end(), PerformanceData{ 1, "User" });
+    EXPECT_EQ(1, list.Getsize());
+}
+
+// アリーナを共有するリスト同士で範囲を移動してソートするテスト
+// 期待結果: 同じアリーナのリストへは Splice でき、別のアリーナのリストへは移動できないこと
+//           リストを破棄してもアリーナは残り、Release でページがまとめて返されること
+TEST(SortTest, ArenaSpliceAndSort) {
+    std::shared_ptr<Arena> arena = std::make_shared<Arena>(4096);
+    {
+        typedef DoublyLinkedList<PerformanceData, ArenaAllocator<PerformanceData>> ArenaList;
+        ArenaList list((ArenaAllocator<PerformanceData>(arena)));
+        ArenaList other((ArenaAllocator<PerformanceData>(arena)));
+        ArenaList separate;
+        for (int i = 0; i < 200; ++i) {
+            ArenaList& target = i % 2 == 0 ? list : other;
+            target.Insert(target.end(), PerformanceData{ (i * 37) % 200, "User" + std::to_string(i) });
+        }
+        separate.Insert(separate.end(), PerformanceData{ 0, "User" });
+        EXPECT_GT(arena->GetPageCount(), 1u);
+
+        EXPECT_FALSE(list.Splice(list.end(), separate, separate.begin(), separate.end()));
+        EXPECT_TRUE(list.Splice(list.end(), other, other.begin(), other.end()));
+        EXPECT_EQ(200, list.Getsize());
+        EXPECT_EQ(0, other.Getsize());
+
+        list.Sort(SA);
+        int expected = 0;
+        for (auto it = list.begin(); it != list.end(); ++it) {
+            EXPECT_EQ(expected++, (*it).first);
+        }
+    }
+    EXPECT_GT(arena->GetPageCount(), 1u);
+    arena->Release();
+    EXPECT_EQ(0u, arena->GetPageCount());
+}
+
+// デストラクタの呼び出し回数を数える要素
+struct DestructionCounter {
+    int* count; // 呼び出し回数の格納先
+
+    ~DestructionCounter() { ++*count; }
+};
+
+// アリーナのリストを Clear するテスト
+// 期待結果: SkipDestructors を指定した場合とトリビアルに破棄できる場合はノードをたどらずに空になり、
+//           それ以外は全要素のデストラクタが呼ばれること
+TEST(SortTest, ArenaClearSkipsDestructors) {
+    static_assert(SkipsDestruction<ArenaAllocator<int>>::value, "trivially destructible data needs no destruction");
+    static_assert(!SkipsDestruction<ArenaAllocator<DestructionCounter>>::value, "destructors run unless opted out");
+    static_assert(!SkipsDestruction<PoolAllocator<int>>::value, "pooled nodes are always returned");
+
+    int destroyed = 0;
+    DoublyLinkedList<DestructionCounter, ArenaAllocator<DestructionCounter>> counted;
+    DoublyLinkedList<DestructionCounter, ArenaAllocator<DestructionCounter, true>> skipped;
+    for (int i = 0; i < 10; ++i) {
+        counted.Insert(counted.end(), DestructionCounter{ &destroyed });
+        skipped.Insert(skipped.end(), DestructionCounter{ &destroyed });
+    }
+    destroyed = 0;
+
+    skipped.Clear();
+    EXPECT_EQ(0, destroyed);
+    EXPECT_EQ(0, skipped.Getsize());
+    EXPECT_TRUE(skipped.begin() == skipped.end());
+
+    counted.Clear();
+    EXPECT_EQ(10, destroyed);
+    EXPECT_EQ(0, counted.Getsize());
+
+    DoublyLinkedList<int, ArenaAllocator<int>> numbers;
+    for (int i = 0; i < 1000; ++i) {
+        numbers.Insert(numbers.end(), i);
+    }
+    numbers.Clear();
+    numbers.Insert(numbers.end(), 1);
+    EXPECT_EQ(1, numbers.Getsize());
+}
+
+// Scores.txt 形式の 1 行をデータに変換する関数
+bool ParseScore(const std::string& line, PerformanceData& data) {
+    std::istringstream iss(line);
+    return static_cast<bool>(iss >> data.first >> data.second);
+}
+
+// データを Scores.txt 形式で書き出す関数
+void FormatScore(std::ostream& out, const PerformanceData& data) {
+    out << data.first << '\t' << data.second;
+}
+
+// 出力ストリームの内容をデータの配列に戻す関数
+std::vector<PerformanceData> ParseScores(const std::string& text) {
+    std::istringstream iss(text);
+    std::vector<PerformanceData> result;
+    std::string line;
+    PerformanceData data;
+    while (std::getline(iss, line)) {
+        if (ParseScore(line, data)) {
+            result.push_back(data);
+        }
+    }
+    return result;
+}
+
+// メモリ予算の 10 倍の入力を外部ソートするテスト
+// 期待結果: 読み込むチャンクが予算内に収まり、出力が安定ソートと同じ順序になること
+TEST(SortTest, ExternalSortLargerThanBudget) {
+    const size_t budget = 64 * 1024;
+    std::ostringstream input;
+    std::vector<PerformanceData> expected;
+    std::mt19937 rng(34);
+    size_t bytes = 0;
+    for (int i = 0; bytes < 10 * budget; ++i) {
+        PerformanceData item{ static_cast<int>(rng() % 1000), "User" + std::to_string(i) };
+        std::ostringstream line;
+        FormatScore(line, item);
+        input << line.str() << '\n';
+        bytes += line.str().size() + sizeof(PerformanceData);
+        expected.push_back(item);
+    }
+    std::stable_sort(expected.begin(), expected.end(), SD);
+
+    // ファンインを小さくして多段マージも通す
+    ExternalSorter<PerformanceData> sorter(SD, ParseScore, FormatScore, budget, ".", 4);
+    std::istringstream in(input.str());
+    std::ostringstream out;
+    EXPECT_TRUE(sorter.Sort(in, out));
+    EXPECT_GE(sorter.GetRunCount(), 10u);
+    EXPECT_LE(sorter.GetPeakChunkBytes(), budget);
+    EXPECT_EQ(expected, ParseScores(out.str()));
+}
+
+// 予算に収まる入力・空の入力・変換できない行を外部ソートするテスト
+// 期待結果: 一時ファイルを使わずにソートされ、変換できない行は読み飛ばされること
+TEST(SortTest, ExternalSortSmallInput) {
+    ExternalSorter<PerformanceData> sorter(SA, ParseScore, FormatScore, 1024 * 1024);
+
+    std::istringstream empty("");
+    std::ostringstream emptyOut;
+    EXPECT_TRUE(sorter.Sort(empty, emptyOut));
+    EXPECT_EQ("", emptyOut.str());
+
+    std::istringstream in("30\tUser3\ninvalid\n10\tUser1\n20\tUser2\n");
+    std::ostringstream out;
+    EXPECT_TRUE(sorter.Sort(in, out));
+    EXPECT_EQ(0u, sorter.GetRunCount());
+    EXPECT_EQ("10\tUser1\n20\tUser2\n30\tUser3\n", out.str());
+
+    ExternalSorter<PerformanceData> invalid(nullptr, ParseScore, FormatScore, 1024);
+    std::istringstream again("1\tUser\n");
+    EXPECT_FALSE(invalid.Sort(again, out));
+}
+
+// 一時ファイルを作れないディレクトリを指定したテスト
+// 期待結果: ソートが失敗として報告されること
+TEST(SortTest, ExternalSortMissingTempDirectory) {
+    std::ostringstream input;
+    for (int i = 0; i < 1000; ++i) {
+        input << i << "\tUser" << i << '\n';
+    }
+    ExternalSorter<PerformanceData> sorter(SA, ParseScore, FormatScore, 1024, "./MissingDirectory");
+    std::istringstream in(input.str());
+    std::ostringstream out;
+    EXPECT_FALSE(sorter.Sort(in, out));
+}
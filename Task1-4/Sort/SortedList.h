@@ -0,0 +1,96 @@
+#pragma once
+#include <functional>
+#include <random>
+#include <vector>
+#include "Sort.h"
+
+// テンプレートクラス SortedDoublyLinkedList
+// 挿入しても常にソートされた状態を保つダブルリンクリスト
+// 要素は DoublyLinkedList のノードに格納し、その上にスキップリストの索引を重ねて挿入位置を O(log n) で探す
+template<typename T>
+class SortedDoublyLinkedList {
+public:
+    using Iterator = typename DoublyLinkedList<T>::Iterator;
+    using ConstIterator = typename DoublyLinkedList<T>::ConstIterator;
+
+private:
+    // 索引ノードの定義
+    struct IndexNode {
+        Iterator position; // 索引が指すリストのノード (各段の先頭の番兵では end())
+        IndexNode* next;   // 同じ段の次の索引ノード
+        IndexNode* down;   // 1 つ下の段の同じ要素の索引ノード (最下段では nullptr)
+
+        // コンストラクタ
+        // 入力: リストのノード (const Iterator&), 次の索引ノード (IndexNode*), 下の段の索引ノード (IndexNode*)
+        // 期待結果: 索引ノードが生成される
+        IndexNode(const Iterator& position, IndexNode* next, IndexNode* down);
+    };
+
+    static const int MaxLevel = 32; // 索引の最大段数
+
+    DoublyLinkedList<T> list;                         // 要素を格納するリスト
+    std::function<bool(const T&, const T&)> comp;     // 比較関数
+    std::vector<IndexNode*> heads;                    // 各段の先頭の番兵 (heads[0] がリストの 1 つ上の段)
+    std::mt19937 random;                              // 索引の段数を決める乱数
+
+    // 新しい要素の索引の段数を決める関数
+    // 戻り値: 確率 1/2 で 1 段ずつ増える段数 (0 の場合は索引を作らない)
+    int randomLevel();
+
+    // 索引をたどって、データより前にある最後の索引ノードを段ごとに求める関数
+    // 入力: データ (const T& data), 等しい要素を越えて進む場合は true (bool afterEqual), 各段の結果の格納先 (IndexNode** update)
+    // 戻り値: 最下段の結果 (索引がない場合は nullptr)
+    IndexNode* findPredecessors(const T& data, bool afterEqual, IndexNode** update);
+
+public:
+    // コンストラクタ
+    // 入力: 比較関数 (const std::function<bool(const T&, const T&)>& comp)
+    // 期待結果: 空のソート済みリストが生成される
+    explicit SortedDoublyLinkedList(const std::function<bool(const T&, const T&)>& comp);
+
+    SortedDoublyLinkedList(const SortedDoublyLinkedList&) = delete;
+    SortedDoublyLinkedList& operator=(const SortedDoublyLinkedList&) = delete;
+
+    // リストのサイズを取得
+    // 期待結果: リストのサイズが返される
+    int Getsize() const;
+
+    // 順序を保つ位置にノードを挿入
+    // 入力: 挿入するデータ (const T&)
+    // 戻り値: 挿入したノードを指すイテレータ (等しい要素の後ろに挿入される)
+    // 期待結果: 期待 O(log n) で挿入位置が見つかり、リストはソートされたまま保たれる
+    Iterator Insert(const T& data);
+
+    // ノードを削除
+    // 入力: 削除する位置のイテレータ (const Iterator&)
+    // 戻り値: 削除が成功した場合は true、失敗した場合は false
+    // 期待結果: ノードとその索引が削除される (等しい要素が多い場合はその数に比例して時間がかかる)
+    bool Delete(const Iterator& iter);
+
+    // データ以上の最初の要素を探す
+    // 入力: 探すデータ (const T&)
+    // 戻り値: 比較関数でデータより前にならない最初の要素を指すイテレータ (ない場合は end())
+    Iterator LowerBound(const T& data);
+
+    // リストの先頭を指すイテレータを取得
+    // 期待結果: 先頭ノードを指すイテレータが返される (イテレータ経由で順序が変わるように書き換えないこと)
+    Iterator begin();
+
+    // リストの先頭を指す定数イテレータを取得
+    // 期待結果: 先頭ノードを指す定数イテレータが返される
+    ConstIterator beginConst() const;
+
+    // リストの末尾を指すイテレータを取得
+    // 期待結果: nullptrを指すイテレータが返される
+    Iterator end();
+
+    // リストの末尾を指す定数イテレータを取得
+    // 期待結果: nullptrを指す定数イテレータが返される
+    ConstIterator endConst() const;
+
+    // デストラクタ
+    // 期待結果: 全ての索引ノードとリストのノードが解放される
+    ~SortedDoublyLinkedList();
+};
+
+#include "SortedList.inl"
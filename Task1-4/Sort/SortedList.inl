@@ -0,0 +1,182 @@
+// 索引ノードのコンストラクタ
+// 引数: const Iterator& position - 索引が指すリストのノード
+//       IndexNode* next - 同じ段の次の索引ノード
+//       IndexNode* down - 1 つ下の段の索引ノード
+// 期待結果: 索引ノードが初期化される
+template<typename T>
+SortedDoublyLinkedList<T>::IndexNode::IndexNode(const Iterator& position, IndexNode* next, IndexNode* down)
+    : position(position), next(next), down(down) {}
+
+// SortedDoublyLinkedList のコンストラクタ
+// 引数: const std::function<bool(const T&, const T&)>& comp - 比較関数
+// 期待結果: 空のソート済みリストが初期化される
+template<typename T>
+SortedDoublyLinkedList<T>::SortedDoublyLinkedList(const std::function<bool(const T&, const T&)>& comp)
+    : list(), comp(comp), heads(), random(std::random_device()()) {}
+
+// 新しい要素の索引の段数を決める関数
+// 戻り値: 確率 1/2 で 1 段ずつ増える段数
+template<typename T>
+int SortedDoublyLinkedList<T>::randomLevel() {
+    int level = 0;
+    while (level < MaxLevel && (random() & 1) != 0) {
+        ++level;
+    }
+    return level;
+}
+
+// 索引をたどって、データより前にある最後の索引ノードを段ごとに求める関数
+// 引数: const T& data - データ
+//       bool afterEqual - true の場合はデータと等しい索引ノードも越えて進む
+//       IndexNode** update - 各段の結果の格納先
+// 戻り値: 最下段の結果 (索引がない場合は nullptr)
+template<typename T>
+typename SortedDoublyLinkedList<T>::IndexNode* SortedDoublyLinkedList<T>::findPredecessors(const T& data, bool afterEqual, IndexNode** update) {
+    if (heads.empty()) return nullptr;
+
+    IndexNode* current = heads.back();
+    for (int level = static_cast<int>(heads.size()) - 1; level >= 0; --level) {
+        while (current->next != nullptr &&
+            (afterEqual ? !comp(data, *current->next->position) : comp(*current->next->position, data))) {
+            current = current->next;
+        }
+        update[level] = current;
+        if (level > 0) {
+            current = current->down;
+        }
+    }
+    return current;
+}
+
+// リストのサイズを取得する関数
+// 戻り値: リストのサイズ
+template<typename T>
+int SortedDoublyLinkedList<T>::Getsize() const {
+    return list.Getsize();
+}
+
+// 順序を保つ位置にノードを挿入
+// 入力: 挿入するデータ (const T&)
+// 戻り値: 挿入したノードを指すイテレータ
+template<typename T>
+typename SortedDoublyLinkedList<T>::Iterator SortedDoublyLinkedList<T>::Insert(const T& data) {
+    IndexNode* update[MaxLevel];
+    IndexNode* predecessor = findPredecessors(data, true, update);
+
+    // 索引で見つけたノードから、データ以下の要素をリスト上でたどる
+    Iterator position = (predecessor == nullptr || predecessor == heads[0]) ? list.begin() : predecessor->position;
+    while (position != list.end() && !comp(data, *position)) {
+        ++position;
+    }
+    list.Insert(position, data);
+    Iterator inserted = position;
+    --inserted;
+
+    // 段数が足りなければ番兵を追加する
+    int level = randomLevel();
+    while (static_cast<int>(heads.size()) < level) {
+        IndexNode* below = heads.empty() ? nullptr : heads.back();
+        heads.push_back(new IndexNode(list.end(), nullptr, below));
+        update[heads.size() - 1] = heads.back();
+    }
+
+    // 下の段から順に索引ノードをつなぐ
+    IndexNode* below = nullptr;
+    for (int i = 0; i < level; ++i) {
+        IndexNode* node = new IndexNode(inserted, update[i]->next, below);
+        update[i]->next = node;
+        below = node;
+    }
+    return inserted;
+}
+
+// ノードを削除
+// 入力: 削除する位置のイテレータ (const Iterator&)
+// 戻り値: 削除が成功した場合は true、失敗した場合は false
+template<typename T>
+bool SortedDoublyLinkedList<T>::Delete(const Iterator& iter) {
+    Iterator position = iter;
+    if (position == list.end()) return false;
+
+    // 等しい要素の索引の中から、同じノードを指すものを段ごとに外す
+    const T& data = *position;
+    IndexNode* update[MaxLevel];
+    findPredecessors(data, false, update);
+    for (int level = static_cast<int>(heads.size()) - 1; level >= 0; --level) {
+        IndexNode* current = update[level];
+        while (current->next != nullptr && !comp(data, *current->next->position)) {
+            if (current->next->position == position) {
+                IndexNode* removed = current->next;
+                current->next = removed->next;
+                delete removed;
+                break;
+            }
+            current = current->next;
+        }
+    }
+
+    // 空になった上の段を取り除く
+    while (!heads.empty() && heads.back()->next == nullptr) {
+        delete heads.back();
+        heads.pop_back();
+    }
+
+    return list.Delete(position);
+}
+
+// データ以上の最初の要素を探す
+// 入力: 探すデータ (const T&)
+// 戻り値: 比較関数でデータより前にならない最初の要素を指すイテレータ
+template<typename T>
+typename SortedDoublyLinkedList<T>::Iterator SortedDoublyLinkedList<T>::LowerBound(const T& data) {
+    IndexNode* update[MaxLevel];
+    IndexNode* predecessor = findPredecessors(data, false, update);
+
+    Iterator position = (predecessor == nullptr || predecessor == heads[0]) ? list.begin() : predecessor->position;
+    while (position != list.end() && comp(*position, data)) {
+        ++position;
+    }
+    return position;
+}
+
+// リストの先頭を指すイテレータを取得
+// 期待結果: 先頭ノードを指すイテレータが返される
+template<typename T>
+typename SortedDoublyLinkedList<T>::Iterator SortedDoublyLinkedList<T>::begin() {
+    return list.begin();
+}
+
+// リストの先頭を指す定数イテレータを取得
+// 期待結果: 先頭ノードを指す定数イテレータが返される
+template<typename T>
+typename SortedDoublyLinkedList<T>::ConstIterator SortedDoublyLinkedList<T>::beginConst() const {
+    return list.beginConst();
+}
+
+// リストの末尾を指すイテレータを取得
+// 期待結果: nullptrを指すイテレータが返される
+template<typename T>
+typename SortedDoublyLinkedList<T>::Iterator SortedDoublyLinkedList<T>::end() {
+    return list.end();
+}
+
+// リストの末尾を指す定数イテレータを取得
+// 期待結果: nullptrを指す定数イテレータが返される
+template<typename T>
+typename SortedDoublyLinkedList<T>::ConstIterator SortedDoublyLinkedList<T>::endConst() const {
+    return list.endConst();
+}
+
+// SortedDoublyLinkedList のデストラクタ
+// 期待結果: 全ての索引ノードが解放される (リストのノードはリストのデストラクタで解放される)
+template<typename T>
+SortedDoublyLinkedList<T>::~SortedDoublyLinkedList() {
+    for (IndexNode* head : heads) {
+        IndexNode* current = head;
+        while (current != nullptr) {
+            IndexNode* next = current->next;
+            delete current;
+            current = next;
+        }
+    }
+}
@@ -0,0 +1,132 @@
+#include "TaskPool.h"
+
+namespace {
+    // 現在のスレッドが所属するプールとキュー番号
+    thread_local const TaskPool* currentPool = nullptr;
+    thread_local size_t currentIndex = 0;
+}
+
+// TaskGroup のコンストラクタ
+// 期待結果: 未完了のタスクがないグループが生成される
+TaskGroup::TaskGroup() : pending(0) {}
+
+// TaskPool のコンストラクタ
+// 引数: unsigned threadCount - Wait を呼ぶスレッドを含めたスレッド数 (0 の場合はハードウェアのスレッド数)
+// 期待結果: threadCount - 1 個のワーカースレッドが起動する
+TaskPool::TaskPool(unsigned threadCount) : queued(0), stop(false) {
+    if (threadCount == 0) {
+        threadCount = std::thread::hardware_concurrency();
+    }
+    if (threadCount == 0) {
+        threadCount = 1;
+    }
+
+    for (unsigned i = 0; i < threadCount; ++i) {
+        queues.push_back(std::unique_ptr<WorkerQueue>(new WorkerQueue()));
+    }
+    for (unsigned i = 1; i < threadCount; ++i) {
+        workers.emplace_back(&TaskPool::workerLoop, this, i);
+    }
+}
+
+// 呼び出し元スレッドのキュー番号を取得する関数
+// 戻り値: ワーカースレッドなら自分のキュー番号、それ以外は 0
+size_t TaskPool::currentQueue() const {
+    return currentPool == this ? currentIndex : 0;
+}
+
+// タスクを 1 つ取り出して実行する関数
+// 引数: size_t self - 自分のキュー番号
+// 戻り値: タスクを実行した場合は true、どのキューも空だった場合は false
+// 期待結果: 自分のキューの末尾 (最後に積んだタスク) を優先し、空なら他のキューの先頭から盗む
+bool TaskPool::tryRunOne(size_t self) {
+    Task task;
+    bool found = false;
+
+    for (size_t i = 0; i < queues.size() && !found; ++i) {
+        WorkerQueue& queue = *queues[(self + i) % queues.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty()) continue;
+
+        if (i == 0) {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+        }
+        else {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+        }
+        found = true;
+    }
+    if (!found) return false;
+
+    queued--;
+    task.function();
+    task.group->pending--;
+    return true;
+}
+
+// ワーカースレッドの処理
+// 引数: size_t index - 自分のキュー番号
+// 期待結果: 終了要求があるまでタスクを実行し続ける
+void TaskPool::workerLoop(size_t index) {
+    currentPool = this;
+    currentIndex = index;
+
+    while (true) {
+        if (tryRunOne(index)) continue;
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        wakeUp.wait(lock, [this] { return stop || queued > 0; });
+        if (stop && queued == 0) return;
+    }
+}
+
+// タスクを追加する関数
+// 引数: TaskGroup& group - 所属するグループ
+//       std::function<void()> function - 実行する処理
+// 期待結果: タスクが呼び出し元スレッドのキューに積まれ、いずれかのスレッドで実行される
+void TaskPool::Run(TaskGroup& group, std::function<void()> function) {
+    group.pending++;
+    {
+        WorkerQueue& queue = *queues[currentQueue()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(Task{ std::move(function), &group });
+    }
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        queued++;
+    }
+    wakeUp.notify_one();
+}
+
+// グループのタスクの完了を待つ関数
+// 引数: TaskGroup& group - 待つグループ
+// 期待結果: 待っている間も他のタスクを実行し、グループの全タスクが完了すると戻る
+void TaskPool::Wait(TaskGroup& group) {
+    size_t self = currentQueue();
+    while (group.pending > 0) {
+        if (!tryRunOne(self)) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+// 並列に実行するスレッド数を取得する関数
+// 戻り値: Wait を呼ぶスレッドを含めたスレッド数
+unsigned TaskPool::GetThreadCount() const {
+    return static_cast<unsigned>(queues.size());
+}
+
+// TaskPool のデストラクタ
+// 期待結果: 全てのワーカースレッドが終了する
+TaskPool::~TaskPool() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stop = true;
+    }
+    wakeUp.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
@@ -0,0 +1,94 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class TaskPool;
+
+// タスクグループクラス
+// まとめて完了を待つタスクの集まり
+class TaskGroup {
+private:
+    std::atomic<int> pending; // 未完了のタスク数
+
+    friend class TaskPool;
+
+public:
+    // コンストラクタ
+    // 期待結果: 未完了のタスクがないグループが生成される
+    TaskGroup();
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+};
+
+// ワークスティーリング方式のタスクプール
+// スレッドごとにタスクの両端キューを持ち、自分のキューは末尾から、他のスレッドのキューは先頭から取り出す
+// タスク内から Run / Wait を呼び出して分割統治 (fork-join) できる
+class TaskPool {
+private:
+    // 実行するタスク
+    struct Task {
+        std::function<void()> function; // 実行する処理
+        TaskGroup* group;               // 所属するグループ
+    };
+
+    // スレッドごとのタスクキュー
+    struct WorkerQueue {
+        std::mutex mutex;        // キューを保護するミューテックス
+        std::deque<Task> tasks;  // タスクの両端キュー
+    };
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues; // キュー (0 番はプール外のスレッド用)
+    std::vector<std::thread> workers;                 // ワーカースレッド
+    std::mutex sleepMutex;                            // 待機用のミューテックス
+    std::condition_variable wakeUp;                   // タスク追加を通知する条件変数
+    std::atomic<int> queued;                          // キューに積まれているタスク数
+    bool stop;                                        // 終了要求
+
+    // 呼び出し元スレッドのキュー番号を取得する関数
+    // 戻り値: ワーカースレッドなら自分のキュー番号、それ以外は 0
+    size_t currentQueue() const;
+
+    // タスクを 1 つ取り出して実行する関数
+    // 入力: 自分のキュー番号 (size_t self)
+    // 戻り値: タスクを実行した場合は true、どのキューも空だった場合は false
+    bool tryRunOne(size_t self);
+
+    // ワーカースレッドの処理
+    // 入力: 自分のキュー番号 (size_t index)
+    // 期待結果: 終了要求があるまでタスクを実行し続ける
+    void workerLoop(size_t index);
+
+public:
+    // コンストラクタ
+    // 入力: 並列に実行するスレッド数 (unsigned threadCount) - Wait を呼ぶスレッドも含む。0 の場合はハードウェアのスレッド数
+    // 期待結果: threadCount - 1 個のワーカースレッドが起動する
+    explicit TaskPool(unsigned threadCount);
+
+    TaskPool(const TaskPool&) = delete;
+    TaskPool& operator=(const TaskPool&) = delete;
+
+    // タスクを追加する関数
+    // 入力: 所属するグループ (TaskGroup& group), 実行する処理 (std::function<void()> function)
+    // 期待結果: タスクが呼び出し元スレッドのキューに積まれ、いずれかのスレッドで実行される
+    void Run(TaskGroup& group, std::function<void()> function);
+
+    // グループのタスクの完了を待つ関数
+    // 入力: 待つグループ (TaskGroup& group)
+    // 期待結果: 待っている間も他のタスクを実行し、グループの全タスクが完了すると戻る
+    void Wait(TaskGroup& group);
+
+    // 並列に実行するスレッド数を取得する関数
+    // 戻り値: Wait を呼ぶスレッドを含めたスレッド数
+    unsigned GetThreadCount() const;
+
+    // デストラクタ
+    // 期待結果: 全てのワーカースレッドが終了する (未実行のタスクは全て実行してから終了する)
+    ~TaskPool();
+};
@@ -0,0 +1,568 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../Sort/Sort.h"
+#include "../Sort/SortedList.h"
+
+using PerformanceData = std::pair<int, std::string>;
+
+// 降順でスコアを比較する関数
+// 入力: PerformanceData 型の a と b
+inline bool SD(const PerformanceData& a, const PerformanceData& b) {
+    return a.first > b.first;
+}
+
+// ランダムなスコアを作る関数
+// 入力: 要素数 (int count), 乱数の種 (unsigned seed)
+// 戻り値: ランダムなスコアとユーザー名の配列
+std::vector<PerformanceData> MakeScores(int count, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> score(0, 1000000);
+    std::vector<PerformanceData> data;
+    data.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        data.push_back(PerformanceData{ score(rng), "User" + std::to_string(i) });
+    }
+    return data;
+}
+
+// 配列の内容をリストに挿入する関数
+// 入力: 挿入するデータ (const std::vector<PerformanceData>&), DoublyLinkedList<PerformanceData>& 型のリスト
+void FillList(const std::vector<PerformanceData>& data, DoublyLinkedList<PerformanceData>& list) {
+    for (const PerformanceData& item : data) {
+        list.Insert(list.end(), item);
+    }
+}
+
+// 処理時間を計る関数
+// 入力: 計測する処理 (Function function)
+// 戻り値: 処理時間 (ミリ秒)
+template<typename Function>
+double MeasureMilliseconds(Function function) {
+    auto start = std::chrono::steady_clock::now();
+    function();
+    auto finish = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(finish - start).count();
+}
+
+// 計測用の要素
+// コピー・ムーブの回数を数える
+struct BenchItem {
+    int key;
+
+    BenchItem(int key = 0) : key(key) {}
+    BenchItem(const BenchItem& other);
+    BenchItem(BenchItem&& other);
+    BenchItem& operator=(const BenchItem& other);
+    BenchItem& operator=(BenchItem&& other);
+};
+
+// 比較回数の上限を超えたことを知らせる例外
+struct ComparisonBudgetExceeded {};
+
+// ソート中の計測値
+std::atomic<long long> comparisonCount(0);    // 比較回数
+std::atomic<long long> moveCount(0);          // コピー・ムーブの回数
+long long comparisonBudget = LLONG_MAX;       // これを超えた比較は打ち切る
+std::thread::id measuringThread;              // スタックの深さを測るスレッド
+std::uintptr_t lowestStack = UINTPTR_MAX;     // 観測した最も深いスタックのアドレス
+
+BenchItem::BenchItem(const BenchItem& other) : key(other.key) {
+    moveCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+BenchItem::BenchItem(BenchItem&& other) : key(other.key) {
+    moveCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+BenchItem& BenchItem::operator=(const BenchItem& other) {
+    key = other.key;
+    moveCount.fetch_add(1, std::memory_order_relaxed);
+    return *this;
+}
+
+BenchItem& BenchItem::operator=(BenchItem&& other) {
+    key = other.key;
+    moveCount.fetch_add(1, std::memory_order_relaxed);
+    return *this;
+}
+
+// 比較回数とスタックの深さを記録しながら昇順で比較する関数
+// 入力: BenchItem 型の a と b
+// 期待結果: 上限を超えた場合は ComparisonBudgetExceeded を投げる
+bool CountedLess(const BenchItem& a, const BenchItem& b) {
+    if (comparisonCount.fetch_add(1, std::memory_order_relaxed) >= comparisonBudget) {
+        throw ComparisonBudgetExceeded();
+    }
+    if (std::this_thread::get_id() == measuringThread) {
+        // スタックは下位アドレスに向かって伸びるので、最も小さいアドレスが最も深い
+        char probe = 0;
+        std::uintptr_t address = reinterpret_cast<std::uintptr_t>(&probe);
+        lowestStack = std::min(lowestStack, address);
+    }
+    return a.key < b.key;
+}
+
+// 要素のキーを取り出す関数
+// 入力: BenchItem 型の a
+inline long long ItemKey(const BenchItem& a) {
+    return a.key;
+}
+
+// O(n log n) のソートとして許す比較回数の上限を求める関数
+// 入力: 要素数 (int count)
+// 戻り値: 16 n log2 n + 1000 回
+long long ComparisonBudget(int count) {
+    return static_cast<long long>(16.0 * count * std::log2(std::max(count, 2))) + 1000;
+}
+
+// Sort を狙い撃ちにする入力を作る関数
+// McIlroy の "A Killer Adversary for Quicksort" の方法で、比較されるまで値を決めずにおき、
+// ピボット候補になった要素から順に小さい値に確定させる
+// 入力: 要素数 (int count)
+// 戻り値: 各位置のキー
+std::vector<int> MakeQuicksortKiller(int count) {
+    const int gas = count; // 未確定の値 (どの確定値よりも大きい)
+    std::vector<int> values(count, gas);
+    int solid = 0;
+    int candidate = 0;
+
+    DoublyLinkedList<int> list;
+    for (int i = 0; i < count; ++i) {
+        list.Insert(list.end(), i);
+    }
+
+    long long comparisons = 0;
+    long long budget = ComparisonBudget(count);
+    try {
+        list.Sort([&](const int& x, const int& y) {
+            if (++comparisons > budget) {
+                throw ComparisonBudgetExceeded();
+            }
+            if (values[x] == gas && values[y] == gas) {
+                values[x == candidate ? x : y] = solid++;
+            }
+            if (values[x] == gas) {
+                candidate = x;
+            }
+            else if (values[y] == gas) {
+                candidate = y;
+            }
+            return values[x] < values[y];
+        });
+    }
+    catch (const ComparisonBudgetExceeded&) {
+        // 上限まで比較できれば十分に偏った入力になっている
+    }
+
+    for (int& value : values) {
+        if (value == gas) {
+            value = solid++;
+        }
+    }
+    return values;
+}
+
+// 入力パターンを作る関数
+// 入力: パターン名 (const std::string& pattern), 要素数 (int count)
+// 戻り値: 各位置のキー
+std::vector<int> GeneratePattern(const std::string& pattern, int count) {
+    std::mt19937 rng(42);
+    std::vector<int> keys(count);
+    int period = std::max(2, static_cast<int>(std::sqrt(static_cast<double>(count))));
+
+    if (pattern == "killer") {
+        return MakeQuicksortKiller(count);
+    }
+    for (int i = 0; i < count; ++i) {
+        if (pattern == "random") {
+            keys[i] = std::uniform_int_distribution<int>(0, count)(rng);
+        }
+        else if (pattern == "sorted") {
+            keys[i] = i;
+        }
+        else if (pattern == "reversed") {
+            keys[i] = count - i;
+        }
+        else if (pattern == "reversed-ties") {
+            keys[i] = (count - i) / 4; // 同じスコアを含む降順 (昇順にソートしたリストを降順でソートし直す場合と同じ)
+        }
+        else if (pattern == "reversed-pairs") {
+            keys[i] = count - (i ^ 1); // ランが短く、クイックソートで処理される逆順に近い並び
+        }
+        else if (pattern == "organ-pipe") {
+            keys[i] = i < count / 2 ? i : count - i;
+        }
+        else if (pattern == "sawtooth") {
+            keys[i] = i % period;
+        }
+        else if (pattern == "all-equal") {
+            keys[i] = 0;
+        }
+        else if (pattern == "duplicates") {
+            keys[i] = std::uniform_int_distribution<int>(0, 15)(rng);
+        }
+    }
+    return keys;
+}
+
+// 計測するソート方式
+struct SortStrategy {
+    std::string name;                                              // 表示名
+    bool usesComparator;                                           // 比較関数を使う場合は true
+    bool bounded;                                                  // 最悪 O(n^2) のため比較回数に上限を設ける場合は true
+    std::function<void(DoublyLinkedList<BenchItem>&)> run;         // ソートを実行する関数
+};
+
+// 1 つのパターン・要素数・方式を計測して表示する関数
+// 入力: パターン名, 各位置のキー, ソート方式
+// 期待結果: 要素あたりの時間、比較回数、コピー・ムーブ回数、最大スタック使用量 (バイト) を 1 行で表示する
+void RunStrategy(const std::string& pattern, const std::vector<int>& keys, const SortStrategy& strategy) {
+    const int count = static_cast<int>(keys.size());
+    DoublyLinkedList<BenchItem> list;
+    for (int key : keys) {
+        list.Insert(list.end(), BenchItem(key));
+    }
+
+    comparisonCount = 0;
+    moveCount = 0;
+    comparisonBudget = strategy.bounded ? ComparisonBudget(count) : LLONG_MAX;
+    measuringThread = std::this_thread::get_id();
+    char base = 0;
+    lowestStack = reinterpret_cast<std::uintptr_t>(&base);
+
+    bool aborted = false;
+    double elapsed = MeasureMilliseconds([&] {
+        try {
+            strategy.run(list);
+        }
+        catch (const ComparisonBudgetExceeded&) {
+            aborted = true;
+        }
+    });
+    long long comparisons = comparisonCount;
+    long long moves = moveCount;
+    std::uintptr_t stack = reinterpret_cast<std::uintptr_t>(&base) - lowestStack;
+
+    // 結果が昇順になっているか確かめる (計測値には含めない)
+    bool sorted = true;
+    int previous = INT_MIN;
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        sorted = sorted && previous <= (*it).key;
+        previous = (*it).key;
+    }
+
+    std::cout << pattern << "\t" << count << "\t" << strategy.name << "\t";
+    if (aborted) {
+        std::cout << "quadratic (> " << ComparisonBudget(count) << " comparisons)";
+    }
+    else {
+        std::cout << std::fixed << std::setprecision(2) << elapsed * 1e6 / count << "\t";
+        // 比較関数を使わない方式では比較回数とスタックの深さは測れない
+        if (strategy.usesComparator) {
+            std::cout << comparisons << "\t" << moves << "\t" << stack;
+        }
+        else {
+            std::cout << "-\t" << moves << "\t-";
+        }
+        std::cout << (sorted ? "" : "\tNOT SORTED");
+    }
+    std::cout << std::endl;
+}
+
+// ソート方式を入力パターンと要素数ごとに比較する関数
+// 入力: 最大の要素数 (int maxCount), 計測するパターン (const std::string& only、空の場合は全て)
+// 期待結果: 100 から maxCount まで 10 倍ずつ、全てのパターンと方式の計測結果を表示する
+void RunSuite(int maxCount, const std::string& only) {
+    const char* patterns[] = { "random", "sorted", "reversed", "reversed-ties", "reversed-pairs", "organ-pipe", "sawtooth", "all-equal", "duplicates", "killer" };
+    std::vector<SortStrategy> strategies = {
+        { "Sort", true, true, [](DoublyLinkedList<BenchItem>& list) { list.Sort(CountedLess); } },
+        { "Sort(Sequential)", true, false, [](DoublyLinkedList<BenchItem>& list) { list.Sort(CountedLess, ExecutionPolicy::Sequential); } },
+        { "Sort(Parallel)", true, false, [](DoublyLinkedList<BenchItem>& list) { list.Sort(CountedLess, ExecutionPolicy::Parallel); } },
+        { "SortBy", false, false, [](DoublyLinkedList<BenchItem>& list) { list.SortBy({ SortKey<BenchItem>::Integer(ItemKey) }); } },
+    };
+
+    std::cout << "pattern\tsize\tstrategy\tns/element\tcomparisons\tmoves\tstack bytes" << std::endl;
+    for (const char* pattern : patterns) {
+        if (!only.empty() && only != pattern) continue;
+        for (long long count = 100; count <= maxCount; count *= 10) {
+            std::vector<int> keys = GeneratePattern(pattern, static_cast<int>(count));
+            for (const SortStrategy& strategy : strategies) {
+                RunStrategy(pattern, keys, strategy);
+            }
+        }
+    }
+}
+
+// 並列ソートのスケーリングを計測する関数
+// 入力: 要素数 (int count)
+// 期待結果: 1 スレッドからハードウェアのスレッド数まで、ソート時間と 1 スレッドに対する速度向上率を表示する
+void BenchmarkParallelScaling(int count) {
+    unsigned maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<unsigned> threadCounts;
+    for (unsigned threads = 1; threads < maxThreads; threads *= 2) {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(maxThreads);
+
+    std::vector<PerformanceData> data = MakeScores(count, 1);
+    std::cout << "Parallel Sort Scaling (" << count << " elements)" << std::endl;
+    std::cout << "threads\tms\tspeedup" << std::endl;
+
+    double baseline = 0.0;
+    for (unsigned threads : threadCounts) {
+        DoublyLinkedList<PerformanceData> list;
+        FillList(data, list);
+        double elapsed = MeasureMilliseconds([&] { list.Sort(SD, ExecutionPolicy::Parallel, threads); });
+        if (threads == 1) {
+            baseline = elapsed;
+        }
+        std::cout << threads << "\t" << std::fixed << std::setprecision(1) << elapsed
+            << "\t" << std::setprecision(2) << baseline / elapsed << std::endl;
+    }
+}
+
+// 先頭 k 個の取得を全体のソートと比較する関数
+// 入力: 要素数 (int count)
+// 期待結果: k = 10 から 10000 まで、TopK・PartialSort・Sort 後に k 個たどる方法の処理時間を表示する
+void BenchmarkPartialSort(int count) {
+    std::vector<PerformanceData> data = MakeScores(count, 2);
+    std::cout << "Top-K vs Full Sort (" << count << " elements)" << std::endl;
+
+    // 全体のソートは k に依存しないので 1 回だけ計る
+    double fullSort;
+    {
+        DoublyLinkedList<PerformanceData> list;
+        FillList(data, list);
+        fullSort = MeasureMilliseconds([&] { list.Sort(SD); });
+    }
+
+    DoublyLinkedList<PerformanceData> source;
+    FillList(data, source);
+
+    std::cout << "k\tTopK ms\tPartialSort ms\tSort ms" << std::endl;
+    for (int k = 10; k <= 10000; k *= 10) {
+        double topK = MeasureMilliseconds([&] { source.TopK(k, SD); });
+
+        DoublyLinkedList<PerformanceData> list;
+        FillList(data, list);
+        double partial = MeasureMilliseconds([&] { list.PartialSort(k, SD); });
+
+        std::cout << k << "\t" << std::fixed << std::setprecision(1) << topK
+            << "\t" << partial << "\t" << fullSort << std::endl;
+    }
+}
+
+// スコアを 1 件ずつ追加しながら順序を保つ処理を計測する関数
+// 入力: 最初の要素数 (int count), 追加する件数 (int updates)
+// 期待結果: ソート済みリストへの挿入と、末尾に挿入してからソートし直す方法の 1 件あたりの処理時間を表示する
+void BenchmarkStreamingInsert(int count, int updates) {
+    std::vector<PerformanceData> data = MakeScores(count + updates, 3);
+    std::cout << "Streaming Score Updates (" << count << " elements, " << updates << " updates)" << std::endl;
+
+    SortedDoublyLinkedList<PerformanceData> sorted(SD);
+    for (int i = 0; i < count; ++i) {
+        sorted.Insert(data[i]);
+    }
+    double sortedInsert = MeasureMilliseconds([&] {
+        for (int i = count; i < count + updates; ++i) {
+            sorted.Insert(data[i]);
+        }
+    });
+
+    DoublyLinkedList<PerformanceData> list;
+    FillList(std::vector<PerformanceData>(data.begin(), data.begin() + count), list);
+    list.Sort(SD, ExecutionPolicy::Sequential);
+    double resort = MeasureMilliseconds([&] {
+        for (int i = count; i < count + updates; ++i) {
+            list.Insert(list.end(), data[i]);
+            list.Sort(SD, ExecutionPolicy::Sequential);
+        }
+    });
+
+    std::cout << "method\tus/update" << std::endl;
+    std::cout << "SortedDoublyLinkedList::Insert\t" << std::fixed << std::setprecision(3) << sortedInsert * 1000.0 / updates << std::endl;
+    std::cout << "Insert + Sort\t" << resort * 1000.0 / updates << std::endl;
+}
+
+// ソート済みのシャードを 1 本にまとめる処理を計測する関数
+// 入力: シャードごとの要素数 (int count), シャード数 (int shards)
+// 期待結果: 1 件ずつ挿入してからソートし直す方法と、Merge で順に・2 本ずつまとめる方法の処理時間を表示する
+void BenchmarkShardMerge(int count, int shards) {
+    std::cout << "Merge Sorted Shards (" << shards << " shards x " << count << " elements)" << std::endl;
+
+    // シャードを作ってソートしておく (計測には含めない)
+    auto makeShards = [count, shards] {
+        std::vector<DoublyLinkedList<PerformanceData>*> lists;
+        for (int i = 0; i < shards; ++i) {
+            lists.push_back(new DoublyLinkedList<PerformanceData>());
+            FillList(MakeScores(count, 100 + i), *lists.back());
+            lists.back()->Sort(SD, ExecutionPolicy::Sequential);
+        }
+        return lists;
+    };
+    auto destroy = [](std::vector<DoublyLinkedList<PerformanceData>*>& lists) {
+        for (DoublyLinkedList<PerformanceData>* list : lists) {
+            delete list;
+        }
+        lists.clear();
+    };
+
+    std::cout << "method\tms" << std::endl;
+    {
+        std::vector<DoublyLinkedList<PerformanceData>*> lists = makeShards();
+        DoublyLinkedList<PerformanceData> result;
+        double elapsed = MeasureMilliseconds([&] {
+            for (DoublyLinkedList<PerformanceData>* list : lists) {
+                for (auto it = list->begin(); it != list->end(); ++it) {
+                    result.Insert(result.end(), *it);
+                }
+            }
+            result.Sort(SD, ExecutionPolicy::Sequential);
+        });
+        destroy(lists);
+        std::cout << "Insert + Sort\t" << std::fixed << std::setprecision(1) << elapsed << std::endl;
+    }
+    {
+        std::vector<DoublyLinkedList<PerformanceData>*> lists = makeShards();
+        DoublyLinkedList<PerformanceData> result;
+        double elapsed = MeasureMilliseconds([&] {
+            for (DoublyLinkedList<PerformanceData>* list : lists) {
+                result.Merge(std::move(*list), SD);
+            }
+        });
+        destroy(lists);
+        std::cout << "Merge (one by one)\t" << elapsed << std::endl;
+    }
+    {
+        std::vector<DoublyLinkedList<PerformanceData>*> lists = makeShards();
+        double elapsed = MeasureMilliseconds([&] {
+            for (size_t width = 1; width < lists.size(); width *= 2) {
+                for (size_t i = 0; i + width < lists.size(); i += 2 * width) {
+                    lists[i]->Merge(std::move(*lists[i + width]), SD);
+                }
+            }
+        });
+        destroy(lists);
+        std::cout << "Merge (pairwise)\t" << elapsed << std::endl;
+    }
+}
+
+// ノードの確保・解放を繰り返す処理を計測する関数
+// 入力: 表示名 (const std::string& name), 要素数 (int count), 要素を作る関数 (MakeItem makeItem)
+// 期待結果: 末尾への挿入、先頭の削除と末尾への挿入の繰り返し、Clear の 1 要素あたりの時間 (ナノ秒) を表示する
+template<typename List, typename MakeItem>
+void MeasureChurn(const std::string& name, int count, MakeItem makeItem) {
+    List list;
+    double build = MeasureMilliseconds([&] {
+        for (int i = 0; i < count; ++i) {
+            list.Insert(list.end(), makeItem(i));
+        }
+    });
+    double churn = MeasureMilliseconds([&] {
+        for (int i = 0; i < count; ++i) {
+            list.Delete(list.begin());
+            list.Insert(list.end(), makeItem(i));
+        }
+    });
+    double clear = MeasureMilliseconds([&] {
+        list.Clear();
+    });
+    std::cout << name << "\t" << std::fixed << std::setprecision(1) << build * 1000000.0 / count << "\t" << churn * 1000000.0 / count
+        << "\t" << clear * 1000000.0 / count << std::endl;
+}
+
+// 既定のアロケータ (NodePool) と std::allocator のノードの確保・解放を比較する関数
+// 入力: 要素数 (int count)
+// 期待結果: int と PerformanceData のリストごとに、両方のアロケータの結果を表示する
+void BenchmarkAllocationChurn(int count) {
+    std::cout << "Allocation Churn (" << count << " elements)" << std::endl;
+    std::cout << "list\tinsert ns\tdelete+insert ns\tclear ns" << std::endl;
+    auto makeInt = [](int i) { return i; };
+    auto makeData = [](int i) { return PerformanceData{ i, "User" }; };
+    MeasureChurn<DoublyLinkedList<int, std::allocator<int>>>("int std::allocator", count, makeInt);
+    MeasureChurn<DoublyLinkedList<int>>("int NodePool", count, makeInt);
+    MeasureChurn<DoublyLinkedList<PerformanceData, std::allocator<PerformanceData>>>("PerformanceData std::allocator", count, makeData);
+    MeasureChurn<DoublyLinkedList<PerformanceData>>("PerformanceData NodePool", count, makeData);
+}
+
+// リストの構築と破棄を計測する関数
+// 入力: 表示名 (const std::string& name), 要素数 (int count), 要素を作る関数 (MakeItem makeItem)
+// 期待結果: 末尾への挿入で count 要素のリストを作る時間と、リストを破棄する時間 (ミリ秒) を表示する
+template<typename List, typename MakeItem>
+void MeasureTeardown(const std::string& name, int count, MakeItem makeItem) {
+    std::unique_ptr<List> list(new List());
+    double build = MeasureMilliseconds([&] {
+        for (int i = 0; i < count; ++i) {
+            list->Insert(list->end(), makeItem(i));
+        }
+    });
+    double teardown = MeasureMilliseconds([&] {
+        list.reset();
+    });
+    std::cout << name << "\t" << std::fixed << std::setprecision(1) << build << "\t" << teardown << std::endl;
+}
+
+// アロケータごとのリストの破棄時間を比較する関数
+// 入力: 要素数 (int count)
+// 期待結果: std::allocator、NodePool、ArenaAllocator のリストの構築と破棄の時間を表示する
+//           PerformanceData の名前は短い文字列 (ヒープを使わない) にし、デストラクタを省略しても資源が漏れないようにする
+void BenchmarkTeardown(int count) {
+    std::cout << "Build and Teardown (" << count << " elements)" << std::endl;
+    std::cout << "list\tbuild ms\tteardown ms" << std::endl;
+    auto makeInt = [](int i) { return i; };
+    auto makeData = [](int i) { return PerformanceData{ i, "User" }; };
+    MeasureTeardown<DoublyLinkedList<int, std::allocator<int>>>("int std::allocator", count, makeInt);
+    MeasureTeardown<DoublyLinkedList<int>>("int NodePool", count, makeInt);
+    MeasureTeardown<DoublyLinkedList<int, ArenaAllocator<int>>>("int Arena", count, makeInt);
+    MeasureTeardown<DoublyLinkedList<PerformanceData, std::allocator<PerformanceData>>>("PerformanceData std::allocator", count, makeData);
+    MeasureTeardown<DoublyLinkedList<PerformanceData>>("PerformanceData NodePool", count, makeData);
+    MeasureTeardown<DoublyLinkedList<PerformanceData, ArenaAllocator<PerformanceData>>>("PerformanceData Arena", count, makeData);
+    MeasureTeardown<DoublyLinkedList<PerformanceData, ArenaAllocator<PerformanceData, true>>>("PerformanceData Arena (skip destructors)", count, makeData);
+}
+
+// メイン関数
+// 入力: コマンドライン引数 (ベンチマーク名, 要素数 (suite では最大の要素数、merge ではシャードごとの要素数), suite で計測するパターン)
+// 期待結果: 指定したベンチマークを実行して結果を表示する
+int main(int argc, char** argv) {
+    std::string name = argc > 1 ? argv[1] : "parallel";
+    int count = argc > 2 ? std::atoi(argv[2]) : (name == "merge" || name == "churn" ? 1000000 : 10000000);
+
+    if (name == "suite") {
+        RunSuite(count, argc > 3 ? argv[3] : "");
+    }
+    else if (name == "parallel") {
+        BenchmarkParallelScaling(count);
+    }
+    else if (name == "partial") {
+        BenchmarkPartialSort(count);
+    }
+    else if (name == "stream") {
+        BenchmarkStreamingInsert(count, 1000);
+    }
+    else if (name == "merge") {
+        BenchmarkShardMerge(count, 64);
+    }
+    else if (name == "churn") {
+        BenchmarkAllocationChurn(count);
+    }
+    else if (name == "teardown") {
+        BenchmarkTeardown(count);
+    }
+    else {
+        std::cerr << "Usage: SortBench [suite|parallel|partial|stream|merge|churn|teardown] [count] [pattern]" << std::endl;
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,421 @@
+#ifndef CONCURRENT_SQ_H
+#define CONCURRENT_SQ_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "SQ.h"
+
+static const size_t CacheLineSize = 64; // 偽共有を避けるための整列幅
+
+/**
+ * @brief 待機クラス
+ * 待ち時間が短いうちは空回りし、長くなったらスレッドを譲る
+ * スレッドを譲る回数も上限に達すると IsExhausted が true になり、呼び出し元は WaitPoint で眠れる
+ */
+class SpinWait {
+private:
+    static const int SpinLimit = 64;  // 空回りする回数の上限
+    static const int YieldLimit = 16; // 空回りの後にスレッドを譲る回数の上限
+
+    int count; // 待機した回数
+
+public:
+    SpinWait(); // コンストラクタ
+
+    void Pause(); // 1 回待機する
+    bool IsExhausted() const; // 空回りとスレッドの譲渡を上限まで行ったかどうかを判定
+    void Reset(); // 待機した回数をリセット
+};
+
+/**
+ * @brief 待機場所クラス
+ * SpinWait で待っても条件が満たされないスレッドを条件変数で眠らせ、相手側の Notify で起こす
+ * 眠る前に waiting を立て、Notify は waiting が立っている場合だけミューテックスを取って下ろしてから起こす
+ * (誰も眠っていない間や、1 度起こした後で相手がまだ動き出していない間は、Notify はミューテックスに触れない)
+ */
+class WaitPoint {
+private:
+    std::mutex mutex;                  // 条件変数用のミューテックス
+    std::condition_variable condition; // 眠っているスレッドを待たせる条件変数
+    std::atomic<bool> waiting;         // 眠ろうとしているスレッドがある場合は true
+
+public:
+    WaitPoint(); // コンストラクタ
+    WaitPoint(const WaitPoint&) = delete;
+    WaitPoint& operator=(const WaitPoint&) = delete;
+
+    template<typename Predicate>
+    void Wait(Predicate ready); // ready() が true になるまで眠る
+    void Notify(); // 眠っているスレッドがあれば全て起こす (条件を満たす書き込みの後に呼ぶ)
+};
+
+/**
+ * @brief 単一生産者・単一消費者キュークラス
+ * 1 つのスレッドがプッシュし、別の 1 つのスレッドがポップする固定長のリングバッファ
+ * 先頭と末尾の位置は別のキャッシュラインに置き、相手側の位置はキャッシュしておいて、満杯・空に見えたときだけ読み直す
+ * Push / Pop は SpinWait で待った後も満杯・空のままであれば、相手側が空きや要素を作るまで WaitPoint で眠る
+ */
+template<typename T>
+class SpscQueue {
+private:
+    typedef typename std::aligned_storage<sizeof(T), alignof(T)>::type Slot;
+
+    Slot* slots;     // 要素の格納場所
+    size_t capacity; // 容量 (2 のべき乗)
+    size_t mask;     // 位置から格納場所を求めるマスク
+
+    alignas(CacheLineSize) std::atomic<size_t> head; // 次にポップする位置 (消費者が更新)
+    size_t cachedTail;                                // 消費者が最後に読んだ末尾の位置
+
+    alignas(CacheLineSize) std::atomic<size_t> tail; // 次にプッシュする位置 (生産者が更新)
+    size_t cachedHead;                                // 生産者が最後に読んだ先頭の位置
+
+    alignas(CacheLineSize) std::atomic<bool> closed; // 生産者がプッシュを終えた場合は true
+
+    alignas(CacheLineSize) WaitPoint notFull;  // 空きを待つ生産者の待機場所
+    alignas(CacheLineSize) WaitPoint notEmpty; // 要素を待つ消費者の待機場所
+
+    T* slot(size_t position) const; // 位置の格納場所を取得
+    bool hasSpace() const; // 空きがあるかどうかを判定 (生産者のみ)
+    bool hasItemOrClosed() const; // 要素があるか閉じられたかを判定 (消費者のみ)
+    T* front(); // 先頭の要素を取得 (空の場合は nullptr、消費者のみ)
+    void popFront(); // 先頭の要素を破棄 (消費者のみ)
+
+public:
+    explicit SpscQueue(size_t capacity); // コンストラクタ (容量は 2 のべき乗に切り上げる)
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    template<typename... Args>
+    bool TryEmplace(Args&&... args); // 満杯でなければデータを直接構築 (生産者のみ)
+    bool TryPush(const T& data); // 満杯でなければデータをプッシュ (生産者のみ)
+    bool TryPush(T&& data); // 満杯でなければデータをムーブしてプッシュ (生産者のみ)
+    void Push(const T& data); // 空きができるまで待ってデータをプッシュ (生産者のみ)
+    void Push(T&& data); // 空きができるまで待ってデータをムーブしてプッシュ (生産者のみ)
+    bool TryPop(T& data); // 空でなければデータをムーブしてポップ (消費者のみ)
+    T Pop(); // データが届くまで待ってポップ (閉じられて空の場合は std::out_of_range、消費者のみ)
+    void Close(); // これ以上プッシュしないことを通知 (生産者のみ)
+    bool IsClosed() const; // 閉じられたかどうかを判定
+    bool IsEmpty() const; // キューが空かどうかを判定 (他方のスレッドが動いている間は目安)
+    int GetSize() const; // キューのサイズを取得 (他方のスレッドが動いている間は目安)
+    size_t GetCapacity() const; // 容量を取得
+
+    ~SpscQueue(); // デストラクタ
+};
+
+/**
+ * @brief 複数生産者・複数消費者キュークラス
+ * 各格納場所に通し番号を持たせた固定長のリングバッファ (Vyukov 方式)
+ * 通し番号で格納場所が空いているか、データが入っているかを判定し、位置を compare_exchange で予約してから読み書きする
+ * まとめてプッシュ・ポップする場合は、連続した格納場所を 1 回の compare_exchange で予約する
+ * Push / Pop (とそのまとめて版) は SpinWait で待った後も満杯・空のままであれば、他のスレッドが空きや要素を作るまで WaitPoint で眠る
+ */
+template<typename T>
+class MpmcQueue {
+private:
+    typedef typename std::aligned_storage<sizeof(T), alignof(T)>::type Slot;
+
+    // 格納場所
+    struct Cell {
+        std::atomic<size_t> sequence; // 位置 p にプッシュできる場合は p、位置 p からポップできる場合は p + 1
+        Slot storage;                 // 要素の格納場所
+    };
+
+    Cell* cells;     // 格納場所のリング
+    size_t capacity; // 容量 (2 のべき乗)
+    size_t mask;     // 位置から格納場所を求めるマスク
+
+    alignas(CacheLineSize) std::atomic<size_t> enqueuePos; // 次にプッシュする位置
+    alignas(CacheLineSize) std::atomic<size_t> dequeuePos; // 次にポップする位置
+    alignas(CacheLineSize) std::atomic<bool> closed;       // 全ての生産者がプッシュを終えた場合は true
+
+    alignas(CacheLineSize) WaitPoint notFull;  // 空きを待つ生産者の待機場所
+    alignas(CacheLineSize) WaitPoint notEmpty; // 要素を待つ消費者の待機場所
+
+    T* item(Cell& cell) const; // 格納場所の要素を取得
+    bool hasSpace() const; // 次にプッシュする格納場所が空いているかどうかを判定
+    bool hasItemOrClosed() const; // 次にポップする格納場所に要素があるか閉じられたかを判定
+    size_t reservePush(size_t count, size_t& position); // プッシュできる連続した位置を最大 count 個予約
+    size_t reservePop(size_t count, size_t& position); // ポップできる連続した位置を最大 count 個予約
+
+public:
+    explicit MpmcQueue(size_t capacity); // コンストラクタ (容量は 2 のべき乗に切り上げる、最小 2)
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+    bool TryPush(const T& data); // 満杯でなければデータをプッシュ
+    bool TryPush(T&& data); // 満杯でなければデータをムーブしてプッシュ
+    void Push(const T& data); // 空きができるまで待ってデータをプッシュ
+    void Push(T&& data); // 空きができるまで待ってデータをムーブしてプッシュ
+    bool TryPop(T& data); // 空でなければデータをムーブしてポップ
+    T Pop(); // データが届くまで待ってポップ (閉じられて空の場合は std::out_of_range)
+
+    template<typename Iterator>
+    size_t TryPushBulk(Iterator first, Iterator last); // 空いている分だけ範囲の先頭からムーブしてプッシュし、プッシュした数を返す
+    template<typename Iterator>
+    void PushBulk(Iterator first, Iterator last); // 空きができるのを待ちながら範囲の全ての要素をムーブしてプッシュ
+    template<typename OutputIterator>
+    size_t TryPopBulk(OutputIterator out, size_t maxCount); // 最大 maxCount 個をポップして書き出し、ポップした数を返す
+    template<typename OutputIterator>
+    size_t PopBulk(OutputIterator out, size_t maxCount); // 1 個以上届くまで待って最大 maxCount 個をポップ (閉じられて空の場合は 0)
+
+    void Close(); // 全ての生産者がプッシュを終えたことを通知
+    bool IsClosed() const; // 閉じられたかどうかを判定
+    bool IsEmpty() const; // キューが空かどうかを判定 (他のスレッドが動いている間は目安)
+    int GetSize() const; // キューのサイズを取得 (他のスレッドが動いている間は目安)
+    size_t GetCapacity() const; // 容量を取得
+
+    ~MpmcQueue(); // デストラクタ
+};
+
+/**
+ * @brief 並行スタッククラス
+ * 固定長のノード配列の上に作った Treiber スタック
+ * スタックの先頭は「変更回数 (上位 32 ビット) とノード番号 (下位 32 ビット)」を 1 つの 64 ビット値にまとめて compare_exchange し、
+ * 同じノードが外されて戻された場合 (ABA) も変更回数の違いで検出する
+ * ノードは空きリスト (同じ方式のスタック) で再利用し、スタックの生存中は解放しないため、古い番号のノードを読んでも安全
+ * 先頭の compare_exchange に失敗したプッシュとポップは、消去配列で直接要素を受け渡して競合を避ける
+ */
+template<typename T>
+class ConcurrentStack {
+private:
+    typedef typename std::aligned_storage<sizeof(T), alignof(T)>::type Slot;
+
+    static const uint32_t NullIndex = 0xFFFFFFFF; // ノードがないことを示す番号
+    static const int EliminationSize = 8;         // 消去配列の長さ
+    static const int EliminationSpins = 64;       // プッシュが消去配列で相手を待つ回数
+
+    // ノード
+    struct Node {
+        std::atomic<uint32_t> next; // 次のノードの番号
+        uint32_t generation;        // 空きリストから取り出された回数 (消去配列での受け渡しの識別に使う)
+        Slot storage;               // 要素の格納場所
+    };
+
+    // 消去配列の要素 (偽共有を避けるためキャッシュラインごとに置く)
+    struct alignas(CacheLineSize) EliminationSlot {
+        std::atomic<uint64_t> offer; // 受け渡し中のノード (世代とノード番号、空の場合は 0)
+    };
+
+    Node* nodes;        // ノードの配列
+    uint32_t capacity;  // 容量
+    bool elimination;   // 消去配列を使う場合は true
+
+    alignas(CacheLineSize) std::atomic<uint64_t> top;      // スタックの先頭 (変更回数とノード番号)
+    alignas(CacheLineSize) std::atomic<uint64_t> freeTop;  // 空きリストの先頭 (変更回数とノード番号)
+    EliminationSlot eliminationSlots[EliminationSize];     // 消去配列
+
+    static uint64_t makeTagged(uint64_t tag, uint32_t index); // 変更回数とノード番号をまとめる
+    static uint32_t indexOf(uint64_t tagged); // ノード番号を取り出す
+    static uint64_t tagOf(uint64_t tagged); // 変更回数を取り出す
+    static int pickSlot(); // 消去配列の位置をスレッドごとの乱数で選ぶ
+
+    T* item(uint32_t index) const; // ノードの要素を取得
+    void pushNode(std::atomic<uint64_t>& head, uint32_t index); // ノードをリストの先頭に繋ぐ
+    uint32_t popNode(std::atomic<uint64_t>& head); // リストの先頭のノードを外す (空の場合は NullIndex)
+    bool eliminatePush(uint32_t index); // 消去配列でノードをポップ側に渡す (渡せた場合は true)
+    uint32_t eliminatePop(); // 消去配列からノードを受け取る (受け取れなかった場合は NullIndex)
+    void pushValue(uint32_t index); // 要素を構築したノードをスタックに積む
+    uint32_t popValue(); // スタックからノードを外す (空の場合は NullIndex)
+
+public:
+    explicit ConcurrentStack(size_t capacity, bool elimination = true); // コンストラクタ (elimination が false の場合は消去配列を使わない)
+    ConcurrentStack(const ConcurrentStack&) = delete;
+    ConcurrentStack& operator=(const ConcurrentStack&) = delete;
+
+    bool TryPush(const T& data); // 満杯でなければデータをプッシュ
+    bool TryPush(T&& data); // 満杯でなければデータをムーブしてプッシュ
+    void Push(const T& data); // 空きができるまで待ってデータをプッシュ
+    void Push(T&& data); // 空きができるまで待ってデータをムーブしてプッシュ
+    bool TryPop(T& data); // 空でなければデータをムーブしてポップ
+    T Pop(); // データをムーブしてポップ (空の場合は std::out_of_range)
+    bool IsEmpty() const; // スタックが空かどうかを判定 (他のスレッドが動いている間は目安)
+    size_t GetCapacity() const; // 容量を取得
+
+    ~ConcurrentStack(); // デストラクタ
+};
+
+/**
+ * @brief 有界キュークラス
+ * 容量を超えてプッシュさせないことで、読み込みが処理より速くてもメモリ使用量を容量分に抑える (背圧)
+ * ミューテックスと条件変数で保護し、満杯のプッシュは待つか (Push) すぐに失敗する (TryPush)
+ * 消費者は DrainTo で 1 回のロックの間に複数の要素をまとめて取り出せる
+ */
+template<typename T, typename Storage = ChunkedStorage<T>>
+class BoundedQueue {
+private:
+    Queue<T, Storage> queue;           // 要素を格納するキュー
+    size_t capacity;                   // 容量
+    bool closed;                       // 閉じられた場合は true
+    mutable std::mutex mutex;          // キューを保護するミューテックス
+    std::condition_variable notFull;   // 空きができたことを待つ条件変数
+    std::condition_variable notEmpty;  // 要素が届いたことを待つ条件変数
+
+    template<typename U>
+    bool push(U&& data, bool wait); // データをプッシュ (wait が true の場合は空きができるまで待つ)
+    template<typename Container>
+    size_t drain(std::unique_lock<std::mutex>& lock, Container& container, size_t maxItems); // ロック中に最大 maxItems 個を取り出す
+
+public:
+    explicit BoundedQueue(size_t capacity); // コンストラクタ (容量は 1 以上)
+    BoundedQueue(const BoundedQueue&) = delete;
+    BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+    bool TryPush(const T& data); // 満杯でなければデータをプッシュ (満杯または閉じられている場合は false)
+    bool TryPush(T&& data); // 満杯でなければデータをムーブしてプッシュ (満杯または閉じられている場合は false)
+    bool Push(const T& data); // 空きができるまで待ってデータをプッシュ (閉じられた場合は false)
+    bool Push(T&& data); // 空きができるまで待ってデータをムーブしてプッシュ (閉じられた場合は false)
+    bool TryPop(T& data); // 空でなければデータをムーブしてポップ
+    T Pop(); // データが届くまで待ってポップ (閉じられて空の場合は std::out_of_range)
+    template<typename Container>
+    size_t TryDrainTo(Container& container, size_t maxItems); // 今ある要素を最大 maxItems 個まとめて末尾に追加し、取り出した数を返す
+    template<typename Container>
+    size_t DrainTo(Container& container, size_t maxItems); // 1 個以上届くまで待ってまとめて取り出す (閉じられて空の場合は 0)
+    void Close(); // これ以上プッシュしないことを通知し、待っているスレッドを起こす
+    bool IsClosed() const; // 閉じられたかどうかを判定
+    bool IsEmpty() const; // キューが空かどうかを判定
+    int GetSize() const; // キューのサイズを取得
+    size_t GetCapacity() const; // 容量を取得
+};
+
+/**
+ * @brief ワークスティーリング両端キュークラス
+ * Chase-Lev 方式の両端キュー。所有スレッドだけが末尾にプッシュ・末尾からポップし、他のスレッドは先頭から盗む
+ * 所有スレッドの操作は最後の 1 要素を取り合う場合を除いて compare_exchange を使わない
+ * 満杯になると所有スレッドが 2 倍の長さのリングに移し替える。古いリングは盗んでいる途中のスレッドが読むことがあるため、破棄するまで残す
+ * 要素は atomic に格納するため、T はトリビアルにコピーできる型 (ポインタなど) に限る
+ */
+template<typename T>
+class WorkStealingDeque {
+private:
+    static_assert(std::is_trivially_copyable<T>::value, "WorkStealingDeque requires a trivially copyable type");
+
+    // 要素のリング
+    struct Ring {
+        size_t capacity;          // 長さ (2 のべき乗)
+        std::atomic<T>* elements; // 要素の格納場所
+
+        explicit Ring(size_t capacity); // コンストラクタ
+        ~Ring(); // デストラクタ
+        T Get(int64_t position) const; // 位置の要素を取得
+        void Put(int64_t position, T data); // 位置に要素を格納
+    };
+
+    // タスクプールなどからヒープに確保されるため、alignas ではなく詰め物で先頭と末尾を別のキャッシュラインに分ける
+    std::atomic<int64_t> top;                              // 次に盗む位置 (盗むスレッドが進める)
+    char topPadding[CacheLineSize];                        // 詰め物
+    std::atomic<int64_t> bottom;                           // 次にプッシュする位置 (所有スレッドが更新)
+    std::atomic<Ring*> ring;                               // 現在のリング
+    char bottomPadding[CacheLineSize];                     // 詰め物
+    std::vector<Ring*> retired;                            // 移し替える前のリング (所有スレッドのみ)
+
+    Ring* grow(Ring* current, int64_t first, int64_t last); // リングを 2 倍の長さに移し替える
+
+public:
+    explicit WorkStealingDeque(size_t capacity = 64); // コンストラクタ (初期の長さは 2 のべき乗に切り上げる)
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    void Push(T data); // 末尾にプッシュ (所有スレッドのみ)
+    bool Pop(T& data); // 末尾からポップ (所有スレッドのみ、空の場合は false)
+    bool Steal(T& data); // 先頭から盗む (空の場合や他のスレッドと取り合って負けた場合は false)
+    bool IsEmpty() const; // 両端キューが空かどうかを判定 (他のスレッドが動いている間は目安)
+    size_t GetCapacity() const; // 現在のリングの長さを取得
+
+    ~WorkStealingDeque(); // デストラクタ
+};
+
+/**
+ * @brief 遅延キュークラス
+ * 期限を付けてプッシュした要素を、期限を過ぎてからポップできるようにするキュー
+ * 4 段 × 256 枠の階層タイミングホイールで管理し、プッシュと期限切れの取り出しは要素数によらず定数時間
+ * 近い期限は 1 刻みごとの枠に、遠い期限は上の段の粗い枠に入れ、時刻が段の境目を越えるたびに下の段へ振り分け直す
+ * PopReady は次に期限が来る時刻 (または段の境目) まで条件変数で眠るため、IsEmpty を繰り返し確認する必要がない
+ */
+template<typename T>
+class DelayQueue {
+public:
+    typedef std::chrono::steady_clock Clock; // 期限に使う時計
+    typedef Clock::time_point TimePoint;    // 時刻
+    typedef Clock::duration Duration;       // 時間
+
+private:
+    static const int LevelBits = 8;                                // 1 段あたりの枠数のビット数
+    static const uint32_t SlotCount = 1u << LevelBits;             // 1 段あたりの枠数
+    static const int LevelCount = 4;                               // 段数
+    static const uint32_t NullIndex = 0xFFFFFFFF;                  // ノードがないことを示す番号
+    static const uint64_t MaxDelta = (1ull << (LevelBits * LevelCount)) - 1; // ホイールで表せる最大の刻み数
+
+    // ノード
+    struct Node {
+        T data;        // データ
+        uint64_t tick; // 期限の刻み (この刻みを過ぎるとポップできる)
+        uint32_t next; // 同じ枠の次のノードの番号
+    };
+
+    // ノード番号の連結リスト
+    struct List {
+        uint32_t head;  // 先頭のノード番号
+        uint32_t tail;  // 末尾のノード番号
+        uint32_t count; // ノード数
+    };
+
+    std::vector<Node> nodes;                 // ノードの配列 (ポップしたノードは空きリストで再利用する)
+    uint32_t freeHead;                       // 空きリストの先頭のノード番号
+    List wheel[LevelCount][SlotCount];       // タイミングホイール
+    size_t levelSizes[LevelCount];           // 段ごとの要素数
+    List ready;                              // 期限を過ぎた要素のリスト
+    uint64_t current;                        // 次に処理する刻み
+    TimePoint origin;                        // 刻み 0 の時刻
+    Duration tickLength;                     // 1 刻みの長さ
+    uint64_t wakeTick;                       // 待っているスレッドが起きる刻み
+    int waiters;                             // 待っているスレッド数
+    bool closed;                             // 閉じられた場合は true
+    mutable std::mutex mutex;                // キューを保護するミューテックス
+    std::condition_variable changed;         // 要素の追加や終了を通知する条件変数
+
+    void append(List& list, uint32_t index); // リストの末尾にノードを繋ぐ
+    static void clear(List& list); // リストを空にする
+    uint64_t tickOf(TimePoint deadline) const; // 期限を刻みに切り上げる
+    uint64_t elapsedTicks(TimePoint now) const; // 経過した刻み数 (切り捨て)
+    TimePoint timeOf(uint64_t tick) const; // 刻みの開始時刻を取得
+    size_t wheelSize() const; // ホイール上の要素数
+    template<typename U>
+    bool push(U&& data, TimePoint deadline); // データを期限付きでプッシュ
+    void schedule(uint32_t index); // ノードを期限に応じた段と枠に入れる
+    void cascade(int level); // 現在の刻みに対応する上の段の枠を下の段へ振り分け直す
+    uint64_t nextEventTick() const; // 次に処理が必要な刻み (期限または段の境目)
+    void advance(uint64_t nowTick); // nowTick までの刻みを処理し、期限を過ぎた要素を ready に移す
+    bool popReady(T& data); // ready の先頭をポップ
+    bool wait(T& data, bool timed, TimePoint deadline); // 期限を過ぎた要素が出るまで待ってポップ
+
+public:
+    explicit DelayQueue(Duration tickLength = std::chrono::milliseconds(1)); // コンストラクタ (1 刻みの長さ、期限はこの単位に切り上げる)
+    DelayQueue(const DelayQueue&) = delete;
+    DelayQueue& operator=(const DelayQueue&) = delete;
+
+    bool Push(const T& data, Duration delay); // delay 後にポップできるようにデータをプッシュ (閉じられている場合は false)
+    bool Push(T&& data, Duration delay); // delay 後にポップできるようにデータをムーブしてプッシュ (閉じられている場合は false)
+    bool PushAt(const T& data, TimePoint deadline); // deadline 以降にポップできるようにデータをプッシュ (閉じられている場合は false)
+    bool PushAt(T&& data, TimePoint deadline); // deadline 以降にポップできるようにデータをムーブしてプッシュ (閉じられている場合は false)
+    bool TryPopReady(T& data); // 期限を過ぎた要素があればポップ
+    bool PopReady(T& data, Duration timeout); // 期限を過ぎた要素が出るまで最大 timeout 待ってポップ (時間切れや、閉じられて空の場合は false)
+    T PopReady(); // 期限を過ぎた要素が出るまで待ってポップ (閉じられて空の場合は std::out_of_range)
+    void Close(); // これ以上プッシュしないことを通知し、待っているスレッドを起こす (残っている要素は期限どおりにポップできる)
+    bool IsClosed() const; // 閉じられたかどうかを判定
+    bool IsEmpty() const; // 期限前の要素も含めてキューが空かどうかを判定
+    size_t GetSize() const; // 期限前の要素も含めたキューのサイズを取得
+};
+
+#include "ConcurrentSQ.inl"
+
+#endif // CONCURRENT_SQ_H
@@ -0,0 +1,1402 @@
+#ifndef CONCURRENT_SQ_INL
+#define CONCURRENT_SQ_INL
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <thread>
+
+// SpinWait メソッドの実装
+
+// SpinWait コンストラクタ
+inline SpinWait::SpinWait() : count(0) {}
+
+// 1 回待機するメソッド (上限までは空回りし、その後はスレッドを譲る)
+inline void SpinWait::Pause() {
+    if (count < SpinLimit + YieldLimit) {
+        count++;
+        if (count <= SpinLimit) return;
+    }
+    std::this_thread::yield();
+}
+
+// 空回りとスレッドの譲渡を上限まで行ったかどうかを判定するメソッド
+inline bool SpinWait::IsExhausted() const {
+    return count >= SpinLimit + YieldLimit;
+}
+
+// 待機した回数をリセットするメソッド
+inline void SpinWait::Reset() {
+    count = 0;
+}
+
+// WaitPoint メソッドの実装
+
+// WaitPoint コンストラクタ
+inline WaitPoint::WaitPoint() : waiting(false) {}
+
+// 条件が満たされるまで眠るメソッド
+// 引数: Predicate ready - 待つ条件 (相手側が Notify の前に書き込んだ値を読む関数)
+// 期待結果: waiting を立ててから条件を読むため、Notify が waiting を下りていると読んだ場合は条件の書き込みが見え、眠らずに戻る
+template<typename Predicate>
+void WaitPoint::Wait(Predicate ready) {
+    std::unique_lock<std::mutex> lock(mutex);
+    for (;;) {
+        waiting.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (ready()) return;
+        condition.wait(lock);
+    }
+}
+
+// 眠っているスレッドを起こすメソッド
+// 期待結果: 条件の書き込みの後に waiting を読み、立っていればミューテックスを取って下ろしてから全て起こす
+inline void WaitPoint::Notify() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!waiting.load(std::memory_order_relaxed)) return;
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!waiting.load(std::memory_order_relaxed)) return;
+    waiting.store(false, std::memory_order_relaxed);
+    condition.notify_all();
+}
+
+// SpscQueue メソッドの実装
+
+// SpscQueue コンストラクタ
+template<typename T>
+SpscQueue<T>::SpscQueue(size_t capacity) : slots(nullptr), capacity(1), mask(0), head(0), cachedTail(0), tail(0), cachedHead(0), closed(false) {
+    while (this->capacity < capacity) {
+        this->capacity <<= 1;
+    }
+    mask = this->capacity - 1;
+    slots = new Slot[this->capacity];
+}
+
+// 位置の格納場所を取得するメソッド
+template<typename T>
+T* SpscQueue<T>::slot(size_t position) const {
+    return reinterpret_cast<T*>(&slots[position & mask]);
+}
+
+// 空きがあるかどうかを判定するメソッド
+template<typename T>
+bool SpscQueue<T>::hasSpace() const {
+    return tail.load(std::memory_order_relaxed) - head.load(std::memory_order_acquire) < capacity;
+}
+
+// 要素があるか閉じられたかを判定するメソッド
+template<typename T>
+bool SpscQueue<T>::hasItemOrClosed() const {
+    return head.load(std::memory_order_relaxed) != tail.load(std::memory_order_acquire) || closed.load(std::memory_order_acquire);
+}
+
+// 満杯でなければデータを直接構築するメソッド
+template<typename T>
+template<typename... Args>
+bool SpscQueue<T>::TryEmplace(Args&&... args) {
+    size_t position = tail.load(std::memory_order_relaxed);
+    if (position - cachedHead == capacity) {
+        cachedHead = head.load(std::memory_order_acquire);
+        if (position - cachedHead == capacity) return false;
+    }
+    new (slot(position)) T(std::forward<Args>(args)...);
+    tail.store(position + 1, std::memory_order_release);
+    notEmpty.Notify();
+    return true;
+}
+
+// 満杯でなければデータをプッシュするメソッド
+template<typename T>
+bool SpscQueue<T>::TryPush(const T& data) {
+    return TryEmplace(data);
+}
+
+// 満杯でなければデータをムーブしてプッシュするメソッド
+template<typename T>
+bool SpscQueue<T>::TryPush(T&& data) {
+    return TryEmplace(std::move(data));
+}
+
+// 空きができるまで待ってデータをプッシュするメソッド
+template<typename T>
+void SpscQueue<T>::Push(const T& data) {
+    SpinWait wait;
+    while (!TryEmplace(data)) {
+        if (wait.IsExhausted()) {
+            notFull.Wait([this] { return hasSpace(); });
+        }
+        else {
+            wait.Pause();
+        }
+    }
+}
+
+// 空きができるまで待ってデータをムーブしてプッシュするメソッド
+template<typename T>
+void SpscQueue<T>::Push(T&& data) {
+    SpinWait wait;
+    while (!TryEmplace(std::move(data))) {
+        if (wait.IsExhausted()) {
+            notFull.Wait([this] { return hasSpace(); });
+        }
+        else {
+            wait.Pause();
+        }
+    }
+}
+
+// 先頭の要素を取得するメソッド
+template<typename T>
+T* SpscQueue<T>::front() {
+    size_t position = head.load(std::memory_order_relaxed);
+    if (position == cachedTail) {
+        cachedTail = tail.load(std::memory_order_acquire);
+        if (position == cachedTail) return nullptr;
+    }
+    return slot(position);
+}
+
+// 先頭の要素を破棄するメソッド
+template<typename T>
+void SpscQueue<T>::popFront() {
+    size_t position = head.load(std::memory_order_relaxed);
+    slot(position)->~T();
+    head.store(position + 1, std::memory_order_release);
+    notFull.Notify();
+}
+
+// 空でなければデータをムーブしてポップするメソッド
+template<typename T>
+bool SpscQueue<T>::TryPop(T& data) {
+    T* item = front();
+    if (item == nullptr) return false;
+    data = std::move(*item);
+    popFront();
+    return true;
+}
+
+// データが届くまで待ってポップするメソッド
+template<typename T>
+T SpscQueue<T>::Pop() {
+    SpinWait wait;
+    T* item;
+    while ((item = front()) == nullptr) {
+        // 閉じた後にプッシュされることはないので、閉じたのを見てからも空であれば終わり
+        if (closed.load(std::memory_order_acquire)) {
+            item = front();
+            if (item == nullptr) {
+                throw std::out_of_range("Queue is closed");
+            }
+            break;
+        }
+        if (wait.IsExhausted()) {
+            notEmpty.Wait([this] { return hasItemOrClosed(); });
+        }
+        else {
+            wait.Pause();
+        }
+    }
+    T data = std::move(*item);
+    popFront();
+    return data;
+}
+
+// これ以上プッシュしないことを通知するメソッド
+template<typename T>
+void SpscQueue<T>::Close() {
+    closed.store(true, std::memory_order_release);
+    notEmpty.Notify();
+}
+
+// 閉じられたかどうかを判定するメソッド
+template<typename T>
+bool SpscQueue<T>::IsClosed() const {
+    return closed.load(std::memory_order_acquire);
+}
+
+// キューが空かどうかを判定するメソッド
+template<typename T>
+bool SpscQueue<T>::IsEmpty() const {
+    return GetSize() == 0;
+}
+
+// キューのサイズを取得するメソッド
+template<typename T>
+int SpscQueue<T>::GetSize() const {
+    size_t first = head.load(std::memory_order_acquire);
+    size_t last = tail.load(std::memory_order_acquire);
+    return last > first ? static_cast<int>(last - first) : 0;
+}
+
+// 容量を取得するメソッド
+template<typename T>
+size_t SpscQueue<T>::GetCapacity() const {
+    return capacity;
+}
+
+// SpscQueue デストラクタ
+template<typename T>
+SpscQueue<T>::~SpscQueue() {
+    size_t last = tail.load(std::memory_order_relaxed);
+    for (size_t position = head.load(std::memory_order_relaxed); position != last; ++position) {
+        slot(position)->~T();
+    }
+    delete[] slots;
+}
+
+// MpmcQueue メソッドの実装
+
+// MpmcQueue コンストラクタ
+template<typename T>
+MpmcQueue<T>::MpmcQueue(size_t capacity) : cells(nullptr), capacity(2), mask(0), enqueuePos(0), dequeuePos(0), closed(false) {
+    // 容量 1 では空きを示す番号と要素を示す番号が重なるため、2 以上にする
+    while (this->capacity < capacity) {
+        this->capacity <<= 1;
+    }
+    mask = this->capacity - 1;
+    cells = new Cell[this->capacity];
+    for (size_t i = 0; i < this->capacity; ++i) {
+        cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+// 格納場所の要素を取得するメソッド
+template<typename T>
+T* MpmcQueue<T>::item(Cell& cell) const {
+    return reinterpret_cast<T*>(&cell.storage);
+}
+
+// 次にプッシュする格納場所が空いているかどうかを判定するメソッド (位置が古い場合も、予約し直せるので true)
+template<typename T>
+bool MpmcQueue<T>::hasSpace() const {
+    size_t position = enqueuePos.load(std::memory_order_relaxed);
+    size_t sequence = cells[position & mask].sequence.load(std::memory_order_acquire);
+    return static_cast<std::ptrdiff_t>(sequence - position) >= 0;
+}
+
+// 次にポップする格納場所に要素があるか閉じられたかを判定するメソッド (位置が古い場合も、予約し直せるので true)
+template<typename T>
+bool MpmcQueue<T>::hasItemOrClosed() const {
+    size_t position = dequeuePos.load(std::memory_order_relaxed);
+    size_t sequence = cells[position & mask].sequence.load(std::memory_order_acquire);
+    return static_cast<std::ptrdiff_t>(sequence - (position + 1)) >= 0 || closed.load(std::memory_order_acquire);
+}
+
+// プッシュできる連続した位置を予約するメソッド
+// 引数: size_t count - 予約したい数
+//       size_t& position - 予約した先頭の位置の格納先
+// 戻り値: 予約した数 (満杯の場合は 0)
+template<typename T>
+size_t MpmcQueue<T>::reservePush(size_t count, size_t& position) {
+    size_t first = enqueuePos.load(std::memory_order_relaxed);
+    for (;;) {
+        size_t reserved = 0;
+        bool stale = false;
+        while (reserved < count) {
+            size_t sequence = cells[(first + reserved) & mask].sequence.load(std::memory_order_acquire);
+            std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(sequence - (first + reserved));
+            if (diff != 0) {
+                // 番号が進んでいれば、読んだ位置に他の生産者が先にプッシュしている
+                stale = diff > 0;
+                break;
+            }
+            reserved++;
+        }
+        if (reserved == 0 && !stale) return 0;
+        if (reserved > 0 && enqueuePos.compare_exchange_weak(first, first + reserved, std::memory_order_relaxed)) {
+            position = first;
+            return reserved;
+        }
+        if (reserved == 0) {
+            first = enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+// ポップできる連続した位置を予約するメソッド
+// 引数: size_t count - 予約したい数
+//       size_t& position - 予約した先頭の位置の格納先
+// 戻り値: 予約した数 (空の場合は 0)
+template<typename T>
+size_t MpmcQueue<T>::reservePop(size_t count, size_t& position) {
+    size_t first = dequeuePos.load(std::memory_order_relaxed);
+    for (;;) {
+        size_t reserved = 0;
+        bool stale = false;
+        while (reserved < count) {
+            size_t sequence = cells[(first + reserved) & mask].sequence.load(std::memory_order_acquire);
+            std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(sequence - (first + reserved + 1));
+            if (diff != 0) {
+                // 番号が進んでいれば、読んだ位置から他の消費者が先にポップしている
+                stale = diff > 0;
+                break;
+            }
+            reserved++;
+        }
+        if (reserved == 0 && !stale) return 0;
+        if (reserved > 0 && dequeuePos.compare_exchange_weak(first, first + reserved, std::memory_order_relaxed)) {
+            position = first;
+            return reserved;
+        }
+        if (reserved == 0) {
+            first = dequeuePos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+// 満杯でなければデータをプッシュするメソッド
+// 予約した格納場所は必ず埋める必要があるため、コピーは予約の前に済ませておく
+template<typename T>
+bool MpmcQueue<T>::TryPush(const T& data) {
+    T copy(data);
+    return TryPush(std::move(copy));
+}
+
+// 満杯でなければデータをムーブしてプッシュするメソッド
+template<typename T>
+bool MpmcQueue<T>::TryPush(T&& data) {
+    size_t position;
+    if (reservePush(1, position) == 0) return false;
+    Cell& cell = cells[position & mask];
+    new (item(cell)) T(std::move(data));
+    cell.sequence.store(position + 1, std::memory_order_release);
+    notEmpty.Notify();
+    return true;
+}
+
+// 空きができるまで待ってデータをプッシュするメソッド
+template<typename T>
+void MpmcQueue<T>::Push(const T& data) {
+    Push(T(data));
+}
+
+// 空きができるまで待ってデータをムーブしてプッシュするメソッド
+template<typename T>
+void MpmcQueue<T>::Push(T&& data) {
+    SpinWait wait;
+    while (!TryPush(std::move(data))) {
+        if (wait.IsExhausted()) {
+            notFull.Wait([this] { return hasSpace(); });
+        }
+        else {
+            wait.Pause();
+        }
+    }
+}
+
+// 空でなければデータをムーブしてポップするメソッド
+template<typename T>
+bool MpmcQueue<T>::TryPop(T& data) {
+    return TryPopBulk(&data, 1) == 1;
+}
+
+// データが届くまで待ってポップするメソッド
+template<typename T>
+T MpmcQueue<T>::Pop() {
+    SpinWait wait;
+    size_t position;
+    while (reservePop(1, position) == 0) {
+        // 全ての生産者が終えてから閉じるので、閉じたのを見てからも空であれば終わり
+        if (closed.load(std::memory_order_acquire)) {
+            if (reservePop(1, position) == 0) {
+                throw std::out_of_range("Queue is closed");
+            }
+            break;
+        }
+        if (wait.IsExhausted()) {
+            notEmpty.Wait([this] { return hasItemOrClosed(); });
+        }
+        else {
+            wait.Pause();
+        }
+    }
+    Cell& cell = cells[position & mask];
+    T data = std::move(*item(cell));
+    item(cell)->~T();
+    cell.sequence.store(position + capacity, std::memory_order_release);
+    notFull.Notify();
+    return data;
+}
+
+// 空いている分だけ範囲の先頭からムーブしてプッシュするメソッド
+// 引数: Iterator first, Iterator last - プッシュする範囲 (前方反復子)
+// 戻り値: プッシュした数
+template<typename T>
+template<typename Iterator>
+size_t MpmcQueue<T>::TryPushBulk(Iterator first, Iterator last) {
+    size_t count = static_cast<size_t>(std::distance(first, last));
+    size_t position;
+    size_t reserved = count > 0 ? reservePush(count, position) : 0;
+    for (size_t i = 0; i < reserved; ++i, ++first) {
+        Cell& cell = cells[(position + i) & mask];
+        new (item(cell)) T(std::move(*first));
+        cell.sequence.store(position + i + 1, std::memory_order_release);
+    }
+    if (reserved > 0) {
+        notEmpty.Notify();
+    }
+    return reserved;
+}
+
+// 空きができるのを待ちながら範囲の全ての要素をムーブしてプッシュするメソッド
+// 引数: Iterator first, Iterator last - プッシュする範囲 (前方反復子)
+template<typename T>
+template<typename Iterator>
+void MpmcQueue<T>::PushBulk(Iterator first, Iterator last) {
+    SpinWait wait;
+    while (first != last) {
+        size_t pushed = TryPushBulk(first, last);
+        if (pushed == 0) {
+            if (wait.IsExhausted()) {
+                notFull.Wait([this] { return hasSpace(); });
+            }
+            else {
+                wait.Pause();
+            }
+            continue;
+        }
+        std::advance(first, pushed);
+        wait.Reset();
+    }
+}
+
+// 最大 maxCount 個をポップして書き出すメソッド
+// 引数: OutputIterator out - 書き出し先
+//       size_t maxCount - ポップする最大数
+// 戻り値: ポップした数
+template<typename T>
+template<typename OutputIterator>
+size_t MpmcQueue<T>::TryPopBulk(OutputIterator out, size_t maxCount) {
+    size_t position;
+    size_t reserved = maxCount > 0 ? reservePop(maxCount, position) : 0;
+    for (size_t i = 0; i < reserved; ++i) {
+        Cell& cell = cells[(position + i) & mask];
+        *out++ = std::move(*item(cell));
+        item(cell)->~T();
+        cell.sequence.store(position + i + capacity, std::memory_order_release);
+    }
+    if (reserved > 0) {
+        notFull.Notify();
+    }
+    return reserved;
+}
+
+// 1 個以上届くまで待って最大 maxCount 個をポップするメソッド
+// 引数: OutputIterator out - 書き出し先
+//       size_t maxCount - ポップする最大数
+// 戻り値: ポップした数 (閉じられて空の場合は 0)
+template<typename T>
+template<typename OutputIterator>
+size_t MpmcQueue<T>::PopBulk(OutputIterator out, size_t maxCount) {
+    SpinWait wait;
+    for (;;) {
+        size_t popped = TryPopBulk(out, maxCount);
+        if (popped > 0 || maxCount == 0) return popped;
+        if (closed.load(std::memory_order_acquire)) {
+            return TryPopBulk(out, maxCount);
+        }
+        if (wait.IsExhausted()) {
+            notEmpty.Wait([this] { return hasItemOrClosed(); });
+        }
+        else {
+            wait.Pause();
+        }
+    }
+}
+
+// 全ての生産者がプッシュを終えたことを通知するメソッド
+template<typename T>
+void MpmcQueue<T>::Close() {
+    closed.store(true, std::memory_order_release);
+    notEmpty.Notify();
+}
+
+// 閉じられたかどうかを判定するメソッド
+template<typename T>
+bool MpmcQueue<T>::IsClosed() const {
+    return closed.load(std::memory_order_acquire);
+}
+
+// キューが空かどうかを判定するメソッド
+template<typename T>
+bool MpmcQueue<T>::IsEmpty() const {
+    return GetSize() == 0;
+}
+
+// キューのサイズを取得するメソッド
+template<typename T>
+int MpmcQueue<T>::GetSize() const {
+    size_t first = dequeuePos.load(std::memory_order_acquire);
+    size_t last = enqueuePos.load(std::memory_order_acquire);
+    return last > first ? static_cast<int>(last - first) : 0;
+}
+
+// 容量を取得するメソッド
+template<typename T>
+size_t MpmcQueue<T>::GetCapacity() const {
+    return capacity;
+}
+
+// MpmcQueue デストラクタ
+template<typename T>
+MpmcQueue<T>::~MpmcQueue() {
+    size_t last = enqueuePos.load(std::memory_order_relaxed);
+    for (size_t position = dequeuePos.load(std::memory_order_relaxed); position != last; ++position) {
+        item(cells[position & mask])->~T();
+    }
+    delete[] cells;
+}
+
+// ConcurrentStack メソッドの実装
+
+// ConcurrentStack コンストラクタ
+template<typename T>
+ConcurrentStack<T>::ConcurrentStack(size_t capacity, bool elimination)
+    : nodes(nullptr), capacity(static_cast<uint32_t>(std::min<size_t>(capacity, NullIndex - 1))), elimination(elimination),
+    top(makeTagged(0, NullIndex)), freeTop(makeTagged(0, NullIndex)) {
+    nodes = new Node[this->capacity];
+    for (uint32_t i = 0; i < this->capacity; ++i) {
+        nodes[i].next.store(i + 1 < this->capacity ? i + 1 : NullIndex, std::memory_order_relaxed);
+        nodes[i].generation = 0;
+    }
+    if (this->capacity > 0) {
+        freeTop.store(makeTagged(0, 0), std::memory_order_relaxed);
+    }
+    for (int i = 0; i < EliminationSize; ++i) {
+        eliminationSlots[i].offer.store(0, std::memory_order_relaxed);
+    }
+}
+
+// 変更回数とノード番号をまとめるメソッド
+template<typename T>
+uint64_t ConcurrentStack<T>::makeTagged(uint64_t tag, uint32_t index) {
+    return (tag << 32) | index;
+}
+
+// ノード番号を取り出すメソッド
+template<typename T>
+uint32_t ConcurrentStack<T>::indexOf(uint64_t tagged) {
+    return static_cast<uint32_t>(tagged);
+}
+
+// 変更回数を取り出すメソッド
+template<typename T>
+uint64_t ConcurrentStack<T>::tagOf(uint64_t tagged) {
+    return tagged >> 32;
+}
+
+// 消去配列の位置をスレッドごとの乱数 (xorshift) で選ぶメソッド
+template<typename T>
+int ConcurrentStack<T>::pickSlot() {
+    static thread_local uint32_t seed = static_cast<uint32_t>(std::hash<std::thread::id>()(std::this_thread::get_id())) | 1;
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return static_cast<int>(seed % EliminationSize);
+}
+
+// ノードの要素を取得するメソッド
+template<typename T>
+T* ConcurrentStack<T>::item(uint32_t index) const {
+    return reinterpret_cast<T*>(&nodes[index].storage);
+}
+
+// ノードをリストの先頭に繋ぐメソッド
+template<typename T>
+void ConcurrentStack<T>::pushNode(std::atomic<uint64_t>& head, uint32_t index) {
+    uint64_t old = head.load(std::memory_order_relaxed);
+    do {
+        nodes[index].next.store(indexOf(old), std::memory_order_relaxed);
+    } while (!head.compare_exchange_weak(old, makeTagged(tagOf(old) + 1, index), std::memory_order_release, std::memory_order_relaxed));
+}
+
+// リストの先頭のノードを外すメソッド
+// 読んだ先頭が外されて戻されていても、変更回数が変わっているため compare_exchange が失敗する
+template<typename T>
+uint32_t ConcurrentStack<T>::popNode(std::atomic<uint64_t>& head) {
+    uint64_t old = head.load(std::memory_order_acquire);
+    while (indexOf(old) != NullIndex) {
+        uint32_t next = nodes[indexOf(old)].next.load(std::memory_order_relaxed);
+        if (head.compare_exchange_weak(old, makeTagged(tagOf(old) + 1, next), std::memory_order_acquire, std::memory_order_acquire)) {
+            return indexOf(old);
+        }
+    }
+    return NullIndex;
+}
+
+// 消去配列でノードをポップ側に渡すメソッド
+// 引数: uint32_t index - 要素を構築したノードの番号
+// 戻り値: ポップ側が受け取った場合は true、相手が来ずに取り下げた場合は false
+template<typename T>
+bool ConcurrentStack<T>::eliminatePush(uint32_t index) {
+    // 世代を含めるため、受け取られた同じノードが再び置かれても別の値になる
+    uint64_t offer = makeTagged(nodes[index].generation, index);
+    EliminationSlot& slot = eliminationSlots[pickSlot()];
+    uint64_t expected = 0;
+    if (!slot.offer.compare_exchange_strong(expected, offer, std::memory_order_release, std::memory_order_relaxed)) {
+        return false;
+    }
+    for (int i = 0; i < EliminationSpins; ++i) {
+        if (slot.offer.load(std::memory_order_relaxed) != offer) return true;
+    }
+    expected = offer;
+    return !slot.offer.compare_exchange_strong(expected, 0, std::memory_order_relaxed, std::memory_order_relaxed);
+}
+
+// 消去配列からノードを受け取るメソッド
+// 戻り値: 受け取ったノードの番号 (置かれていなかった場合や先を越された場合は NullIndex)
+template<typename T>
+uint32_t ConcurrentStack<T>::eliminatePop() {
+    EliminationSlot& slot = eliminationSlots[pickSlot()];
+    uint64_t offer = slot.offer.load(std::memory_order_relaxed);
+    if (offer == 0) return NullIndex;
+    if (slot.offer.compare_exchange_strong(offer, 0, std::memory_order_acquire, std::memory_order_relaxed)) {
+        return indexOf(offer);
+    }
+    return NullIndex;
+}
+
+// 要素を構築したノードをスタックに積むメソッド
+template<typename T>
+void ConcurrentStack<T>::pushValue(uint32_t index) {
+    SpinWait wait;
+    uint64_t old = top.load(std::memory_order_relaxed);
+    for (;;) {
+        nodes[index].next.store(indexOf(old), std::memory_order_relaxed);
+        if (top.compare_exchange_weak(old, makeTagged(tagOf(old) + 1, index), std::memory_order_release, std::memory_order_relaxed)) {
+            return;
+        }
+        if (elimination && eliminatePush(index)) return;
+        wait.Pause();
+        old = top.load(std::memory_order_relaxed);
+    }
+}
+
+// スタックからノードを外すメソッド
+template<typename T>
+uint32_t ConcurrentStack<T>::popValue() {
+    SpinWait wait;
+    uint64_t old = top.load(std::memory_order_acquire);
+    while (indexOf(old) != NullIndex) {
+        uint32_t next = nodes[indexOf(old)].next.load(std::memory_order_relaxed);
+        if (top.compare_exchange_weak(old, makeTagged(tagOf(old) + 1, next), std::memory_order_acquire, std::memory_order_acquire)) {
+            return indexOf(old);
+        }
+        if (elimination) {
+            uint32_t index = eliminatePop();
+            if (index != NullIndex) return index;
+        }
+        wait.Pause();
+        old = top.load(std::memory_order_acquire);
+    }
+    return NullIndex;
+}
+
+// 満杯でなければデータをプッシュするメソッド
+// 取り出したノードは必ず積む必要があるため、コピーはノードを取り出す前に済ませておく
+template<typename T>
+bool ConcurrentStack<T>::TryPush(const T& data) {
+    T copy(data);
+    return TryPush(std::move(copy));
+}
+
+// 満杯でなければデータをムーブしてプッシュするメソッド
+template<typename T>
+bool ConcurrentStack<T>::TryPush(T&& data) {
+    uint32_t index = popNode(freeTop);
+    if (index == NullIndex) return false;
+    if (++nodes[index].generation == 0) {
+        nodes[index].generation = 1;
+    }
+    new (item(index)) T(std::move(data));
+    pushValue(index);
+    return true;
+}
+
+// 空きができるまで待ってデータをプッシュするメソッド
+template<typename T>
+void ConcurrentStack<T>::Push(const T& data) {
+    Push(T(data));
+}
+
+// 空きができるまで待ってデータをムーブしてプッシュするメソッド
+template<typename T>
+void ConcurrentStack<T>::Push(T&& data) {
+    SpinWait wait;
+    while (!TryPush(std::move(data))) {
+        wait.Pause();
+    }
+}
+
+// 空でなければデータをムーブしてポップするメソッド
+template<typename T>
+bool ConcurrentStack<T>::TryPop(T& data) {
+    uint32_t index = popValue();
+    if (index == NullIndex) return false;
+    data = std::move(*item(index));
+    item(index)->~T();
+    pushNode(freeTop, index);
+    return true;
+}
+
+// データをムーブしてポップするメソッド
+template<typename T>
+T ConcurrentStack<T>::Pop() {
+    uint32_t index = popValue();
+    if (index == NullIndex) {
+        throw std::out_of_range("Stack is empty");
+    }
+    T data = std::move(*item(index));
+    item(index)->~T();
+    pushNode(freeTop, index);
+    return data;
+}
+
+// スタックが空かどうかを判定するメソッド
+template<typename T>
+bool ConcurrentStack<T>::IsEmpty() const {
+    return indexOf(top.load(std::memory_order_acquire)) == NullIndex;
+}
+
+// 容量を取得するメソッド
+template<typename T>
+size_t ConcurrentStack<T>::GetCapacity() const {
+    return capacity;
+}
+
+// ConcurrentStack デストラクタ
+template<typename T>
+ConcurrentStack<T>::~ConcurrentStack() {
+    for (uint32_t index = indexOf(top.load(std::memory_order_relaxed)); index != NullIndex; index = nodes[index].next.load(std::memory_order_relaxed)) {
+        item(index)->~T();
+    }
+    delete[] nodes;
+}
+
+// BoundedQueue メソッドの実装
+
+// BoundedQueue コンストラクタ
+template<typename T, typename Storage>
+BoundedQueue<T, Storage>::BoundedQueue(size_t capacity) : queue(), capacity(capacity > 0 ? capacity : 1), closed(false) {}
+
+// データをプッシュするメソッド
+// 引数: U&& data - プッシュするデータ
+//       bool wait - 満杯の場合に空きができるまで待つ場合は true
+// 戻り値: プッシュした場合は true、満杯で待たない場合や閉じられた場合は false
+template<typename T, typename Storage>
+template<typename U>
+bool BoundedQueue<T, Storage>::push(U&& data, bool wait) {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (wait) {
+        notFull.wait(lock, [this] { return closed || static_cast<size_t>(queue.GetSize()) < capacity; });
+    }
+    if (closed || static_cast<size_t>(queue.GetSize()) >= capacity) return false;
+    queue.Push(std::forward<U>(data));
+    // 起こされたスレッドがすぐにロックを取れるよう、解放してから通知する
+    lock.unlock();
+    notEmpty.notify_one();
+    return true;
+}
+
+// 満杯でなければデータをプッシュするメソッド
+template<typename T, typename Storage>
+bool BoundedQueue<T, Storage>::TryPush(const T& data) {
+    return push(data, false);
+}
+
+// 満杯でなければデータをムーブしてプッシュするメソッド
+template<typename T, typename Storage>
+bool BoundedQueue<T, Storage>::TryPush(T&& data) {
+    return push(std::move(data), false);
+}
+
+// 空きができるまで待ってデータをプッシュするメソッド
+template<typename T, typename Storage>
+bool BoundedQueue<T, Storage>::Push(const T& data) {
+    return push(data, true);
+}
+
+// 空きができるまで待ってデータをムーブしてプッシュするメソッド
+template<typename T, typename Storage>
+bool BoundedQueue<T, Storage>::Push(T&& data) {
+    return push(std::move(data), true);
+}
+
+// 空でなければデータをムーブしてポップするメソッド
+template<typename T, typename Storage>
+bool BoundedQueue<T, Storage>::TryPop(T& data) {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (!queue.TryPop(data)) return false;
+    lock.unlock();
+    notFull.notify_one();
+    return true;
+}
+
+// データが届くまで待ってポップするメソッド
+template<typename T, typename Storage>
+T BoundedQueue<T, Storage>::Pop() {
+    std::unique_lock<std::mutex> lock(mutex);
+    notEmpty.wait(lock, [this] { return closed || !queue.IsEmpty(); });
+    if (queue.IsEmpty()) {
+        throw std::out_of_range("Queue is closed");
+    }
+    T data = queue.Pop();
+    lock.unlock();
+    notFull.notify_one();
+    return data;
+}
+
+// ロック中に最大 maxItems 個を取り出すメソッド
+// 引数: std::unique_lock<std::mutex>& lock - 取得済みのロック (戻る時には解放されている)
+//       Container& container - 取り出した要素を末尾に追加するコンテナ
+//       size_t maxItems - 取り出す最大数
+// 戻り値: 取り出した数
+template<typename T, typename Storage>
+template<typename Container>
+size_t BoundedQueue<T, Storage>::drain(std::unique_lock<std::mutex>& lock, Container& container, size_t maxItems) {
+    size_t count = 0;
+    while (count < maxItems && !queue.IsEmpty()) {
+        container.push_back(queue.Pop());
+        count++;
+    }
+    lock.unlock();
+    // 複数の空きができた場合は、待っている生産者を全て起こす
+    if (count == 1) {
+        notFull.notify_one();
+    }
+    else if (count > 1) {
+        notFull.notify_all();
+    }
+    return count;
+}
+
+// 今ある要素をまとめて取り出すメソッド
+// 引数: Container& container - 取り出した要素を末尾に追加するコンテナ (push_back を持つもの)
+//       size_t maxItems - 取り出す最大数
+// 戻り値: 取り出した数 (空の場合は 0)
+template<typename T, typename Storage>
+template<typename Container>
+size_t BoundedQueue<T, Storage>::TryDrainTo(Container& container, size_t maxItems) {
+    std::unique_lock<std::mutex> lock(mutex);
+    return drain(lock, container, maxItems);
+}
+
+// 1 個以上届くまで待ってまとめて取り出すメソッド
+// 引数: Container& container - 取り出した要素を末尾に追加するコンテナ (push_back を持つもの)
+//       size_t maxItems - 取り出す最大数
+// 戻り値: 取り出した数 (閉じられて空の場合は 0)
+template<typename T, typename Storage>
+template<typename Container>
+size_t BoundedQueue<T, Storage>::DrainTo(Container& container, size_t maxItems) {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (maxItems > 0) {
+        notEmpty.wait(lock, [this] { return closed || !queue.IsEmpty(); });
+    }
+    return drain(lock, container, maxItems);
+}
+
+// これ以上プッシュしないことを通知するメソッド
+template<typename T, typename Storage>
+void BoundedQueue<T, Storage>::Close() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        closed = true;
+    }
+    notFull.notify_all();
+    notEmpty.notify_all();
+}
+
+// 閉じられたかどうかを判定するメソッド
+template<typename T, typename Storage>
+bool BoundedQueue<T, Storage>::IsClosed() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return closed;
+}
+
+// キューが空かどうかを判定するメソッド
+template<typename T, typename Storage>
+bool BoundedQueue<T, Storage>::IsEmpty() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return queue.IsEmpty();
+}
+
+// キューのサイズを取得するメソッド
+template<typename T, typename Storage>
+int BoundedQueue<T, Storage>::GetSize() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return queue.GetSize();
+}
+
+// 容量を取得するメソッド
+template<typename T, typename Storage>
+size_t BoundedQueue<T, Storage>::GetCapacity() const {
+    return capacity;
+}
+
+// WorkStealingDeque メソッドの実装
+
+// Ring コンストラクタ
+template<typename T>
+WorkStealingDeque<T>::Ring::Ring(size_t capacity) : capacity(capacity), elements(new std::atomic<T>[capacity]) {}
+
+// Ring デストラクタ
+template<typename T>
+WorkStealingDeque<T>::Ring::~Ring() {
+    delete[] elements;
+}
+
+// 位置の要素を取得するメソッド
+template<typename T>
+T WorkStealingDeque<T>::Ring::Get(int64_t position) const {
+    return elements[static_cast<size_t>(position) & (capacity - 1)].load(std::memory_order_relaxed);
+}
+
+// 位置に要素を格納するメソッド
+template<typename T>
+void WorkStealingDeque<T>::Ring::Put(int64_t position, T data) {
+    elements[static_cast<size_t>(position) & (capacity - 1)].store(data, std::memory_order_relaxed);
+}
+
+// WorkStealingDeque コンストラクタ
+template<typename T>
+WorkStealingDeque<T>::WorkStealingDeque(size_t capacity) : top(0), bottom(0), ring(nullptr) {
+    size_t length = 2;
+    while (length < capacity) {
+        length <<= 1;
+    }
+    ring.store(new Ring(length), std::memory_order_relaxed);
+}
+
+// リングを 2 倍の長さに移し替えるメソッド
+// 引数: Ring* current - 現在のリング
+//       int64_t first, int64_t last - 格納中の要素の範囲 [first, last)
+// 戻り値: 新しいリング
+template<typename T>
+typename WorkStealingDeque<T>::Ring* WorkStealingDeque<T>::grow(Ring* current, int64_t first, int64_t last) {
+    Ring* larger = new Ring(current->capacity * 2);
+    for (int64_t position = first; position < last; ++position) {
+        larger->Put(position, current->Get(position));
+    }
+    retired.push_back(current);
+    ring.store(larger, std::memory_order_release);
+    return larger;
+}
+
+// 末尾にプッシュするメソッド
+template<typename T>
+void WorkStealingDeque<T>::Push(T data) {
+    int64_t last = bottom.load(std::memory_order_relaxed);
+    int64_t first = top.load(std::memory_order_acquire);
+    Ring* current = ring.load(std::memory_order_relaxed);
+    if (last - first > static_cast<int64_t>(current->capacity) - 1) {
+        current = grow(current, first, last);
+    }
+    current->Put(last, data);
+    // 要素を書いてから末尾を進めたことが、盗むスレッドから見えるようにする
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom.store(last + 1, std::memory_order_relaxed);
+}
+
+// 末尾からポップするメソッド
+// 末尾を先に 1 つ戻してから先頭を読むことで、盗むスレッドとは最後の 1 要素だけを取り合う
+template<typename T>
+bool WorkStealingDeque<T>::Pop(T& data) {
+    int64_t last = bottom.load(std::memory_order_relaxed) - 1;
+    Ring* current = ring.load(std::memory_order_relaxed);
+    bottom.store(last, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t first = top.load(std::memory_order_relaxed);
+
+    if (first > last) {
+        bottom.store(last + 1, std::memory_order_relaxed);
+        return false;
+    }
+    data = current->Get(last);
+    if (first < last) return true;
+
+    // 最後の 1 要素は、先頭を進めることで盗むスレッドと取り合う
+    bool won = top.compare_exchange_strong(first, first + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    bottom.store(last + 1, std::memory_order_relaxed);
+    return won;
+}
+
+// 先頭から盗むメソッド
+template<typename T>
+bool WorkStealingDeque<T>::Steal(T& data) {
+    int64_t first = top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t last = bottom.load(std::memory_order_acquire);
+    if (first >= last) return false;
+
+    Ring* current = ring.load(std::memory_order_acquire);
+    T candidate = current->Get(first);
+    if (!top.compare_exchange_strong(first, first + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+        return false;
+    }
+    data = candidate;
+    return true;
+}
+
+// 両端キューが空かどうかを判定するメソッド
+template<typename T>
+bool WorkStealingDeque<T>::IsEmpty() const {
+    return bottom.load(std::memory_order_relaxed) <= top.load(std::memory_order_relaxed);
+}
+
+// 現在のリングの長さを取得するメソッド
+template<typename T>
+size_t WorkStealingDeque<T>::GetCapacity() const {
+    return ring.load(std::memory_order_relaxed)->capacity;
+}
+
+// WorkStealingDeque デストラクタ
+template<typename T>
+WorkStealingDeque<T>::~WorkStealingDeque() {
+    delete ring.load(std::memory_order_relaxed);
+    for (Ring* old : retired) {
+        delete old;
+    }
+}
+
+// DelayQueue メソッドの実装
+
+// DelayQueue コンストラクタ
+template<typename T>
+DelayQueue<T>::DelayQueue(Duration tickLength) : nodes(), freeHead(NullIndex), current(0), origin(Clock::now()),
+    tickLength(tickLength > Duration::zero() ? tickLength : Duration(1)), wakeTick(std::numeric_limits<uint64_t>::max()), waiters(0), closed(false) {
+    for (int level = 0; level < LevelCount; ++level) {
+        for (uint32_t slot = 0; slot < SlotCount; ++slot) {
+            clear(wheel[level][slot]);
+        }
+        levelSizes[level] = 0;
+    }
+    clear(ready);
+}
+
+// リストの末尾にノードを繋ぐメソッド
+template<typename T>
+void DelayQueue<T>::append(List& list, uint32_t index) {
+    nodes[index].next = NullIndex;
+    if (list.tail == NullIndex) {
+        list.head = index;
+    }
+    else {
+        nodes[list.tail].next = index;
+    }
+    list.tail = index;
+    list.count++;
+}
+
+// リストを空にするメソッド
+template<typename T>
+void DelayQueue<T>::clear(List& list) {
+    list.head = NullIndex;
+    list.tail = NullIndex;
+    list.count = 0;
+}
+
+// 期限を刻みに切り上げるメソッド (期限の刻みを処理した時点で必ず期限を過ぎている)
+template<typename T>
+uint64_t DelayQueue<T>::tickOf(TimePoint deadline) const {
+    if (deadline <= origin) return 0;
+    Duration elapsed = deadline - origin;
+    uint64_t tick = static_cast<uint64_t>(elapsed / tickLength);
+    return elapsed % tickLength == Duration::zero() ? tick : tick + 1;
+}
+
+// 経過した刻み数を取得するメソッド
+template<typename T>
+uint64_t DelayQueue<T>::elapsedTicks(TimePoint now) const {
+    if (now <= origin) return 0;
+    return static_cast<uint64_t>((now - origin) / tickLength);
+}
+
+// 刻みの開始時刻を取得するメソッド (表せない場合は TimePoint::max())
+template<typename T>
+typename DelayQueue<T>::TimePoint DelayQueue<T>::timeOf(uint64_t tick) const {
+    uint64_t limit = static_cast<uint64_t>((TimePoint::max() - origin) / tickLength);
+    if (tick >= limit) return TimePoint::max();
+    return origin + tickLength * static_cast<typename Duration::rep>(tick);
+}
+
+// ホイール上の要素数を取得するメソッド
+template<typename T>
+size_t DelayQueue<T>::wheelSize() const {
+    size_t size = 0;
+    for (int level = 0; level < LevelCount; ++level) {
+        size += levelSizes[level];
+    }
+    return size;
+}
+
+// データを期限付きでプッシュするメソッド
+// 引数: U&& data - プッシュするデータ
+//       TimePoint deadline - ポップできるようになる時刻
+// 戻り値: プッシュした場合は true、閉じられている場合は false
+template<typename T>
+template<typename U>
+bool DelayQueue<T>::push(U&& data, TimePoint deadline) {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (closed) return false;
+
+    uint64_t tick = tickOf(deadline);
+    uint32_t index = freeHead;
+    if (index != NullIndex) {
+        freeHead = nodes[index].next;
+        nodes[index].data = std::forward<U>(data);
+        nodes[index].tick = tick;
+    }
+    else {
+        index = static_cast<uint32_t>(nodes.size());
+        nodes.push_back(Node{ std::forward<U>(data), tick, NullIndex });
+    }
+    schedule(index);
+
+    // 待っているスレッドが起きる予定より早い期限の場合だけ起こして、眠る時刻を計算し直させる
+    bool wake = waiters > 0 && tick < wakeTick;
+    lock.unlock();
+    if (wake) {
+        changed.notify_all();
+    }
+    return true;
+}
+
+// ノードを期限に応じた段と枠に入れるメソッド
+// 期限までの刻み数が 256 未満なら 0 段目、65536 未満なら 1 段目…の、期限の刻みの該当ビットが示す枠に入れる
+// 最上段でも表せない遠い期限は最上段の最も遠い枠に入れ、振り分け直す時に改めて配置する
+template<typename T>
+void DelayQueue<T>::schedule(uint32_t index) {
+    uint64_t tick = nodes[index].tick;
+    if (tick < current) {
+        append(ready, index);
+        return;
+    }
+
+    uint64_t delta = tick - current;
+    if (delta > MaxDelta) {
+        delta = MaxDelta;
+        tick = current + MaxDelta;
+    }
+    int level = 0;
+    while (level < LevelCount - 1 && delta >= (1ull << (LevelBits * (level + 1)))) {
+        level++;
+    }
+    append(wheel[level][(tick >> (LevelBits * level)) & (SlotCount - 1)], index);
+    levelSizes[level]++;
+}
+
+// 現在の刻みに対応する上の段の枠を下の段へ振り分け直すメソッド
+template<typename T>
+void DelayQueue<T>::cascade(int level) {
+    List& slot = wheel[level][(current >> (LevelBits * level)) & (SlotCount - 1)];
+    uint32_t index = slot.head;
+    levelSizes[level] -= slot.count;
+    clear(slot);
+    while (index != NullIndex) {
+        uint32_t next = nodes[index].next;
+        schedule(index);
+        index = next;
+    }
+}
+
+// 次に処理が必要な刻みを取得するメソッド (ホイールが空でない場合に呼ぶ)
+// 0 段目の現在の周回に要素があればその刻み、なければ要素のある段を振り分け直す境目の刻みを返す
+// current がまだ振り分け直していない境目にある場合 (前回の advance が境目で止まった場合) は、0 段目より先に current を返す
+template<typename T>
+uint64_t DelayQueue<T>::nextEventTick() const {
+    if ((current & (SlotCount - 1)) == 0 && wheelSize() > levelSizes[0]) {
+        return current;
+    }
+    if (levelSizes[0] > 0) {
+        uint64_t base = current & ~static_cast<uint64_t>(SlotCount - 1);
+        for (uint64_t slot = current & (SlotCount - 1); slot < SlotCount; ++slot) {
+            if (wheel[0][slot].count > 0) return base + slot;
+        }
+    }
+
+    // 下の段が続けて空なら、より粗い境目まで何も起きない
+    int level = 1;
+    while (level < LevelCount - 1 && levelSizes[level - 1] == 0 && levelSizes[level] == 0) {
+        level++;
+    }
+    uint64_t span = 1ull << (LevelBits * level);
+    return (current + span - 1) & ~(span - 1);
+}
+
+// nowTick までの刻みを処理するメソッド
+// 何も起きない刻みは nextEventTick で飛ばすため、長く呼ばれなかった後でも処理は要素のある枠と境目の数で済む
+template<typename T>
+void DelayQueue<T>::advance(uint64_t nowTick) {
+    while (current <= nowTick) {
+        if (wheelSize() == 0) {
+            current = nowTick + 1;
+            return;
+        }
+        uint64_t next = nextEventTick();
+        if (next > nowTick) {
+            current = nowTick + 1;
+            return;
+        }
+        current = next;
+
+        if ((current & (SlotCount - 1)) == 0) {
+            for (int level = 1; level < LevelCount; ++level) {
+                cascade(level);
+                if (((current >> (LevelBits * level)) & (SlotCount - 1)) != 0) break;
+            }
+        }
+
+        // 0 段目の枠は 1 刻み分なので、リストごと ready の末尾に繋ぎ替える
+        List& slot = wheel[0][current & (SlotCount - 1)];
+        if (slot.count > 0) {
+            if (ready.tail == NullIndex) {
+                ready.head = slot.head;
+            }
+            else {
+                nodes[ready.tail].next = slot.head;
+            }
+            ready.tail = slot.tail;
+            ready.count += slot.count;
+            levelSizes[0] -= slot.count;
+            clear(slot);
+        }
+        current++;
+    }
+}
+
+// ready の先頭をポップするメソッド
+template<typename T>
+bool DelayQueue<T>::popReady(T& data) {
+    uint32_t index = ready.head;
+    if (index == NullIndex) return false;
+
+    ready.head = nodes[index].next;
+    if (ready.head == NullIndex) {
+        ready.tail = NullIndex;
+    }
+    ready.count--;
+    data = std::move(nodes[index].data);
+    nodes[index].next = freeHead;
+    freeHead = index;
+    return true;
+}
+
+// 期限を過ぎた要素が出るまで待ってポップするメソッド
+// 引数: T& data - ポップしたデータの格納先
+//       bool timed - deadline で打ち切る場合は true
+//       TimePoint deadline - 待つのをやめる時刻
+// 戻り値: ポップした場合は true、時間切れや閉じられて空の場合は false
+template<typename T>
+bool DelayQueue<T>::wait(T& data, bool timed, TimePoint deadline) {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        TimePoint now = Clock::now();
+        advance(elapsedTicks(now));
+        if (popReady(data)) {
+            // 同じ刻みで複数の要素が期限を過ぎた場合は、他の待っているスレッドにも取らせる
+            bool more = ready.count > 0 && waiters > 0;
+            lock.unlock();
+            if (more) {
+                changed.notify_one();
+            }
+            return true;
+        }
+        if (closed && wheelSize() == 0) return false;
+        if (timed && now >= deadline) return false;
+
+        TimePoint wake = TimePoint::max();
+        wakeTick = std::numeric_limits<uint64_t>::max();
+        if (wheelSize() > 0) {
+            wakeTick = nextEventTick();
+            wake = timeOf(wakeTick);
+        }
+        if (timed && deadline < wake) {
+            wake = deadline;
+        }
+
+        waiters++;
+        if (wake == TimePoint::max()) {
+            changed.wait(lock);
+        }
+        else {
+            changed.wait_until(lock, wake);
+        }
+        waiters--;
+    }
+}
+
+// delay 後にポップできるようにデータをプッシュするメソッド
+template<typename T>
+bool DelayQueue<T>::Push(const T& data, Duration delay) {
+    return push(data, Clock::now() + delay);
+}
+
+// delay 後にポップできるようにデータをムーブしてプッシュするメソッド
+template<typename T>
+bool DelayQueue<T>::Push(T&& data, Duration delay) {
+    return push(std::move(data), Clock::now() + delay);
+}
+
+// deadline 以降にポップできるようにデータをプッシュするメソッド
+template<typename T>
+bool DelayQueue<T>::PushAt(const T& data, TimePoint deadline) {
+    return push(data, deadline);
+}
+
+// deadline 以降にポップできるようにデータをムーブしてプッシュするメソッド
+template<typename T>
+bool DelayQueue<T>::PushAt(T&& data, TimePoint deadline) {
+    return push(std::move(data), deadline);
+}
+
+// 期限を過ぎた要素があればポップするメソッド
+template<typename T>
+bool DelayQueue<T>::TryPopReady(T& data) {
+    std::lock_guard<std::mutex> lock(mutex);
+    advance(elapsedTicks(Clock::now()));
+    return popReady(data);
+}
+
+// 期限を過ぎた要素が出るまで最大 timeout 待ってポップするメソッド
+template<typename T>
+bool DelayQueue<T>::PopReady(T& data, Duration timeout) {
+    TimePoint now = Clock::now();
+    if (timeout > TimePoint::max() - now) {
+        return wait(data, false, TimePoint::max());
+    }
+    return wait(data, true, now + timeout);
+}
+
+// これ以上プッシュしないことを通知するメソッド
+template<typename T>
+void DelayQueue<T>::Close() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        closed = true;
+    }
+    changed.notify_all();
+}
+
+// 閉じられたかどうかを判定するメソッド
+template<typename T>
+bool DelayQueue<T>::IsClosed() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return closed;
+}
+
+// 期限前の要素も含めてキューが空かどうかを判定するメソッド
+template<typename T>
+bool DelayQueue<T>::IsEmpty() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return ready.count == 0 && wheelSize() == 0;
+}
+
+// 期限前の要素も含めたキューのサイズを取得するメソッド
+template<typename T>
+size_t DelayQueue<T>::GetSize() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return ready.count + wheelSize();
+}
+
+#endif // CONCURRENT_SQ_INL
@@ -0,0 +1,219 @@
+#ifndef NODE_POOL_INL
+#define NODE_POOL_INL
+
+#include <new>
+
+// LocalHolder デストラクタ (スレッドの終了時にプールを手放す)
+template<size_t Size, size_t Align>
+NodePool<Size, Align>::LocalHolder::~LocalHolder() {
+    // 以降に他のスレッドローカル変数の破棄で解放される領域は、他のスレッドからの解放として扱う
+    NodePool* abandoned = pool;
+    pool = nullptr;
+    if (abandoned != nullptr) {
+        abandoned->abandon();
+    }
+}
+
+// 呼び出し元スレッドのプールの保持クラスを取得するメソッド
+template<size_t Size, size_t Align>
+typename NodePool<Size, Align>::LocalHolder& NodePool<Size, Align>::holder() {
+    thread_local LocalHolder localHolder;
+    return localHolder;
+}
+
+// 呼び出し元スレッドのプールを取得するメソッド
+template<size_t Size, size_t Align>
+NodePool<Size, Align>& NodePool<Size, Align>::local() {
+    LocalHolder& localHolder = holder();
+    if (localHolder.pool == nullptr) {
+        localHolder.pool = new NodePool();
+    }
+    return *localHolder.pool;
+}
+
+// NodePool コンストラクタ
+template<size_t Size, size_t Align>
+NodePool<Size, Align>::NodePool()
+    : freeList(nullptr), cursor(nullptr), limit(nullptr), live(0), remoteList(nullptr), remoteCount(0), orphaned(false), hasRemote(false) {}
+
+// NodePool デストラクタ
+template<size_t Size, size_t Align>
+NodePool<Size, Align>::~NodePool() {
+    for (Slot* page : pages) {
+        ::operator delete(page);
+    }
+}
+
+// 領域を切り出すメソッド
+template<size_t Size, size_t Align>
+typename NodePool<Size, Align>::Slot* NodePool<Size, Align>::allocateSlot() {
+    if (freeList == nullptr && hasRemote.load(std::memory_order_acquire)) {
+        collectRemote();
+    }
+
+    Slot* slot = freeList;
+    if (slot != nullptr) {
+        freeList = slot->next;
+    }
+    else {
+        if (cursor == limit) {
+            addPage();
+        }
+        slot = cursor++;
+        slot->owner = this;
+    }
+    live++;
+    return slot;
+}
+
+// 確保元のスレッドで領域を解放するメソッド
+template<size_t Size, size_t Align>
+void NodePool<Size, Align>::freeLocal(Slot* slot) {
+    slot->next = freeList;
+    freeList = slot;
+    if (--live == 0) {
+        releasePages();
+    }
+}
+
+// 他のスレッドで領域を解放するメソッド
+template<size_t Size, size_t Align>
+void NodePool<Size, Align>::freeRemote(Slot* slot) {
+    bool last = false;
+    {
+        std::lock_guard<std::mutex> lock(remoteMutex);
+        if (orphaned) {
+            // 確保元のスレッドはもう確保しないため、数えるだけでよい
+            last = --live == 0;
+        }
+        else {
+            slot->next = remoteList;
+            remoteList = slot;
+            remoteCount++;
+            hasRemote.store(true, std::memory_order_release);
+        }
+    }
+    if (last) {
+        delete this;
+    }
+}
+
+// ページを追加するメソッド
+template<size_t Size, size_t Align>
+void NodePool<Size, Align>::addPage() {
+    Slot* page = static_cast<Slot*>(::operator new(SlotsPerPage * sizeof(Slot)));
+    pages.push_back(page);
+    cursor = page;
+    limit = page + SlotsPerPage;
+}
+
+// 他のスレッドから解放された領域を回収するメソッド
+template<size_t Size, size_t Align>
+void NodePool<Size, Align>::collectRemote() {
+    Slot* collected;
+    size_t count;
+    {
+        std::lock_guard<std::mutex> lock(remoteMutex);
+        collected = remoteList;
+        count = remoteCount;
+        remoteList = nullptr;
+        remoteCount = 0;
+        hasRemote.store(false, std::memory_order_relaxed);
+    }
+    while (collected != nullptr) {
+        Slot* next = collected->next;
+        collected->next = freeList;
+        freeList = collected;
+        collected = next;
+    }
+    live -= count;
+}
+
+// 全ての領域が解放されたプールのページを返すメソッド
+// 挿入と削除を 1 件ずつ繰り返す場合にページの確保と解放を繰り返さないよう、切り出し中のページ 1 枚は残す
+template<size_t Size, size_t Align>
+void NodePool<Size, Align>::releasePages() {
+    if (pages.empty()) return;
+
+    Slot* current = pages.back();
+    for (size_t i = 0; i + 1 < pages.size(); ++i) {
+        ::operator delete(pages[i]);
+    }
+    pages.assign(1, current);
+    freeList = nullptr;
+    cursor = current;
+    limit = current + SlotsPerPage;
+}
+
+// 確保元のスレッドの終了時にプールを手放すメソッド
+template<size_t Size, size_t Align>
+void NodePool<Size, Align>::abandon() {
+    bool empty;
+    {
+        std::lock_guard<std::mutex> lock(remoteMutex);
+        live -= remoteCount;
+        remoteList = nullptr;
+        remoteCount = 0;
+        orphaned = true;
+        empty = live == 0;
+    }
+    if (empty) {
+        delete this;
+    }
+}
+
+// 領域を確保するメソッド
+template<size_t Size, size_t Align>
+void* NodePool<Size, Align>::Allocate() {
+    return &local().allocateSlot()->storage;
+}
+
+// 領域を解放するメソッド
+template<size_t Size, size_t Align>
+void NodePool<Size, Align>::Deallocate(void* memory) {
+    Slot* slot = reinterpret_cast<Slot*>(static_cast<char*>(memory) - offsetof(Slot, storage));
+    NodePool* owner = slot->owner;
+    if (owner == holder().pool) {
+        owner->freeLocal(slot);
+    }
+    else {
+        owner->freeRemote(slot);
+    }
+}
+
+// 呼び出し元スレッドのプールが確保しているページ数を取得するメソッド
+template<size_t Size, size_t Align>
+size_t NodePool<Size, Align>::GetPageCount() {
+    return local().pages.size();
+}
+
+// 呼び出し元スレッドのプールの使用中の領域数を取得するメソッド
+template<size_t Size, size_t Align>
+size_t NodePool<Size, Align>::GetLiveCount() {
+    NodePool& pool = local();
+    if (pool.hasRemote.load(std::memory_order_acquire)) {
+        pool.collectRemote();
+    }
+    return pool.live;
+}
+
+// 領域を確保するメソッド
+template<typename T>
+T* PoolAllocator<T>::allocate(size_t count) {
+    if (count == 1) {
+        return static_cast<T*>(Pool::Allocate());
+    }
+    return static_cast<T*>(::operator new(count * sizeof(T)));
+}
+
+// 領域を解放するメソッド
+template<typename T>
+void PoolAllocator<T>::deallocate(T* memory, size_t count) {
+    if (count == 1) {
+        Pool::Deallocate(memory);
+        return;
+    }
+    ::operator delete(memory);
+}
+
+#endif // NODE_POOL_INL
@@ -1,7 +1,10 @@
 #include <iostream>
 #include <fstream>
 #include <string>
+#include <thread>
+#include <vector>
 #include <gtest/gtest.h>
+#include "ConcurrentSQ.h"
 #include "SQ.h"
 
 /**
@@ -25,8 +28,12 @@ struct ResultData {
 
 int main(int argc, char** argv) {
     // テスト用のスタックとキューの使用例
+    // スタックは全てのデータを逆順に表示するため、ファイル全体を保持する (メモリ使用量はファイルの大きさに比例する)
+    // キューは有界にして、ファイルの読み直しと表示を並行させ、読み込みが表示より先に進んでも容量分しかメモリを使わないようにする
+    const size_t queueCapacity = 1024;
+    const size_t drainBatch = 64;
     Stack<ResultData> stack;
-    Queue<ResultData> queue;
+    BoundedQueue<ResultData> queue(queueCapacity);
 
     // ファイルを開く
     std::ifstream file("Scores.txt");
@@ -41,9 +48,8 @@ int main(int argc, char** argv) {
 
     // ファイルからデータを読み込む
     while (file >> data.score >> data.username) {
-        // データをスタックとキューにプッシュ
+        // データをスタックにプッシュ
         stack.Push(data);
-        queue.Push(data);
     }
 
     // スタックからデータをポップして表示
@@ -53,12 +59,27 @@ int main(int argc, char** argv) {
         std::cout << topData << std::endl;
     }
 
-    // キューからデータをポップして表示
+    // ファイルを先頭から読み直し、キューにプッシュするスレッド (キューが満杯の間は待つ)
+    file.clear();
+    file.seekg(0);
+    std::thread reader([&]() {
+        ResultData lineData;
+        while (file >> lineData.score >> lineData.username) {
+            queue.Push(lineData);
+        }
+        queue.Close();
+    });
+
+    // キューからデータをまとめて取り出して、読み込みと並行して表示
     std::cout << "Queue contents:" << std::endl;
-    while (!queue.IsEmpty()) {
-        ResultData frontData = queue.Pop();
-        std::cout << frontData << std::endl;
+    std::vector<ResultData> batch;
+    while (queue.DrainTo(batch, drainBatch) > 0) {
+        for (const ResultData& frontData : batch) {
+            std::cout << frontData << std::endl;
+        }
+        batch.clear();
     }
+    reader.join();
 
     // ファイルを閉じる
     file.close();
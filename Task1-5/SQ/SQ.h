@@ -1,13 +1,21 @@
 #ifndef SQ_H
 #define SQ_H
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
 #include <stdexcept>
+#include <utility>
+#include <vector>
+#include "NodePool.h"
 
 /**
  * @brief テンプレートクラス DoublyLinkedList
  * ダブルリンクリストの実装
+ * ノードは Allocator から確保する (既定では NodePool のページから切り出し、挿入・削除ごとの new / delete を避ける)
  */
-template<typename T>
+template<typename T, typename Allocator = PoolAllocator<T>>
 class DoublyLinkedList {
 private:
     struct Node {
@@ -15,11 +23,21 @@ private:
         Node* prev;
         Node* next;
         Node(const T& rd);
+        template<typename... Args>
+        explicit Node(Args&&... args); // データをその場で構築
     };
 
+    typedef typename std::allocator_traits<Allocator>::template rebind_alloc<Node> NodeAllocator;
+    typedef std::allocator_traits<NodeAllocator> NodeTraits;
+
     Node* head;
     Node* tail;
     int size;
+    NodeAllocator allocator; // ノードを確保するアロケータ
+
+    template<typename... Args>
+    Node* createNode(Args&&... args); // ノードを生成 (アロケータから確保する)
+    void destroyNode(Node* node); // ノードを破棄 (領域はアロケータに返す)
 
     void quickSort(Node* left, Node* right, const std::function<bool(const T&, const T&)>& comp);
     Node* partition(Node* left, Node* right, const std::function<bool(const T&, const T&)>& comp);
@@ -55,48 +73,183 @@ public:
         T& operator*();
     };
 
-    DoublyLinkedList();
+    explicit DoublyLinkedList(const Allocator& allocator = Allocator()); // コンストラクタ (省略時は既定のアロケータ)
+    DoublyLinkedList(const DoublyLinkedList&) = delete;
+    DoublyLinkedList& operator=(const DoublyLinkedList&) = delete;
     int Getsize() const;
     bool Insert(const Iterator& iter, const T& data);
+    template<typename... Args>
+    bool Emplace(const Iterator& iter, Args&&... args); // データをその場で構築して挿入
     bool Delete(const Iterator& iter);
     Iterator begin();
     ConstIterator beginConst() const;
     Iterator end();
     ConstIterator endConst() const;
     void Sort(const std::function<bool(const T&, const T&)>& comp);
+    void Clear(); // 全ノードを削除
     ~DoublyLinkedList();
 };
 
 /**
- * @brief スタッククラス
+ * @brief リスト方式のストレージ
+ * 要素ごとに二重連結リストのノードを確保する
  */
 template<typename T>
+class ListStorage {
+private:
+    DoublyLinkedList<T> list; // 要素を格納する二重連結リスト
+
+public:
+    ListStorage(); // コンストラクタ
+
+    template<typename... Args>
+    void EmplaceBack(Args&&... args); // 末尾に要素を構築
+    void PopBack(); // 末尾の要素を削除
+    void PopFront(); // 先頭の要素を削除
+    T& Front(); // 先頭の要素を取得
+    const T& Front() const; // 先頭の要素を取得
+    T& Back(); // 末尾の要素を取得
+    const T& Back() const; // 末尾の要素を取得
+    int GetSize() const; // 要素数を取得
+};
+
+/**
+ * @brief チャンク方式のストレージ
+ * 固定長のブロックに要素を連続して格納し、ブロックへのポインタをリングバッファで管理する
+ * 空になったブロックを 1 つ残しておき、ブロックの境界でプッシュとポップを繰り返しても確保と解放が続かないようにする
+ */
+template<typename T>
+class ChunkedStorage {
+private:
+    static const size_t BlockSize = sizeof(T) <= 256 ? 4096 / sizeof(T) : 16; // 1 ブロックの要素数
+
+    T** blocks;         // ブロックへのポインタのリング
+    size_t capacity;    // リングの長さ (0 または 2 のべき乗)
+    size_t firstBlock;  // 先頭の要素を含むブロックのリング上の位置
+    size_t blockCount;  // 使用中のブロック数
+    size_t firstOffset; // 先頭の要素のブロック内の位置
+    size_t size;        // 要素数
+    T* spare;           // 再利用のために残した空のブロック
+
+    T* slot(size_t index) const; // 先頭から index 番目の要素の格納場所を取得
+    T* acquireBlock(); // ブロックを確保 (残したブロックがあれば再利用)
+    void releaseBlock(T* block); // ブロックを解放 (まだ残していなければ残す)
+    void growRing(); // リングの長さを 2 倍にする
+
+public:
+    ChunkedStorage(); // コンストラクタ
+    ChunkedStorage(const ChunkedStorage&) = delete;
+    ChunkedStorage& operator=(const ChunkedStorage&) = delete;
+
+    template<typename... Args>
+    void EmplaceBack(Args&&... args); // 末尾に要素を構築
+    void PopBack(); // 末尾の要素を削除
+    void PopFront(); // 先頭の要素を削除
+    T& Front(); // 先頭の要素を取得
+    const T& Front() const; // 先頭の要素を取得
+    T& Back(); // 末尾の要素を取得
+    const T& Back() const; // 末尾の要素を取得
+    int GetSize() const; // 要素数を取得
+
+    ~ChunkedStorage(); // デストラクタ
+};
+
+/**
+ * @brief スタッククラス
+ * Storage に ChunkedStorage<T> を指定すると、要素をブロック単位でまとめて格納する
+ */
+template<typename T, typename Storage = ListStorage<T>>
 class Stack {
 private:
-    DoublyLinkedList<T> list; // 内部リストとして新しい二重連結リストを使用
+    Storage storage; // 要素を格納するストレージ
 
 public:
     Stack(); // コンストラクタ
 
     void Push(const T& data); // データをスタックにプッシュ
-    T Pop(); // スタックからデータをポップ
+    void Push(T&& data); // データをスタックにムーブしてプッシュ
+    template<typename... Args>
+    void Emplace(Args&&... args); // データをスタック上に直接構築
+    T Pop(); // スタックからデータをムーブしてポップ (空の場合は std::out_of_range)
+    bool TryPop(T& data); // スタックが空でなければデータをムーブしてポップ
+    T& Top(); // 先頭のデータを参照 (空の場合は std::out_of_range)
+    const T& Top() const; // 先頭のデータを参照 (空の場合は std::out_of_range)
     bool IsEmpty() const; // スタックが空かどうかを判定
     int GetSize() const; // スタックのサイズを取得
 };
 
 /**
  * @brief キュークラス
+ * Storage に ChunkedStorage<T> を指定すると、要素をブロック単位でまとめて格納する
  */
-template<typename T>
+template<typename T, typename Storage = ListStorage<T>>
 class Queue {
 private:
-    DoublyLinkedList<T> list; // 内部リストとして新しい二重連結リストを使用
+    Storage storage; // 要素を格納するストレージ
 
 public:
     Queue(); // コンストラクタ
 
     void Push(const T& data); // データをキューにプッシュ
-    T Pop(); // キューからデータをポップ
+    void Push(T&& data); // データをキューにムーブしてプッシュ
+    template<typename... Args>
+    void Emplace(Args&&... args); // データをキュー上に直接構築
+    T Pop(); // キューからデータをムーブしてポップ (空の場合は std::out_of_range)
+    bool TryPop(T& data); // キューが空でなければデータをムーブしてポップ
+    T& Front(); // 先頭のデータを参照 (空の場合は std::out_of_range)
+    const T& Front() const; // 先頭のデータを参照 (空の場合は std::out_of_range)
+    bool IsEmpty() const; // キューが空かどうかを判定
+    int GetSize() const; // キューのサイズを取得
+};
+
+/**
+ * @brief 優先度付きキュークラス
+ * 連続した配列上の 4 分木の暗黙ヒープ (子の比較が 1 つのキャッシュラインに収まりやすく、木の高さも 2 分ヒープの半分になる)
+ * Compare で見て最も大きい要素が先頭になる (std::less<T> の場合は最大値から取り出す)
+ * プッシュ時に返す識別子で、格納中の要素の優先度を後から上げられる
+ * 識別子は下位 32 ビットが枠の番号、上位 32 ビットが枠の世代で、ポップした枠は世代を進めてから再利用する
+ * (ポップ済みの識別子が、同じ枠に後から入った別の要素を指すことはない)
+ * Build も全ての枠の世代を進めるため、それより前に返した識別子は無効になる
+ */
+template<typename T, typename Compare = std::less<T>>
+class PriorityQueue {
+public:
+    typedef uint64_t Handle; // 要素の識別子 (枠の世代 << 32 | 枠の番号)
+
+private:
+    static const size_t Arity = 4; // 各ノードの子の数
+    static const size_t NoPosition = static_cast<size_t>(-1); // 格納されていない枠の位置
+    static const unsigned SlotBits = 32; // 識別子のうち枠の番号に使うビット数
+
+    // ヒープの要素
+    struct Entry {
+        T data;      // データ
+        size_t slot; // 枠の番号
+    };
+
+    std::vector<Entry> heap;             // ヒープ (先頭が根)
+    std::vector<size_t> positions;       // 枠ごとのヒープ上の位置
+    std::vector<uint32_t> generations;   // 枠ごとの世代 (ポップするたびに進める)
+    std::vector<size_t> freeSlots;       // 再利用できる枠
+    Compare comp;                        // 比較関数
+
+    size_t acquireSlot(); // 枠を確保 (解放済みのものがあれば再利用)
+    bool findSlot(Handle handle, size_t& slot) const; // 識別子が格納中の要素を指していれば枠の番号を求める
+    void place(size_t position, Entry&& entry); // 要素をヒープ上の位置に置き、枠の位置を更新
+    void siftUp(size_t position); // 要素を親より優先度が低くなるまで上げる
+    void siftDown(size_t position); // 要素を子より優先度が高くなるまで下げる
+
+public:
+    explicit PriorityQueue(const Compare& comp = Compare()); // コンストラクタ
+
+    Handle Push(const T& data); // データをプッシュして識別子を返す
+    Handle Push(T&& data); // データをムーブしてプッシュして識別子を返す
+    T Pop(); // 先頭のデータをムーブしてポップ (空の場合は std::out_of_range)
+    bool TryPop(T& data); // 空でなければ先頭のデータをムーブしてポップ
+    const T& Top() const; // 先頭のデータを参照 (空の場合は std::out_of_range)
+    bool DecreaseKey(Handle handle, const T& data); // 格納中の要素を優先度が下がらない値に置き換えて位置を直す
+    bool Contains(Handle handle) const; // 識別子の要素が格納中かどうかを判定
+    void Build(const DoublyLinkedList<T>& list, std::vector<Handle>* handles = nullptr); // リストの全要素から O(n) でヒープを作り直す (handles にはリストの順に識別子を格納)
     bool IsEmpty() const; // キューが空かどうかを判定
     int GetSize() const; // キューのサイズを取得
 };
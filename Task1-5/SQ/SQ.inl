@@ -1,26 +1,62 @@
 #ifndef SQ_INL
 #define SQ_INL
 
+#include <new>
+
 // DoublyLinkedList メソッドの実装
 
 // Node コンストラクタ
-template<typename T>
-DoublyLinkedList<T>::Node::Node(const T& rd) : data(rd), prev(nullptr), next(nullptr) {}
+template<typename T, typename Allocator>
+DoublyLinkedList<T, Allocator>::Node::Node(const T& rd) : data(rd), prev(nullptr), next(nullptr) {}
+
+// データをその場で構築する Node コンストラクタ
+template<typename T, typename Allocator>
+template<typename... Args>
+DoublyLinkedList<T, Allocator>::Node::Node(Args&&... args) : data(std::forward<Args>(args)...), prev(nullptr), next(nullptr) {}
 
 // DoublyLinkedList コンストラクタ
-template<typename T>
-DoublyLinkedList<T>::DoublyLinkedList() : head(nullptr), tail(nullptr), size(0) {}
+template<typename T, typename Allocator>
+DoublyLinkedList<T, Allocator>::DoublyLinkedList(const Allocator& allocator) : head(nullptr), tail(nullptr), size(0), allocator(allocator) {}
+
+// ノードを生成するメソッド (アロケータから確保した領域にデータを構築する)
+template<typename T, typename Allocator>
+template<typename... Args>
+typename DoublyLinkedList<T, Allocator>::Node* DoublyLinkedList<T, Allocator>::createNode(Args&&... args) {
+    Node* node = NodeTraits::allocate(allocator, 1);
+    try {
+        NodeTraits::construct(allocator, node, std::forward<Args>(args)...);
+    }
+    catch (...) {
+        NodeTraits::deallocate(allocator, node, 1);
+        throw;
+    }
+    return node;
+}
+
+// ノードを破棄するメソッド (領域はアロケータに返す)
+template<typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::destroyNode(Node* node) {
+    NodeTraits::destroy(allocator, node);
+    NodeTraits::deallocate(allocator, node, 1);
+}
 
 // リストのサイズを取得するメソッド
-template<typename T>
-int DoublyLinkedList<T>::Getsize() const {
+template<typename T, typename Allocator>
+int DoublyLinkedList<T, Allocator>::Getsize() const {
     return size;
 }
 
 // リストにノードを挿入するメソッド
-template<typename T>
-bool DoublyLinkedList<T>::Insert(const Iterator& iter, const T& data) {
-    Node* newNode = new Node(data);
+template<typename T, typename Allocator>
+bool DoublyLinkedList<T, Allocator>::Insert(const Iterator& iter, const T& data) {
+    return Emplace(iter, data);
+}
+
+// データをその場で構築してリストに挿入するメソッド
+template<typename T, typename Allocator>
+template<typename... Args>
+bool DoublyLinkedList<T, Allocator>::Emplace(const Iterator& iter, Args&&... args) {
+    Node* newNode = createNode(std::forward<Args>(args)...);
     if (iter.current == nullptr) { // 末尾に挿入
         if (tail == nullptr) { // リストが空の場合
             head = tail = newNode;
@@ -47,8 +83,8 @@ bool DoublyLinkedList<T>::Insert(const Iterator& iter, const T& data) {
 }
 
 // リストからノードを削除するメソッド
-template<typename T>
-bool DoublyLinkedList<T>::Delete(const Iterator& iter) {
+template<typename T, typename Allocator>
+bool DoublyLinkedList<T, Allocator>::Delete(const Iterator& iter) {
     if (iter.current == nullptr) return false;
 
     if (iter.current->prev) {
@@ -65,46 +101,47 @@ bool DoublyLinkedList<T>::Delete(const Iterator& iter) {
         tail = iter.current->prev;
     }
 
-    delete iter.current;
+    destroyNode(iter.current);
     size--;
     return true;
 }
 
 // リストの先頭を指すイテレータを取得するメソッド
-template<typename T>
-typename DoublyLinkedList<T>::Iterator DoublyLinkedList<T>::begin() {
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::Iterator DoublyLinkedList<T, Allocator>::begin() {
     return Iterator(head, this);
 }
 
 // リストの先頭を指す定数イテレータを取得するメソッド
-template<typename T>
-typename DoublyLinkedList<T>::ConstIterator DoublyLinkedList<T>::beginConst() const {
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::ConstIterator DoublyLinkedList<T, Allocator>::beginConst() const {
     return ConstIterator(head, this);
 }
 
 // リストの末尾を指すイテレータを取得するメソッド
-template<typename T>
-typename DoublyLinkedList<T>::Iterator DoublyLinkedList<T>::end() {
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::Iterator DoublyLinkedList<T, Allocator>::end() {
     return Iterator(nullptr, this);
 }
 
 // リストの末尾を指す定数イテレータを取得するメソッド
-template<typename T>
-typename DoublyLinkedList<T>::ConstIterator DoublyLinkedList<T>::endConst() const {
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::ConstIterator DoublyLinkedList<T, Allocator>::endConst() const {
     return ConstIterator(nullptr, this);
 }
 
 // リストをソートするメソッド
-template<typename T>
-void DoublyLinkedList<T>::Sort(const std::function<bool(const T&, const T&)>& comp) {
+template<typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::Sort(const std::function<bool(const T&, const T&)>& comp) {
     if (size <= 1) return;
     quickSort(head, tail, comp);
 }
 
 // クイックソートを行うメソッド
-template<typename T>
-void DoublyLinkedList<T>::quickSort(Node* left, Node* right, const std::function<bool(const T&, const T&)>& comp) {
-    if (left != right && left != right->next) {
+template<typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::quickSort(Node* left, Node* right, const std::function<bool(const T&, const T&)>& comp) {
+    // ピボットが範囲の端に来た場合、片側の範囲の端はリストの外 (nullptr) になる
+    if (left != nullptr && right != nullptr && left != right && left != right->next) {
         Node* pivot = partition(left, right, comp);
         quickSort(left, pivot->prev, comp);
         quickSort(pivot->next, right, comp);
@@ -112,8 +149,8 @@ void DoublyLinkedList<T>::quickSort(Node* left, Node* right, const std::function
 }
 
 // パーティション分割を行うメソッド
-template<typename T>
-typename DoublyLinkedList<T>::Node* DoublyLinkedList<T>::partition(Node* left, Node* right, const std::function<bool(const T&, const T&)>& comp) {
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::Node* DoublyLinkedList<T, Allocator>::partition(Node* left, Node* right, const std::function<bool(const T&, const T&)>& comp) {
     T pivot = right->data;
     Node* i = left->prev;
 
@@ -129,36 +166,44 @@ typename DoublyLinkedList<T>::Node* DoublyLinkedList<T>::partition(Node* left, N
 }
 
 // データを交換するメソッド
-template<typename T>
-void DoublyLinkedList<T>::swap(T& data1, T& data2) {
+template<typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::swap(T& data1, T& data2) {
     T temp = data1;
     data1 = data2;
     data2 = temp;
 }
 
-// DoublyLinkedList デストラクタ
-template<typename T>
-DoublyLinkedList<T>::~DoublyLinkedList() {
+// リストの全ノードを削除するメソッド
+template<typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::Clear() {
     while (head != nullptr) {
         Node* temp = head;
         head = head->next;
-        delete temp;
+        destroyNode(temp);
     }
+    tail = nullptr;
+    size = 0;
+}
+
+// DoublyLinkedList デストラクタ
+template<typename T, typename Allocator>
+DoublyLinkedList<T, Allocator>::~DoublyLinkedList() {
+    Clear();
 }
 
 // ConstIterator コンストラクタ
-template<typename T>
-DoublyLinkedList<T>::ConstIterator::ConstIterator(Node* node, const DoublyLinkedList* list)
+template<typename T, typename Allocator>
+DoublyLinkedList<T, Allocator>::ConstIterator::ConstIterator(Node* node, const DoublyLinkedList* list)
     : current(node), list(list) {}
 
 // ConstIterator コピーコンストラクタ
-template<typename T>
-DoublyLinkedList<T>::ConstIterator::ConstIterator(const ConstIterator& other)
+template<typename T, typename Allocator>
+DoublyLinkedList<T, Allocator>::ConstIterator::ConstIterator(const ConstIterator& other)
     : current(other.current), list(other.list) {}
 
 // 前のノードを指すようにイテレータを進める（デクリメント）
-template<typename T>
-typename DoublyLinkedList<T>::ConstIterator& DoublyLinkedList<T>::ConstIterator::operator--() {
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::ConstIterator& DoublyLinkedList<T, Allocator>::ConstIterator::operator--() {
     if (current) {
         current = current->prev;
     }
@@ -169,16 +214,16 @@ typename DoublyLinkedList<T>::ConstIterator& DoublyLinkedList<T>::ConstIterator:
 }
 
 // 前のノードを指すようにイテレータを進める（ポストデクリメント）
-template<typename T>
-typename DoublyLinkedList<T>::ConstIterator DoublyLinkedList<T>::ConstIterator::operator--(int) {
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::ConstIterator DoublyLinkedList<T, Allocator>::ConstIterator::operator--(int) {
     ConstIterator temp = *this;
     --(*this);
     return temp;
 }
 
 // 次のノードを指すようにイテレータを進める（インクリメント）
-template<typename T>
-typename DoublyLinkedList<T>::ConstIterator& DoublyLinkedList<T>::ConstIterator::operator++() {
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::ConstIterator& DoublyLinkedList<T, Allocator>::ConstIterator::operator++() {
     if (current) {
         current = current->next;
     }
@@ -189,147 +234,636 @@ typename DoublyLinkedList<T>::ConstIterator& DoublyLinkedList<T>::ConstIterator:
 }
 
 // 次のノードを指すようにイテレータを進める（ポストインクリメント）
-template<typename T>
-typename DoublyLinkedList<T>::ConstIterator DoublyLinkedList<T>::ConstIterator::operator++(int) {
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::ConstIterator DoublyLinkedList<T, Allocator>::ConstIterator::operator++(int) {
     ConstIterator temp = *this;
     ++(*this);
     return temp;
 }
 
 // イテレータが指しているデータを取得
-template<typename T>
-const T& DoublyLinkedList<T>::ConstIterator::operator*() const {
+template<typename T, typename Allocator>
+const T& DoublyLinkedList<T, Allocator>::ConstIterator::operator*() const {
     return current->data;
 }
 
 // イテレータの代入演算子
-template<typename T>
-void DoublyLinkedList<T>::ConstIterator::operator=(const ConstIterator& other) {
+template<typename T, typename Allocator>
+void DoublyLinkedList<T, Allocator>::ConstIterator::operator=(const ConstIterator& other) {
     current = other.current;
     list = other.list;
 }
 
 // イテレータの等価比較演算子
-template<typename T>
-bool DoublyLinkedList<T>::ConstIterator::operator==(const ConstIterator& other) const {
+template<typename T, typename Allocator>
+bool DoublyLinkedList<T, Allocator>::ConstIterator::operator==(const ConstIterator& other) const {
     return current == other.current;
 }
 
 // イテレータの非等価比較演算子
-template<typename T>
-bool DoublyLinkedList<T>::ConstIterator::operator!=(const ConstIterator& other) const {
+template<typename T, typename Allocator>
+bool DoublyLinkedList<T, Allocator>::ConstIterator::operator!=(const ConstIterator& other) const {
     return current != other.current;
 }
 
 // Iterator コンストラクタ
-template<typename T>
-DoublyLinkedList<T>::Iterator::Iterator(Node* node, const DoublyLinkedList* list)
+template<typename T, typename Allocator>
+DoublyLinkedList<T, Allocator>::Iterator::Iterator(Node* node, const DoublyLinkedList* list)
     : ConstIterator(node, list) {}
 
 // 前のノードを指すようにイテレータを進める（デクリメント）
-template<typename T>
-typename DoublyLinkedList<T>::Iterator& DoublyLinkedList<T>::Iterator::operator--() {
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::Iterator& DoublyLinkedList<T, Allocator>::Iterator::operator--() {
     ConstIterator::operator--();
     return *this;
 }
 
 // 前のノードを指すようにイテレータを進める（ポストデクリメント）
-template<typename T>
-typename DoublyLinkedList<T>::Iterator DoublyLinkedList<T>::Iterator::operator--(int) {
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::Iterator DoublyLinkedList<T, Allocator>::Iterator::operator--(int) {
     Iterator temp = *this;
     --(*this);
     return temp;
 }
 
 // 次のノードを指すようにイテレータを進める（インクリメント）
-template<typename T>
-typename DoublyLinkedList<T>::Iterator& DoublyLinkedList<T>::Iterator::operator++() {
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::Iterator& DoublyLinkedList<T, Allocator>::Iterator::operator++() {
     ConstIterator::operator++();
     return *this;
 }
 
 // 次のノードを指すようにイテレータを進める（ポストインクリメント）
-template<typename T>
-typename DoublyLinkedList<T>::Iterator DoublyLinkedList<T>::Iterator::operator++(int) {
+template<typename T, typename Allocator>
+typename DoublyLinkedList<T, Allocator>::Iterator DoublyLinkedList<T, Allocator>::Iterator::operator++(int) {
     Iterator temp = *this;
     ++(*this);
     return temp;
 }
 
 // イテレータが指しているデータを取得
-template<typename T>
-T& DoublyLinkedList<T>::Iterator::operator*() {
+template<typename T, typename Allocator>
+T& DoublyLinkedList<T, Allocator>::Iterator::operator*() {
     return const_cast<T&>(ConstIterator::operator*());
 }
 
-// Stack implementation
+// ListStorage implementation
 
-// スタックのコンストラクタ
+// リスト方式のストレージのコンストラクタ
 template<typename T>
-Stack<T>::Stack() : list() {}
+ListStorage<T>::ListStorage() : list() {}
 
-// スタックにデータをプッシュするメソッド
+// 末尾に要素を構築するメソッド
+template<typename T>
+template<typename... Args>
+void ListStorage<T>::EmplaceBack(Args&&... args) {
+    list.Emplace(list.end(), std::forward<Args>(args)...);
+}
+
+// 末尾の要素を削除するメソッド
 template<typename T>
-void Stack<T>::Push(const T& data) {
-    list.Insert(list.end(), data);
+void ListStorage<T>::PopBack() {
+    list.Delete(--list.end());
 }
 
-// スタックからデータをポップするメソッド
+// 先頭の要素を削除するメソッド
 template<typename T>
-T Stack<T>::Pop() {
+void ListStorage<T>::PopFront() {
+    list.Delete(list.begin());
+}
+
+// 先頭の要素を取得するメソッド
+template<typename T>
+T& ListStorage<T>::Front() {
+    return *list.begin();
+}
+
+// 先頭の要素を取得するメソッド
+template<typename T>
+const T& ListStorage<T>::Front() const {
+    return *list.beginConst();
+}
+
+// 末尾の要素を取得するメソッド
+template<typename T>
+T& ListStorage<T>::Back() {
+    return *--list.end();
+}
+
+// 末尾の要素を取得するメソッド
+template<typename T>
+const T& ListStorage<T>::Back() const {
+    return *--list.endConst();
+}
+
+// 要素数を取得するメソッド
+template<typename T>
+int ListStorage<T>::GetSize() const {
+    return list.Getsize();
+}
+
+// ChunkedStorage implementation
+
+// チャンク方式のストレージのコンストラクタ
+template<typename T>
+ChunkedStorage<T>::ChunkedStorage()
+    : blocks(nullptr), capacity(0), firstBlock(0), blockCount(0), firstOffset(0), size(0), spare(nullptr) {}
+
+// 先頭から index 番目の要素の格納場所を取得するメソッド
+template<typename T>
+T* ChunkedStorage<T>::slot(size_t index) const {
+    size_t position = firstOffset + index;
+    return blocks[(firstBlock + position / BlockSize) & (capacity - 1)] + position % BlockSize;
+}
+
+// ブロックを確保するメソッド
+template<typename T>
+T* ChunkedStorage<T>::acquireBlock() {
+    if (spare != nullptr) {
+        T* block = spare;
+        spare = nullptr;
+        return block;
+    }
+    return static_cast<T*>(::operator new(sizeof(T) * BlockSize));
+}
+
+// ブロックを解放するメソッド
+template<typename T>
+void ChunkedStorage<T>::releaseBlock(T* block) {
+    if (spare == nullptr) {
+        spare = block;
+    }
+    else {
+        ::operator delete(block);
+    }
+}
+
+// リングの長さを 2 倍にするメソッド (使用中のブロックを先頭から詰め直す)
+template<typename T>
+void ChunkedStorage<T>::growRing() {
+    size_t newCapacity = capacity == 0 ? 8 : capacity * 2;
+    T** newBlocks = new T*[newCapacity];
+    for (size_t i = 0; i < blockCount; ++i) {
+        newBlocks[i] = blocks[(firstBlock + i) & (capacity - 1)];
+    }
+    delete[] blocks;
+    blocks = newBlocks;
+    capacity = newCapacity;
+    firstBlock = 0;
+}
+
+// 末尾に要素を構築するメソッド
+template<typename T>
+template<typename... Args>
+void ChunkedStorage<T>::EmplaceBack(Args&&... args) {
+    // 末尾のブロックが埋まっていれば、ブロックを 1 つ追加する
+    if (firstOffset + size == blockCount * BlockSize) {
+        if (blockCount == capacity) {
+            growRing();
+        }
+        blocks[(firstBlock + blockCount) & (capacity - 1)] = acquireBlock();
+        ++blockCount;
+    }
+    new (slot(size)) T(std::forward<Args>(args)...);
+    ++size;
+}
+
+// 末尾の要素を削除するメソッド
+template<typename T>
+void ChunkedStorage<T>::PopBack() {
+    --size;
+    slot(size)->~T();
+
+    // 末尾のブロックが空になれば外す
+    if (firstOffset + size <= (blockCount - 1) * BlockSize) {
+        --blockCount;
+        releaseBlock(blocks[(firstBlock + blockCount) & (capacity - 1)]);
+    }
+    if (size == 0) {
+        firstOffset = 0;
+    }
+}
+
+// 先頭の要素を削除するメソッド
+template<typename T>
+void ChunkedStorage<T>::PopFront() {
+    slot(0)->~T();
+    ++firstOffset;
+    --size;
+
+    // 先頭のブロックを使い切れば外す
+    if (firstOffset == BlockSize) {
+        releaseBlock(blocks[firstBlock]);
+        firstBlock = (firstBlock + 1) & (capacity - 1);
+        --blockCount;
+        firstOffset = 0;
+    }
+    else if (size == 0) {
+        firstOffset = 0;
+    }
+}
+
+// 先頭の要素を取得するメソッド
+template<typename T>
+T& ChunkedStorage<T>::Front() {
+    return *slot(0);
+}
+
+// 先頭の要素を取得するメソッド
+template<typename T>
+const T& ChunkedStorage<T>::Front() const {
+    return *slot(0);
+}
+
+// 末尾の要素を取得するメソッド
+template<typename T>
+T& ChunkedStorage<T>::Back() {
+    return *slot(size - 1);
+}
+
+// 末尾の要素を取得するメソッド
+template<typename T>
+const T& ChunkedStorage<T>::Back() const {
+    return *slot(size - 1);
+}
+
+// 要素数を取得するメソッド
+template<typename T>
+int ChunkedStorage<T>::GetSize() const {
+    return static_cast<int>(size);
+}
+
+// チャンク方式のストレージのデストラクタ
+template<typename T>
+ChunkedStorage<T>::~ChunkedStorage() {
+    while (size > 0) {
+        PopFront();
+    }
+    for (size_t i = 0; i < blockCount; ++i) {
+        ::operator delete(blocks[(firstBlock + i) & (capacity - 1)]);
+    }
+    ::operator delete(spare);
+    delete[] blocks;
+}
+
+// Stack implementation
+
+// スタックのコンストラクタ
+template<typename T, typename Storage>
+Stack<T, Storage>::Stack() : storage() {}
+
+// スタックにデータをプッシュするメソッド
+template<typename T, typename Storage>
+void Stack<T, Storage>::Push(const T& data) {
+    storage.EmplaceBack(data);
+}
+
+// スタックにデータをムーブしてプッシュするメソッド
+template<typename T, typename Storage>
+void Stack<T, Storage>::Push(T&& data) {
+    storage.EmplaceBack(std::move(data));
+}
+
+// データをスタック上に直接構築するメソッド
+template<typename T, typename Storage>
+template<typename... Args>
+void Stack<T, Storage>::Emplace(Args&&... args) {
+    storage.EmplaceBack(std::forward<Args>(args)...);
+}
+
+// スタックからデータをムーブしてポップするメソッド
+template<typename T, typename Storage>
+T Stack<T, Storage>::Pop() {
     if (IsEmpty()) {
         throw std::out_of_range("Stack is empty");
     }
-    T data = *--list.end();
-    list.Delete(--list.end());
+    T data = std::move(storage.Back());
+    storage.PopBack();
     return data;
 }
 
+// スタックが空でなければデータをムーブしてポップするメソッド
+template<typename T, typename Storage>
+bool Stack<T, Storage>::TryPop(T& data) {
+    if (IsEmpty()) return false;
+    data = std::move(storage.Back());
+    storage.PopBack();
+    return true;
+}
+
+// 先頭のデータを参照するメソッド
+template<typename T, typename Storage>
+T& Stack<T, Storage>::Top() {
+    if (IsEmpty()) {
+        throw std::out_of_range("Stack is empty");
+    }
+    return storage.Back();
+}
+
+// 先頭のデータを参照するメソッド
+template<typename T, typename Storage>
+const T& Stack<T, Storage>::Top() const {
+    if (IsEmpty()) {
+        throw std::out_of_range("Stack is empty");
+    }
+    return storage.Back();
+}
+
 // スタックが空かどうかを判定するメソッド
-template<typename T>
-bool Stack<T>::IsEmpty() const {
-    return list.Getsize() == 0;
+template<typename T, typename Storage>
+bool Stack<T, Storage>::IsEmpty() const {
+    return storage.GetSize() == 0;
 }
 
 // スタックのサイズを取得するメソッド
-template<typename T>
-int Stack<T>::GetSize() const {
-    return list.Getsize();
+template<typename T, typename Storage>
+int Stack<T, Storage>::GetSize() const {
+    return storage.GetSize();
 }
 
 // Queue implementation
 
 // キューのコンストラクタ
-template<typename T>
-Queue<T>::Queue() : list() {}
+template<typename T, typename Storage>
+Queue<T, Storage>::Queue() : storage() {}
 
 // キューにデータをプッシュするメソッド
-template<typename T>
-void Queue<T>::Push(const T& data) {
-    list.Insert(list.end(), data);
+template<typename T, typename Storage>
+void Queue<T, Storage>::Push(const T& data) {
+    storage.EmplaceBack(data);
 }
 
-// キューからデータをポップするメソッド
-template<typename T>
-T Queue<T>::Pop() {
+// キューにデータをムーブしてプッシュするメソッド
+template<typename T, typename Storage>
+void Queue<T, Storage>::Push(T&& data) {
+    storage.EmplaceBack(std::move(data));
+}
+
+// データをキュー上に直接構築するメソッド
+template<typename T, typename Storage>
+template<typename... Args>
+void Queue<T, Storage>::Emplace(Args&&... args) {
+    storage.EmplaceBack(std::forward<Args>(args)...);
+}
+
+// キューからデータをムーブしてポップするメソッド
+template<typename T, typename Storage>
+T Queue<T, Storage>::Pop() {
     if (IsEmpty()) {
         throw std::out_of_range("Queue is empty");
     }
-    T data = *list.begin();
-    list.Delete(list.begin());
+    T data = std::move(storage.Front());
+    storage.PopFront();
     return data;
 }
 
+// キューが空でなければデータをムーブしてポップするメソッド
+template<typename T, typename Storage>
+bool Queue<T, Storage>::TryPop(T& data) {
+    if (IsEmpty()) return false;
+    data = std::move(storage.Front());
+    storage.PopFront();
+    return true;
+}
+
+// 先頭のデータを参照するメソッド
+template<typename T, typename Storage>
+T& Queue<T, Storage>::Front() {
+    if (IsEmpty()) {
+        throw std::out_of_range("Queue is empty");
+    }
+    return storage.Front();
+}
+
+// 先頭のデータを参照するメソッド
+template<typename T, typename Storage>
+const T& Queue<T, Storage>::Front() const {
+    if (IsEmpty()) {
+        throw std::out_of_range("Queue is empty");
+    }
+    return storage.Front();
+}
+
 // キューが空かどうかを判定するメソッド
-template<typename T>
-bool Queue<T>::IsEmpty() const {
-    return list.Getsize() == 0;
+template<typename T, typename Storage>
+bool Queue<T, Storage>::IsEmpty() const {
+    return storage.GetSize() == 0;
 }
 
 // キューのサイズを取得するメソッド
-template<typename T>
-int Queue<T>::GetSize() const {
-    return list.Getsize();
+template<typename T, typename Storage>
+int Queue<T, Storage>::GetSize() const {
+    return storage.GetSize();
+}
+
+// PriorityQueue メソッドの実装
+
+template<typename T, typename Compare>
+const size_t PriorityQueue<T, Compare>::Arity;
+
+template<typename T, typename Compare>
+const size_t PriorityQueue<T, Compare>::NoPosition;
+
+template<typename T, typename Compare>
+const unsigned PriorityQueue<T, Compare>::SlotBits;
+
+// 優先度付きキューのコンストラクタ
+template<typename T, typename Compare>
+PriorityQueue<T, Compare>::PriorityQueue(const Compare& comp) : comp(comp) {}
+
+// 枠を確保するメソッド
+template<typename T, typename Compare>
+size_t PriorityQueue<T, Compare>::acquireSlot() {
+    if (!freeSlots.empty()) {
+        size_t slot = freeSlots.back();
+        freeSlots.pop_back();
+        return slot;
+    }
+    positions.push_back(NoPosition);
+    generations.push_back(0);
+    return positions.size() - 1;
+}
+
+// 識別子から格納中の要素の枠を求めるメソッド
+// 引数: Handle handle - プッシュ時に返された識別子
+//       size_t& slot - 枠の番号を受け取る変数
+// 戻り値: 枠に要素が格納中で、枠の世代が識別子の世代と一致する場合は true
+template<typename T, typename Compare>
+bool PriorityQueue<T, Compare>::findSlot(Handle handle, size_t& slot) const {
+    Handle index = handle & ((Handle(1) << SlotBits) - 1);
+    if (index >= positions.size()) return false;
+    slot = static_cast<size_t>(index);
+    return positions[slot] != NoPosition && generations[slot] == static_cast<uint32_t>(handle >> SlotBits);
+}
+
+// 要素をヒープ上の位置に置くメソッド
+template<typename T, typename Compare>
+void PriorityQueue<T, Compare>::place(size_t position, Entry&& entry) {
+    positions[entry.slot] = position;
+    heap[position] = std::move(entry);
+}
+
+// 要素を上げるメソッド (交換せずに、親を下ろして空いた位置に最後に置く)
+template<typename T, typename Compare>
+void PriorityQueue<T, Compare>::siftUp(size_t position) {
+    Entry entry = std::move(heap[position]);
+    while (position > 0) {
+        size_t parent = (position - 1) / Arity;
+        if (!comp(heap[parent].data, entry.data)) break;
+        place(position, std::move(heap[parent]));
+        position = parent;
+    }
+    place(position, std::move(entry));
+}
+
+// 要素を下げるメソッド (4 つの子のうち最も優先度の高い子と比べる)
+template<typename T, typename Compare>
+void PriorityQueue<T, Compare>::siftDown(size_t position) {
+    const size_t size = heap.size();
+    Entry entry = std::move(heap[position]);
+    for (;;) {
+        size_t first = position * Arity + 1;
+        if (first >= size) break;
+        size_t last = first + Arity < size ? first + Arity : size;
+        size_t best = first;
+        for (size_t child = first + 1; child < last; ++child) {
+            if (comp(heap[best].data, heap[child].data)) {
+                best = child;
+            }
+        }
+        if (!comp(entry.data, heap[best].data)) break;
+        place(position, std::move(heap[best]));
+        position = best;
+    }
+    place(position, std::move(entry));
+}
+
+// 優先度付きキューにデータをプッシュするメソッド
+template<typename T, typename Compare>
+typename PriorityQueue<T, Compare>::Handle PriorityQueue<T, Compare>::Push(const T& data) {
+    return Push(T(data));
+}
+
+// 優先度付きキューにデータをムーブしてプッシュするメソッド
+template<typename T, typename Compare>
+typename PriorityQueue<T, Compare>::Handle PriorityQueue<T, Compare>::Push(T&& data) {
+    size_t slot = acquireSlot();
+    heap.push_back(Entry{ std::move(data), slot });
+    positions[slot] = heap.size() - 1;
+    siftUp(heap.size() - 1);
+    return Handle(generations[slot]) << SlotBits | slot;
+}
+
+// 先頭のデータをムーブしてポップするメソッド
+template<typename T, typename Compare>
+T PriorityQueue<T, Compare>::Pop() {
+    if (IsEmpty()) {
+        throw std::out_of_range("PriorityQueue is empty");
+    }
+    T data = std::move(heap.front().data);
+    size_t slot = heap.front().slot;
+    positions[slot] = NoPosition;
+    ++generations[slot];
+    freeSlots.push_back(slot);
+    if (heap.size() > 1) {
+        heap.front() = std::move(heap.back());
+        heap.pop_back();
+        siftDown(0);
+    }
+    else {
+        heap.pop_back();
+    }
+    return data;
+}
+
+// 空でなければ先頭のデータをムーブしてポップするメソッド
+template<typename T, typename Compare>
+bool PriorityQueue<T, Compare>::TryPop(T& data) {
+    if (IsEmpty()) return false;
+    data = Pop();
+    return true;
+}
+
+// 先頭のデータを参照するメソッド
+template<typename T, typename Compare>
+const T& PriorityQueue<T, Compare>::Top() const {
+    if (IsEmpty()) {
+        throw std::out_of_range("PriorityQueue is empty");
+    }
+    return heap.front().data;
+}
+
+// 格納中の要素を置き換えて位置を直すメソッド
+// 引数: Handle handle - プッシュ時に返された識別子
+//       const T& data - 新しいデータ (元のデータより優先度が低くてはならない)
+// 戻り値: 置き換えた場合は true、識別子の要素が格納されていない場合や優先度が下がる場合は false
+template<typename T, typename Compare>
+bool PriorityQueue<T, Compare>::DecreaseKey(Handle handle, const T& data) {
+    size_t slot;
+    if (!findSlot(handle, slot)) return false;
+    size_t position = positions[slot];
+    if (comp(data, heap[position].data)) return false;
+    heap[position].data = data;
+    siftUp(position);
+    return true;
+}
+
+// 識別子の要素が格納中かどうかを判定するメソッド
+template<typename T, typename Compare>
+bool PriorityQueue<T, Compare>::Contains(Handle handle) const {
+    size_t slot;
+    return findSlot(handle, slot);
+}
+
+// リストの全要素からヒープを作り直すメソッド
+// 引数: const DoublyLinkedList<T>& list - 要素のリスト
+//       std::vector<Handle>* handles - リストの順に識別子を格納する配列 (不要な場合は nullptr)
+// 期待結果: 末尾側の親から順に下げることで O(n) でヒープになる
+//           それまでの要素は破棄され、リストの i 番目の要素は枠 i に入る
+//           既存の枠は世代を進めるため、それまでに返した識別子は Contains / DecreaseKey で拒否される
+template<typename T, typename Compare>
+void PriorityQueue<T, Compare>::Build(const DoublyLinkedList<T>& list, std::vector<Handle>* handles) {
+    const size_t count = static_cast<size_t>(list.Getsize());
+    const size_t oldSlots = positions.size();
+    for (size_t slot = 0; slot < oldSlots; ++slot) {
+        ++generations[slot];
+    }
+    const size_t slots = oldSlots > count ? oldSlots : count;
+    positions.assign(slots, NoPosition);
+    generations.resize(slots, 0);
+    heap.clear();
+    heap.reserve(count);
+    for (auto it = list.beginConst(); it != list.endConst(); ++it) {
+        positions[heap.size()] = heap.size();
+        heap.push_back(Entry{ *it, heap.size() });
+    }
+    freeSlots.clear();
+    for (size_t slot = slots; slot-- > count;) {
+        freeSlots.push_back(slot);
+    }
+    if (handles != nullptr) {
+        handles->clear();
+        handles->reserve(count);
+        for (size_t slot = 0; slot < count; ++slot) {
+            handles->push_back(Handle(generations[slot]) << SlotBits | slot);
+        }
+    }
+    if (heap.size() < 2) return;
+    for (size_t position = (heap.size() - 2) / Arity + 1; position-- > 0;) {
+        siftDown(position);
+    }
+}
+
+// 優先度付きキューが空かどうかを判定するメソッド
+template<typename T, typename Compare>
+bool PriorityQueue<T, Compare>::IsEmpty() const {
+    return heap.empty();
+}
+
+// 優先度付きキューのサイズを取得するメソッド
+template<typename T, typename Compare>
+int PriorityQueue<T, Compare>::GetSize() const {
+    return static_cast<int>(heap.size());
 }
 
 #endif // SQ_INL
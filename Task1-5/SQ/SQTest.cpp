@@ -1,5 +1,15 @@
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ConcurrentSQ.h"
 #include "SQ.h"
+#include "TaskPool.h"
 
 // Stack tests
 // テスト0: リストが空である場合の戻り値
@@ -364,3 +374,1203 @@ TEST(QueueTest, NonConstPopMethod) {
     // queue.Pop();
 }
 #endif
+
+// ChunkedStorage tests
+// テスト0: ブロックをまたいでプッシュ・ポップした際の挙動
+// インターフェース:プッシュ、ポップ
+// 想定する戻り値: 最後に追加した要素から順に返される
+// 意図する結果: 複数のブロックにまたがる要素が追加した順の逆順に取り出され、空になることを確認する。
+// 補足: 文字列の要素で、ブロックの解放時に要素が正しく破棄されることも確認する。
+TEST(ChunkedStackTest, PushPopAcrossBlocks) {
+    Stack<std::string, ChunkedStorage<std::string>> stack;
+    for (int i = 0; i < 1000; ++i) {
+        stack.Push("User" + std::to_string(i));
+    }
+    EXPECT_EQ(stack.GetSize(), 1000);
+    for (int i = 999; i >= 0; --i) {
+        EXPECT_EQ(stack.Pop(), "User" + std::to_string(i));
+    }
+    EXPECT_TRUE(stack.IsEmpty());
+    EXPECT_THROW(stack.Pop(), std::out_of_range);
+}
+
+// テスト1: ブロックの境界でプッシュとポップを繰り返した際の挙動
+// インターフェース:プッシュ、ポップ
+// 想定する戻り値: 直前にプッシュした要素
+// 意図する結果: 境界で確保・解放が繰り返されても、データ数と取り出す要素が正しいことを確認する。
+// 補足:
+TEST(ChunkedStackTest, PushPopAtBlockBoundary) {
+    Stack<int, ChunkedStorage<int>> stack;
+    for (int i = 0; i < 1024; ++i) {
+        stack.Push(i);
+    }
+    for (int i = 0; i < 100; ++i) {
+        stack.Push(-i);
+        EXPECT_EQ(stack.Pop(), -i);
+    }
+    EXPECT_EQ(stack.GetSize(), 1024);
+    EXPECT_EQ(stack.Pop(), 1023);
+}
+
+// テスト0: ブロックをまたいでプッシュ・ポップした際の挙動
+// インターフェース:プッシュ、ポップ
+// 想定する戻り値: 最初に追加した要素から順に返される
+// 意図する結果: 複数のブロックにまたがる要素が追加した順に取り出され、空になることを確認する。
+// 補足:
+TEST(ChunkedQueueTest, PushPopAcrossBlocks) {
+    Queue<std::string, ChunkedStorage<std::string>> queue;
+    for (int i = 0; i < 1000; ++i) {
+        queue.Push("User" + std::to_string(i));
+    }
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_EQ(queue.Pop(), "User" + std::to_string(i));
+    }
+    EXPECT_TRUE(queue.IsEmpty());
+    EXPECT_THROW(queue.Pop(), std::out_of_range);
+}
+
+// テスト1: プッシュとポップを交互に繰り返した際の挙動
+// インターフェース:プッシュ、ポップ
+// 想定する戻り値: 最初に追加した要素から順に返される
+// 意図する結果: 先頭のブロックが解放され、リングを一周しても順序とデータ数が保たれることを確認する。
+// 補足: 途中で要素数を増やし、リングの拡張も通す。
+TEST(ChunkedQueueTest, RingWrapAround) {
+    Queue<int, ChunkedStorage<int>> queue;
+    int next = 0;
+    int expected = 0;
+    for (int round = 0; round < 50; ++round) {
+        int pushes = round % 10 == 0 ? 5000 : 700;
+        for (int i = 0; i < pushes; ++i) {
+            queue.Push(next++);
+        }
+        while (queue.GetSize() > 100) {
+            EXPECT_EQ(queue.Pop(), expected++);
+        }
+    }
+    while (!queue.IsEmpty()) {
+        EXPECT_EQ(queue.Pop(), expected++);
+    }
+    EXPECT_EQ(expected, next);
+}
+
+// Move / Emplace tests
+// テスト0: 先頭のデータを参照した際の挙動
+// インターフェース:先頭の参照
+// 想定する戻り値: 最後にプッシュした要素への参照
+// 意図する結果: 参照経由で書き換えた値がポップで返され、空の場合は例外になることを確認する。
+// 補足: constのスタックからも参照できることを確認する。
+TEST(StackMoveTest, Top) {
+    Stack<int> stack;
+    EXPECT_THROW(stack.Top(), std::out_of_range);
+    stack.Push(1);
+    stack.Push(2);
+    EXPECT_EQ(stack.Top(), 2);
+    stack.Top() = 20;
+    const Stack<int>& constStack = stack;
+    EXPECT_EQ(constStack.Top(), 20);
+    EXPECT_EQ(stack.GetSize(), 2);
+    EXPECT_EQ(stack.Pop(), 20);
+}
+
+// テスト1: TryPopの挙動
+// インターフェース:ポップ
+// 想定する戻り値: 要素があれば TRUE、空であれば FALSE
+// 意図する結果: 要素がある間は引数経由で逆順に渡され、空になると引数が変更されないことを確認する。
+// 補足:
+TEST(StackMoveTest, TryPop) {
+    Stack<std::string, ChunkedStorage<std::string>> stack;
+    stack.Push("User1");
+    stack.Push("User2");
+    std::string data;
+    EXPECT_TRUE(stack.TryPop(data));
+    EXPECT_EQ(data, "User2");
+    EXPECT_TRUE(stack.TryPop(data));
+    EXPECT_EQ(data, "User1");
+    EXPECT_FALSE(stack.TryPop(data));
+    EXPECT_EQ(data, "User1");
+}
+
+// テスト2: ムーブのみ可能な型を扱った際の挙動
+// インターフェース:プッシュ、ポップ、直接構築
+// 想定する戻り値: プッシュした順の逆順の要素
+// 意図する結果: コピーできない要素でもプッシュ・ポップでき、コピーが発生しないことを確認する。
+// 補足:
+TEST(StackMoveTest, MoveOnlyType) {
+    Stack<std::unique_ptr<int>> stack;
+    stack.Push(std::unique_ptr<int>(new int(1)));
+    stack.Emplace(new int(2));
+    EXPECT_EQ(*stack.Top(), 2);
+    EXPECT_EQ(*stack.Pop(), 2);
+    std::unique_ptr<int> data;
+    EXPECT_TRUE(stack.TryPop(data));
+    EXPECT_EQ(*data, 1);
+    EXPECT_TRUE(stack.IsEmpty());
+}
+
+// テスト0: 先頭のデータを参照した際の挙動
+// インターフェース:先頭の参照
+// 想定する戻り値: 最初にプッシュした要素への参照
+// 意図する結果: 参照してもデータ数が変わらず、空の場合は例外になることを確認する。
+// 補足:
+TEST(QueueMoveTest, Front) {
+    Queue<std::string> queue;
+    EXPECT_THROW(queue.Front(), std::out_of_range);
+    queue.Push("User1");
+    queue.Push("User2");
+    EXPECT_EQ(queue.Front(), "User1");
+    const Queue<std::string>& constQueue = queue;
+    EXPECT_EQ(constQueue.Front(), "User1");
+    EXPECT_EQ(queue.GetSize(), 2);
+}
+
+// テスト1: 直接構築とTryPopの挙動
+// インターフェース:直接構築、ポップ
+// 想定する戻り値: 要素があれば TRUE、空であれば FALSE
+// 意図する結果: コンストラクタ引数から構築した要素が追加した順に取り出されることを確認する。
+// 補足: リスト方式とチャンク方式の両方で確認する。
+TEST(QueueMoveTest, EmplaceTryPop) {
+    Queue<std::pair<int, std::string>> queue;
+    Queue<std::pair<int, std::string>, ChunkedStorage<std::pair<int, std::string>>> chunked;
+    for (int i = 0; i < 3; ++i) {
+        queue.Emplace(i, "User" + std::to_string(i));
+        chunked.Emplace(i, "User" + std::to_string(i));
+    }
+    std::pair<int, std::string> data;
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_TRUE(queue.TryPop(data));
+        EXPECT_EQ(data.first, i);
+        EXPECT_EQ(data.second, "User" + std::to_string(i));
+        EXPECT_TRUE(chunked.TryPop(data));
+        EXPECT_EQ(data.first, i);
+    }
+    EXPECT_FALSE(queue.TryPop(data));
+    EXPECT_FALSE(chunked.TryPop(data));
+}
+
+// テスト2: ノード領域を再利用しながらプッシュ・ポップした際の挙動
+// インターフェース:プッシュ、ポップ
+// 想定する戻り値: 最初にプッシュした要素から順に返される
+// 意図する結果: 再利用の上限を超えて増減させても、順序とデータ数が保たれることを確認する。
+// 補足:
+TEST(QueueMoveTest, PooledNodes) {
+    Queue<std::string> queue;
+    int next = 0;
+    int expected = 0;
+    for (int round = 0; round < 5; ++round) {
+        for (int i = 0; i < 3000; ++i) {
+            queue.Push("User" + std::to_string(next++));
+        }
+        while (queue.GetSize() > 10) {
+            EXPECT_EQ(queue.Pop(), "User" + std::to_string(expected++));
+        }
+    }
+    EXPECT_EQ(queue.GetSize(), 10);
+}
+
+// SpscQueue tests
+// テスト0: 容量まで要素をプッシュした際の挙動
+// インターフェース:プッシュ、ポップ
+// 想定する戻り値: 容量までは TRUE、満杯になると FALSE
+// 意図する結果: 容量が 2 のべき乗に切り上げられ、満杯のプッシュが失敗し、ポップで空きができることを確認する。
+// 補足:
+TEST(SpscQueueTest, PushUntilFull) {
+    SpscQueue<int> queue(5);
+    EXPECT_EQ(queue.GetCapacity(), 8u);
+    EXPECT_TRUE(queue.IsEmpty());
+    for (int i = 0; i < 8; ++i) {
+        EXPECT_TRUE(queue.TryPush(i));
+    }
+    EXPECT_FALSE(queue.TryPush(8));
+    EXPECT_EQ(queue.GetSize(), 8);
+
+    int data = -1;
+    EXPECT_TRUE(queue.TryPop(data));
+    EXPECT_EQ(data, 0);
+    EXPECT_TRUE(queue.TryPush(8));
+    for (int i = 1; i <= 8; ++i) {
+        EXPECT_EQ(queue.Pop(), i);
+    }
+    EXPECT_FALSE(queue.TryPop(data));
+    EXPECT_EQ(data, 0);
+}
+
+// テスト1: リングを何周もしながらプッシュ・ポップした際の挙動
+// インターフェース:プッシュ、ポップ
+// 想定する戻り値: 最初にプッシュした要素から順に返される
+// 意図する結果: 格納場所が先頭に戻っても順序とデータ数が保たれることを確認する。
+// 補足:
+TEST(SpscQueueTest, RingWrapAround) {
+    SpscQueue<std::string> queue(4);
+    int next = 0;
+    int expected = 0;
+    for (int round = 0; round < 100; ++round) {
+        while (queue.TryPush("User" + std::to_string(next))) {
+            next++;
+        }
+        EXPECT_EQ(queue.GetSize(), 4);
+        for (int i = 0; i < 3; ++i) {
+            EXPECT_EQ(queue.Pop(), "User" + std::to_string(expected++));
+        }
+    }
+    EXPECT_EQ(queue.GetSize(), next - expected);
+}
+
+// テスト2: 生産者と消費者を別スレッドで動かした際の挙動
+// インターフェース:プッシュ、ポップ、クローズ
+// 想定する戻り値: プッシュした順の要素、閉じられて空になると例外
+// 意図する結果: 容量より多い要素を受け渡しても欠けや重複がなく、順序が保たれることを確認する。
+// 補足:
+TEST(SpscQueueTest, ProducerConsumer) {
+    const int count = 200000;
+    SpscQueue<int> queue(64);
+    std::thread producer([&] {
+        for (int i = 0; i < count; ++i) {
+            queue.Push(i);
+        }
+        queue.Close();
+    });
+
+    int expected = 0;
+    bool ordered = true;
+    try {
+        for (;;) {
+            int data = queue.Pop();
+            ordered = ordered && data == expected;
+            expected++;
+        }
+    }
+    catch (const std::out_of_range&) {
+    }
+    producer.join();
+    EXPECT_TRUE(ordered);
+    EXPECT_EQ(expected, count);
+    EXPECT_TRUE(queue.IsClosed());
+    EXPECT_TRUE(queue.IsEmpty());
+}
+
+// テスト3: ムーブのみ可能な型を扱った際の挙動
+// インターフェース:直接構築、ポップ、デストラクタ
+// 想定する戻り値: プッシュした順の要素
+// 意図する結果: コピーできない要素を受け渡せ、残った要素がデストラクタで破棄されることを確認する。
+// 補足:
+TEST(SpscQueueTest, MoveOnlyType) {
+    std::shared_ptr<int> counter = std::make_shared<int>(0);
+    {
+        SpscQueue<std::unique_ptr<std::shared_ptr<int>>> queue(4);
+        for (int i = 0; i < 3; ++i) {
+            EXPECT_TRUE(queue.TryEmplace(new std::shared_ptr<int>(counter)));
+        }
+        EXPECT_EQ(counter.use_count(), 4);
+        std::unique_ptr<std::shared_ptr<int>> data = queue.Pop();
+        EXPECT_EQ(data->get(), counter.get());
+    }
+    EXPECT_EQ(counter.use_count(), 1);
+}
+
+// テスト4: 待ち時間が空回りより長くなった際の挙動
+// インターフェース:プッシュ、ポップ、クローズ
+// 想定する戻り値: プッシュした順の要素、閉じられて空になると例外
+// 意図する結果: 眠った消費者がプッシュとクローズで起き、満杯で眠った生産者がポップで起きることを確認する。
+// 補足: 相手側はスレッドを譲る回数の上限を十分に超える時間だけ止めてから操作する。
+TEST(SpscQueueTest, WakeParkedThreads) {
+    SpscQueue<int> queue(1);
+    std::atomic<int> popped(0);
+    std::thread consumer([&] {
+        try {
+            for (;;) {
+                EXPECT_EQ(queue.Pop(), popped.load());
+                popped++;
+            }
+        }
+        catch (const std::out_of_range&) {
+        }
+    });
+    for (int i = 0; i < 3; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20)); // 消費者が空のキューで眠る
+        queue.Push(i);
+    }
+    while (popped.load() < 3) {
+        std::this_thread::yield();
+    }
+
+    // 消費者を止めたまま満杯にして、生産者を眠らせる
+    SpscQueue<int> full(1);
+    full.Push(0);
+    std::atomic<bool> pushed(false);
+    std::thread producer([&] {
+        full.Push(1);
+        pushed = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_FALSE(pushed.load());
+    EXPECT_EQ(full.Pop(), 0);
+    producer.join();
+    EXPECT_TRUE(pushed.load());
+    EXPECT_EQ(full.Pop(), 1);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    queue.Close();
+    consumer.join();
+    EXPECT_EQ(popped.load(), 3);
+}
+
+// テスト5: 容量 1 で受け渡しを繰り返した際の挙動
+// インターフェース:プッシュ、ポップ
+// 想定する戻り値: プッシュした順の要素
+// 意図する結果: 両側が眠ったり起きたりを繰り返しても、起こし損ねて止まることがないことを確認する。
+// 補足: 生産者はときどき止まり、消費者が空回りを使い切って眠るようにする。
+TEST(SpscQueueTest, PingPongWithParking) {
+    const int count = 2000;
+    SpscQueue<int> queue(1);
+    std::thread producer([&] {
+        for (int i = 0; i < count; ++i) {
+            if (i % 100 == 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            queue.Push(i);
+        }
+    });
+    bool ordered = true;
+    for (int i = 0; i < count; ++i) {
+        ordered = ordered && queue.Pop() == i;
+    }
+    producer.join();
+    EXPECT_TRUE(ordered);
+    EXPECT_TRUE(queue.IsEmpty());
+}
+
+// MpmcQueue tests
+// テスト0: 容量まで要素をプッシュした際の挙動
+// インターフェース:プッシュ、ポップ
+// 想定する戻り値: 容量までは TRUE、満杯になると FALSE
+// 意図する結果: 容量が 2 以上の 2 のべき乗に切り上げられ、プッシュした順にポップされることを確認する。
+// 補足:
+TEST(MpmcQueueTest, PushUntilFull) {
+    MpmcQueue<std::string> small(1);
+    EXPECT_EQ(small.GetCapacity(), 2u);
+    MpmcQueue<std::string> queue(3);
+    EXPECT_EQ(queue.GetCapacity(), 4u);
+    const std::string user = "User";
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(queue.TryPush(user + std::to_string(i)));
+    }
+    EXPECT_FALSE(queue.TryPush(user));
+    EXPECT_EQ(queue.GetSize(), 4);
+
+    std::string data;
+    for (int round = 0; round < 10; ++round) {
+        EXPECT_TRUE(queue.TryPop(data));
+        EXPECT_EQ(data, user + std::to_string(round));
+        EXPECT_TRUE(queue.TryPush(user + std::to_string(round + 4)));
+    }
+    for (int i = 10; i < 14; ++i) {
+        EXPECT_EQ(queue.Pop(), user + std::to_string(i));
+    }
+    EXPECT_FALSE(queue.TryPop(data));
+    queue.Close();
+    EXPECT_THROW(queue.Pop(), std::out_of_range);
+}
+
+// テスト1: まとめてプッシュ・ポップした際の挙動
+// インターフェース:まとめてプッシュ、まとめてポップ
+// 想定する戻り値: 空いている数だけプッシュした数、最大数までのポップした数
+// 意図する結果: 空きが足りない場合は入る分だけプッシュされ、順序が保たれることを確認する。
+// 補足: 閉じられて空の場合、待機するまとめてポップは 0 を返す。
+TEST(MpmcQueueTest, Bulk) {
+    MpmcQueue<int> queue(8);
+    std::vector<int> input = { 0, 1, 2, 3, 4, 5 };
+    EXPECT_EQ(queue.TryPushBulk(input.begin(), input.end()), 6u);
+    EXPECT_EQ(queue.TryPushBulk(input.begin(), input.end()), 2u);
+    EXPECT_EQ(queue.GetSize(), 8);
+
+    std::vector<int> output;
+    EXPECT_EQ(queue.TryPopBulk(std::back_inserter(output), 5), 5u);
+    EXPECT_EQ(queue.TryPopBulk(std::back_inserter(output), 5), 3u);
+    EXPECT_EQ(queue.TryPopBulk(std::back_inserter(output), 5), 0u);
+    std::vector<int> expected = { 0, 1, 2, 3, 4, 5, 0, 1 };
+    EXPECT_EQ(output, expected);
+
+    queue.PushBulk(input.begin(), input.begin() + 3);
+    queue.Close();
+    output.clear();
+    EXPECT_EQ(queue.PopBulk(std::back_inserter(output), 10), 3u);
+    EXPECT_EQ(queue.PopBulk(std::back_inserter(output), 10), 0u);
+    EXPECT_EQ(output.size(), 3u);
+}
+
+// テスト2: 多数の生産者と消費者を同時に動かした際の挙動
+// インターフェース:プッシュ、ポップ、まとめてプッシュ、まとめてポップ
+// 想定する戻り値: 全ての要素がちょうど 1 回ずつポップされる
+// 意図する結果: 64 の生産者と 64 の消費者で欠けや重複がなく、各消費者が同じ生産者の要素をプッシュした順に受け取ることを確認する。
+// 補足: 生産者・消費者の半分は 1 個ずつ、残りはまとめて操作する。
+TEST(MpmcQueueTest, StressManyProducersConsumers) {
+    const int threads = 64;
+    const int perProducer = 500;
+    const int batch = 7;
+    MpmcQueue<int> queue(64);
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < threads; ++p) {
+        producers.emplace_back([&queue, p] {
+            std::vector<int> items;
+            for (int i = 0; i < perProducer; ++i) {
+                items.push_back(p * perProducer + i);
+            }
+            if (p % 2 == 0) {
+                for (int item : items) {
+                    queue.Push(item);
+                }
+                return;
+            }
+            for (size_t i = 0; i < items.size(); i += batch) {
+                queue.PushBulk(items.begin() + i, items.begin() + std::min(items.size(), i + batch));
+            }
+        });
+    }
+
+    std::vector<std::vector<int>> received(threads);
+    std::vector<std::thread> consumers;
+    for (int c = 0; c < threads; ++c) {
+        consumers.emplace_back([&queue, &received, c] {
+            std::vector<int>& items = received[c];
+            if (c % 2 == 0) {
+                try {
+                    for (;;) {
+                        items.push_back(queue.Pop());
+                    }
+                }
+                catch (const std::out_of_range&) {
+                }
+                return;
+            }
+            while (queue.PopBulk(std::back_inserter(items), batch) > 0) {
+            }
+        });
+    }
+
+    for (std::thread& producer : producers) {
+        producer.join();
+    }
+    queue.Close();
+    for (std::thread& consumer : consumers) {
+        consumer.join();
+    }
+
+    std::vector<int> seen(threads * perProducer, 0);
+    bool ordered = true;
+    for (const std::vector<int>& items : received) {
+        std::vector<int> last(threads, -1);
+        for (int item : items) {
+            seen[item]++;
+            int producer = item / perProducer;
+            ordered = ordered && item > last[producer];
+            last[producer] = item;
+        }
+    }
+    EXPECT_TRUE(ordered);
+    EXPECT_EQ(std::count(seen.begin(), seen.end(), 1), threads * perProducer);
+    EXPECT_TRUE(queue.IsEmpty());
+}
+
+// テスト3: 待ち時間が空回りより長くなった際の挙動
+// インターフェース:プッシュ、ポップ、まとめてプッシュ・ポップ、クローズ
+// 想定する戻り値: プッシュした全ての要素が 1 回ずつ返され、閉じられて空になると例外または 0
+// 意図する結果: 空のキューで眠った複数の消費者と、満杯のキューで眠った複数の生産者が、他方の操作とクローズで起きることを確認する。
+// 補足: 相手側はスレッドを譲る回数の上限を十分に超える時間だけ止めてから操作する。
+TEST(MpmcQueueTest, WakeParkedThreads) {
+    const int count = 40;
+    MpmcQueue<int> queue(2);
+    std::atomic<int> popped(0);
+    std::vector<std::thread> consumers;
+    for (int c = 0; c < 4; ++c) {
+        consumers.emplace_back([&queue, &popped, c] {
+            if (c % 2 == 0) {
+                try {
+                    for (;;) {
+                        queue.Pop();
+                        popped++;
+                    }
+                }
+                catch (const std::out_of_range&) {
+                }
+                return;
+            }
+            std::vector<int> items;
+            while (queue.PopBulk(std::back_inserter(items), 3) > 0) {
+            }
+            popped += static_cast<int>(items.size());
+        });
+    }
+    for (int i = 0; i < count; ++i) {
+        if (i % 10 == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20)); // 消費者が空のキューで眠る
+        }
+        queue.Push(i);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    queue.Close();
+    for (std::thread& consumer : consumers) {
+        consumer.join();
+    }
+    EXPECT_EQ(popped.load(), count);
+
+    // 満杯のキューに複数の生産者を眠らせてから、ポップで空きを作る
+    MpmcQueue<int> full(2);
+    full.Push(-1);
+    full.Push(-2);
+    std::atomic<int> pushed(0);
+    std::vector<std::thread> producers;
+    for (int p = 0; p < 4; ++p) {
+        producers.emplace_back([&full, &pushed, p] {
+            std::vector<int> items = { p * 2, p * 2 + 1 };
+            if (p % 2 == 0) {
+                full.Push(items[0]);
+                full.Push(items[1]);
+            }
+            else {
+                full.PushBulk(items.begin(), items.end());
+            }
+            pushed += 2;
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(pushed.load(), 0);
+    std::vector<int> seen(8, 0);
+    for (int i = 0; i < 10; ++i) {
+        int data = full.Pop();
+        if (data >= 0) {
+            seen[data]++;
+        }
+    }
+    for (std::thread& producer : producers) {
+        producer.join();
+    }
+    EXPECT_EQ(pushed.load(), 8);
+    EXPECT_EQ(std::count(seen.begin(), seen.end(), 1), 8);
+    EXPECT_TRUE(full.IsEmpty());
+}
+
+// ConcurrentStack tests
+// テスト0: 1 スレッドでプッシュ・ポップした際の挙動
+// インターフェース:プッシュ、ポップ
+// 想定する戻り値: 最後にプッシュした要素から順に返され、容量を超えるプッシュは FALSE
+// 意図する結果: 容量までプッシュでき、空になるとポップが例外になることを確認する。
+// 補足:
+TEST(ConcurrentStackTest, PushPopSingleThread) {
+    ConcurrentStack<std::string> stack(3);
+    EXPECT_EQ(stack.GetCapacity(), 3u);
+    EXPECT_TRUE(stack.IsEmpty());
+    const std::string user = "User";
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_TRUE(stack.TryPush(user + std::to_string(i)));
+    }
+    EXPECT_FALSE(stack.TryPush(user));
+    EXPECT_EQ(stack.Pop(), "User2");
+    EXPECT_TRUE(stack.TryPush(user + "3"));
+
+    std::string data;
+    EXPECT_TRUE(stack.TryPop(data));
+    EXPECT_EQ(data, "User3");
+    EXPECT_EQ(stack.Pop(), "User1");
+    EXPECT_EQ(stack.Pop(), "User0");
+    EXPECT_FALSE(stack.TryPop(data));
+    EXPECT_THROW(stack.Pop(), std::out_of_range);
+    EXPECT_TRUE(stack.IsEmpty());
+}
+
+// テスト1: ムーブのみ可能な型を扱った際の挙動
+// インターフェース:プッシュ、ポップ、デストラクタ
+// 想定する戻り値: 最後にプッシュした要素
+// 意図する結果: コピーできない要素を受け渡せ、残った要素がデストラクタで破棄されることを確認する。
+// 補足:
+TEST(ConcurrentStackTest, MoveOnlyType) {
+    std::shared_ptr<int> counter = std::make_shared<int>(0);
+    {
+        ConcurrentStack<std::unique_ptr<std::shared_ptr<int>>> stack(4);
+        for (int i = 0; i < 3; ++i) {
+            stack.Push(std::unique_ptr<std::shared_ptr<int>>(new std::shared_ptr<int>(counter)));
+        }
+        EXPECT_EQ(counter.use_count(), 4);
+        std::unique_ptr<std::shared_ptr<int>> data = stack.Pop();
+        EXPECT_EQ(data->get(), counter.get());
+    }
+    EXPECT_EQ(counter.use_count(), 1);
+}
+
+// テスト2: 多数のスレッドで空きリストとして使った際の挙動
+// インターフェース:プッシュ、ポップ
+// 想定する戻り値: 全ての番号がちょうど 1 回ずつ残る
+// 意図する結果: 64 スレッドが番号を取り出して戻すことを繰り返しても、同じ番号を 2 つのスレッドが同時に持たないことを確認する。
+// 補足: 同じノードが外されて戻される (ABA) 状況を頻繁に起こす。消去配列を使う場合と使わない場合の両方で確認する。
+TEST(ConcurrentStackTest, StressFreeList) {
+    const int threads = 64;
+    const int tokens = 16;
+    const int rounds = 2000;
+    for (int elimination = 0; elimination < 2; ++elimination) {
+        ConcurrentStack<int> stack(tokens, elimination == 1);
+        for (int i = 0; i < tokens; ++i) {
+            EXPECT_TRUE(stack.TryPush(i));
+        }
+
+        std::vector<std::atomic<int>> owners(tokens);
+        for (std::atomic<int>& owner : owners) {
+            owner.store(0);
+        }
+        std::atomic<bool> conflict(false);
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; ++t) {
+            workers.emplace_back([&] {
+                int token;
+                for (int i = 0; i < rounds; ++i) {
+                    if (!stack.TryPop(token)) continue;
+                    if (owners[token].fetch_add(1) != 0) {
+                        conflict = true;
+                    }
+                    owners[token].fetch_sub(1);
+                    stack.Push(token);
+                }
+            });
+        }
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+
+        EXPECT_FALSE(conflict);
+        std::vector<int> seen(tokens, 0);
+        int token;
+        while (stack.TryPop(token)) {
+            seen[token]++;
+        }
+        EXPECT_EQ(std::count(seen.begin(), seen.end(), 1), tokens);
+    }
+}
+
+// PriorityQueue tests
+// テスト0: 順不同にプッシュした要素をポップした際の挙動
+// インターフェース:プッシュ、ポップ、先頭の参照
+// 想定する戻り値: 大きい要素から順に返される
+// 意図する結果: 4 分ヒープの複数の段にまたがる要素数でも、重複を含めて降順に取り出されることを確認する。
+// 補足: 空の場合はポップと先頭の参照が例外になる。
+TEST(PriorityQueueTest, PushPopOrder) {
+    PriorityQueue<int> queue;
+    EXPECT_THROW(queue.Top(), std::out_of_range);
+    EXPECT_THROW(queue.Pop(), std::out_of_range);
+    for (int i = 0; i < 200; ++i) {
+        queue.Push((i * 37) % 101);
+    }
+    EXPECT_EQ(queue.GetSize(), 200);
+    EXPECT_EQ(queue.Top(), 100);
+    int previous = queue.Pop();
+    int data;
+    while (queue.TryPop(data)) {
+        EXPECT_LE(data, previous);
+        previous = data;
+    }
+    EXPECT_TRUE(queue.IsEmpty());
+    EXPECT_FALSE(queue.TryPop(data));
+}
+
+// テスト1: 比較関数を指定した際の挙動
+// インターフェース:プッシュ、ポップ
+// 想定する戻り値: 比較関数で見て最も大きい要素から順に返される
+// 意図する結果: std::greater を指定すると最小値から取り出され、ムーブのみ可能な型も扱えることを確認する。
+// 補足:
+TEST(PriorityQueueTest, CustomCompare) {
+    PriorityQueue<int, std::greater<int>> minQueue;
+    minQueue.Push(3);
+    minQueue.Push(1);
+    minQueue.Push(2);
+    EXPECT_EQ(minQueue.Pop(), 1);
+    EXPECT_EQ(minQueue.Pop(), 2);
+    EXPECT_EQ(minQueue.Pop(), 3);
+
+    auto byValue = [](const std::unique_ptr<int>& a, const std::unique_ptr<int>& b) { return *a < *b; };
+    PriorityQueue<std::unique_ptr<int>, decltype(byValue)> pointers(byValue);
+    pointers.Push(std::unique_ptr<int>(new int(5)));
+    pointers.Push(std::unique_ptr<int>(new int(9)));
+    EXPECT_EQ(*pointers.Pop(), 9);
+    EXPECT_EQ(*pointers.Pop(), 5);
+}
+
+// テスト2: 識別子で優先度を上げた際の挙動
+// インターフェース:優先度の変更
+// 想定する戻り値: 優先度を上げた場合は TRUE、下げようとした場合やポップ済みの識別子は FALSE
+// 意図する結果: 優先度を上げた要素が正しい位置に移動し、ポップ後の識別子が無効になることを確認する。
+//               ポップ後にプッシュして枠が再利用されても、ポップ済みの識別子が新しい要素を指さないことを確認する。
+// 補足: スコアとユーザー名の組をスコアで比較する。
+TEST(PriorityQueueTest, DecreaseKey) {
+    typedef std::pair<int, std::string> Score;
+    PriorityQueue<Score> queue;
+    std::vector<PriorityQueue<Score>::Handle> handles;
+    for (int i = 0; i < 20; ++i) {
+        handles.push_back(queue.Push(Score(i, "User" + std::to_string(i))));
+    }
+    EXPECT_TRUE(queue.DecreaseKey(handles[3], Score(50, "User3")));
+    EXPECT_FALSE(queue.DecreaseKey(handles[5], Score(1, "User5")));
+    EXPECT_TRUE(queue.DecreaseKey(handles[7], Score(30, "User7")));
+
+    EXPECT_EQ(queue.Pop().second, "User3");
+    EXPECT_FALSE(queue.Contains(handles[3]));
+    EXPECT_FALSE(queue.DecreaseKey(handles[3], Score(60, "User3")));
+    EXPECT_EQ(queue.Pop().second, "User7");
+    EXPECT_EQ(queue.Pop().second, "User19");
+    EXPECT_TRUE(queue.Contains(handles[5]));
+    EXPECT_EQ(queue.GetSize(), 17);
+
+    // ポップで空いた枠に入った要素を、ポップ済みの識別子で書き換えられないこと
+    PriorityQueue<Score>::Handle reused = queue.Push(Score(0, "User20"));
+    EXPECT_NE(reused, handles[19]);
+    EXPECT_FALSE(queue.Contains(handles[3]));
+    EXPECT_FALSE(queue.Contains(handles[7]));
+    EXPECT_FALSE(queue.Contains(handles[19]));
+    EXPECT_FALSE(queue.DecreaseKey(handles[19], Score(100, "User19")));
+    EXPECT_TRUE(queue.Contains(reused));
+    EXPECT_TRUE(queue.DecreaseKey(reused, Score(40, "User20")));
+    EXPECT_EQ(queue.Pop().second, "User20");
+    EXPECT_EQ(queue.Pop().second, "User18");
+
+    // Build の前に返した識別子は、同じ枠に入った新しい要素を指さないこと
+    DoublyLinkedList<Score> list;
+    for (int i = 0; i < 30; ++i) {
+        list.Insert(list.end(), Score(i, "Built" + std::to_string(i)));
+    }
+    std::vector<PriorityQueue<Score>::Handle> built;
+    queue.Build(list, &built);
+    for (int i = 0; i < 20; ++i) {
+        EXPECT_FALSE(queue.Contains(handles[i]));
+        EXPECT_FALSE(queue.DecreaseKey(handles[i], Score(100, "Stale")));
+    }
+    EXPECT_FALSE(queue.Contains(reused));
+    EXPECT_TRUE(queue.Contains(built[0]));
+    EXPECT_TRUE(queue.DecreaseKey(built[0], Score(50, "Built0")));
+    EXPECT_EQ(queue.Pop().second, "Built0");
+    EXPECT_EQ(queue.Pop().second, "Built29");
+    EXPECT_EQ(queue.GetSize(), 28);
+}
+
+// テスト3: リストからまとめて作った際の挙動
+// インターフェース:まとめて構築
+// 想定する戻り値: リストの全要素が降順に返される
+// 意図する結果: それまでの要素が破棄され、返された識別子でリストの i 番目の要素を操作できることを確認する。
+// 補足:
+TEST(PriorityQueueTest, BuildFromList) {
+    DoublyLinkedList<int> list;
+    for (int i = 0; i < 50; ++i) {
+        list.Insert(list.end(), (i * 13) % 50);
+    }
+    PriorityQueue<int> queue;
+    queue.Push(1000);
+    std::vector<PriorityQueue<int>::Handle> handles;
+    queue.Build(list, &handles);
+    EXPECT_EQ(queue.GetSize(), 50);
+    ASSERT_EQ(handles.size(), 50u);
+    EXPECT_TRUE(queue.DecreaseKey(handles[1], 100));
+    EXPECT_EQ(queue.Pop(), 100);
+    EXPECT_FALSE(queue.Contains(handles[1]));
+    for (int expected = 49; expected >= 0; --expected) {
+        if (expected == 13) continue;
+        EXPECT_EQ(queue.Pop(), expected);
+    }
+    EXPECT_TRUE(queue.IsEmpty());
+}
+
+// テスト4: ソートしたリストと取り出す順序を比べた際の挙動
+// インターフェース:まとめて構築、ポップ
+// 想定する戻り値: 降順にソートしたリストと同じ順序の要素
+// 意図する結果: 最小値が末尾にあるリストでも、ソートとポップの結果が一致することを確認する。
+// 補足: 最小値が末尾にあると、ソートのピボットがリストの先頭に来る。
+TEST(PriorityQueueTest, MatchesSortedList) {
+    DoublyLinkedList<int> list;
+    int values[] = { 2, 3, 7, 5, 7, 4, 1 };
+    for (int value : values) {
+        list.Insert(list.end(), value);
+    }
+    PriorityQueue<int> queue;
+    queue.Build(list);
+    list.Sort([](const int& a, const int& b) { return a > b; });
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        EXPECT_EQ(queue.Pop(), *it);
+    }
+    EXPECT_TRUE(queue.IsEmpty());
+}
+
+// BoundedQueue tests
+// テスト0: 満杯のキューにプッシュした際の挙動
+// インターフェース:プッシュ (すぐに失敗する)
+// 想定する戻り値: 容量までは TRUE、満杯になると FALSE
+// 意図する結果: 容量を超えて要素が増えず、ポップで空きができると再びプッシュできることを確認する。
+// 補足:
+TEST(BoundedQueueTest, TryPushWhenFull) {
+    BoundedQueue<std::string> queue(2);
+    EXPECT_EQ(queue.GetCapacity(), 2u);
+    EXPECT_TRUE(queue.TryPush("User1"));
+    EXPECT_TRUE(queue.TryPush("User2"));
+    EXPECT_FALSE(queue.TryPush("User3"));
+    EXPECT_EQ(queue.GetSize(), 2);
+    EXPECT_EQ(queue.Pop(), "User1");
+    EXPECT_TRUE(queue.TryPush("User3"));
+
+    std::string data;
+    EXPECT_TRUE(queue.TryPop(data));
+    EXPECT_EQ(data, "User2");
+    EXPECT_TRUE(queue.TryPop(data));
+    EXPECT_EQ(data, "User3");
+    EXPECT_FALSE(queue.TryPop(data));
+}
+
+// テスト1: 読み込みが処理より速い場合の挙動
+// インターフェース:プッシュ (待つ)、まとめて取り出し
+// 想定する戻り値: プッシュした順の要素
+// 意図する結果: 生産者が容量で待たされ、要素数が容量を超えないまま全ての要素がまとめて取り出されることを確認する。
+// 補足:
+TEST(BoundedQueueTest, BackpressureAndDrain) {
+    const int count = 10000;
+    BoundedQueue<int> queue(8);
+    std::thread producer([&] {
+        for (int i = 0; i < count; ++i) {
+            queue.Push(i);
+        }
+        queue.Close();
+    });
+
+    std::vector<int> received;
+    size_t largestBatch = 0;
+    size_t drained;
+    while ((drained = queue.DrainTo(received, 16)) > 0) {
+        largestBatch = std::max(largestBatch, drained);
+    }
+    producer.join();
+
+    EXPECT_LE(largestBatch, 8u);
+    ASSERT_EQ(received.size(), static_cast<size_t>(count));
+    for (int i = 0; i < count; ++i) {
+        EXPECT_EQ(received[i], i);
+    }
+    EXPECT_EQ(queue.TryDrainTo(received, 16), 0u);
+}
+
+// テスト2: 待っているスレッドがいる状態で閉じた際の挙動
+// インターフェース:クローズ、プッシュ、ポップ
+// 想定する戻り値: 閉じた後のプッシュは FALSE、残りの要素を取り出した後のポップは例外
+// 意図する結果: 満杯で待つ生産者と空で待つ消費者が、閉じることで起こされることを確認する。
+// 補足:
+TEST(BoundedQueueTest, CloseWakesWaiters) {
+    BoundedQueue<int> full(1);
+    EXPECT_TRUE(full.Push(1));
+    bool pushed = true;
+    std::thread producer([&] {
+        pushed = full.Push(2);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    full.Close();
+    producer.join();
+    EXPECT_FALSE(pushed);
+    EXPECT_TRUE(full.IsClosed());
+    EXPECT_EQ(full.Pop(), 1);
+    EXPECT_THROW(full.Pop(), std::out_of_range);
+
+    BoundedQueue<int> empty(4);
+    bool threw = false;
+    std::thread consumer([&] {
+        try {
+            empty.Pop();
+        }
+        catch (const std::out_of_range&) {
+            threw = true;
+        }
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    empty.Close();
+    consumer.join();
+    EXPECT_TRUE(threw);
+    EXPECT_FALSE(empty.TryPush(1));
+}
+
+// WorkStealingDeque tests
+// テスト0: 所有スレッドだけでプッシュ・ポップした際の挙動
+// インターフェース:プッシュ、ポップ、盗む
+// 想定する戻り値: ポップは最後にプッシュした要素から、盗むのは最初にプッシュした要素から返される
+// 意図する結果: 初期の長さを超えてプッシュするとリングが伸び、要素が失われないことを確認する。
+// 補足:
+TEST(WorkStealingDequeTest, PushPopSteal) {
+    WorkStealingDeque<int> deque(4);
+    EXPECT_EQ(deque.GetCapacity(), 4u);
+    EXPECT_TRUE(deque.IsEmpty());
+    for (int i = 0; i < 10; ++i) {
+        deque.Push(i);
+    }
+    EXPECT_EQ(deque.GetCapacity(), 16u);
+
+    int data = -1;
+    EXPECT_TRUE(deque.Steal(data));
+    EXPECT_EQ(data, 0);
+    EXPECT_TRUE(deque.Pop(data));
+    EXPECT_EQ(data, 9);
+    EXPECT_TRUE(deque.Steal(data));
+    EXPECT_EQ(data, 1);
+    for (int expected = 8; expected >= 2; --expected) {
+        EXPECT_TRUE(deque.Pop(data));
+        EXPECT_EQ(data, expected);
+    }
+    EXPECT_FALSE(deque.Pop(data));
+    EXPECT_FALSE(deque.Steal(data));
+    EXPECT_TRUE(deque.IsEmpty());
+}
+
+// テスト1: 所有スレッドと盗むスレッドを同時に動かした際の挙動
+// インターフェース:プッシュ、ポップ、盗む
+// 想定する戻り値: 全ての要素がちょうど 1 回ずつ取り出される
+// 意図する結果: 最後の 1 要素の取り合いやリングの移し替えの最中でも、欠けや重複がないことを確認する。
+// 補足:
+TEST(WorkStealingDequeTest, ConcurrentSteal) {
+    const int count = 100000;
+    const int thieves = 4;
+    WorkStealingDeque<int> deque(2);
+    std::vector<int> taken(count, 0);
+    std::atomic<int> remaining(count);
+
+    std::vector<std::vector<int>> stolen(thieves);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thieves; ++t) {
+        threads.emplace_back([&deque, &stolen, &remaining, t] {
+            int data;
+            while (remaining > 0) {
+                if (deque.Steal(data)) {
+                    stolen[t].push_back(data);
+                    remaining--;
+                }
+            }
+        });
+    }
+
+    int data;
+    for (int i = 0; i < count; ++i) {
+        deque.Push(i);
+        if (i % 3 == 0 && deque.Pop(data)) {
+            taken[data]++;
+            remaining--;
+        }
+    }
+    while (deque.Pop(data)) {
+        taken[data]++;
+        remaining--;
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    for (const std::vector<int>& items : stolen) {
+        for (int item : items) {
+            taken[item]++;
+        }
+    }
+    EXPECT_EQ(std::count(taken.begin(), taken.end(), 1), count);
+}
+
+// TaskPool tests
+// テスト0: 分割統治でフィボナッチ数を計算した際の挙動
+// インターフェース:タスクの追加、完了待ち
+// 想定する戻り値: fib(22) = 17711
+// 意図する結果: タスク内からタスクを追加して待つ入れ子の fork-join が正しく完了することを確認する。
+// 補足: スレッド数 1 (ワーカーなし) と 4 の両方で確認する。
+TEST(TaskPoolTest, ForkJoinFibonacci) {
+    for (unsigned threads : { 1u, 4u }) {
+        TaskPool pool(threads);
+        EXPECT_EQ(pool.GetThreadCount(), threads);
+        std::function<long long(int)> fib = [&](int n) -> long long {
+            if (n < 2) return n;
+            long long left = 0;
+            TaskGroup group;
+            pool.Run(group, [&] { left = fib(n - 1); });
+            long long right = fib(n - 2);
+            pool.Wait(group);
+            return left + right;
+        };
+        EXPECT_EQ(fib(22), 17711);
+    }
+}
+
+// テスト1: プール外の複数のスレッドからタスクを追加した際の挙動
+// インターフェース:タスクの追加、完了待ち
+// 想定する戻り値: 全てのタスクがちょうど 1 回ずつ実行される
+// 意図する結果: プール外のスレッドが共有する両端キューに同時に積んでも、タスクが失われないことを確認する。
+// 補足:
+TEST(TaskPoolTest, ExternalThreads) {
+    TaskPool pool(3);
+    std::atomic<int> executed(0);
+    std::vector<std::thread> submitters;
+    for (int t = 0; t < 4; ++t) {
+        submitters.emplace_back([&] {
+            TaskGroup group;
+            for (int i = 0; i < 1000; ++i) {
+                pool.Run(group, [&] { executed++; });
+            }
+            pool.Wait(group);
+        });
+    }
+    for (std::thread& submitter : submitters) {
+        submitter.join();
+    }
+    EXPECT_EQ(executed, 4000);
+}
+
+// テスト2: 完了を待たずにプールを破棄した際の挙動
+// インターフェース:タスクの追加、デストラクタ
+// 想定する戻り値: 全てのタスクがちょうど 1 回ずつ実行される
+// 意図する結果: ワーカーのいないプールでも、デストラクタが未実行のタスク (タスク内で追加したものを含む) を全て実行することを確認する。
+// 補足: スレッド数 1 (ワーカーなし) と 4 の両方で確認する。
+TEST(TaskPoolTest, DestructorRunsPendingTasks) {
+    for (unsigned threads : { 1u, 4u }) {
+        std::atomic<int> executed(0);
+        TaskGroup group;
+        {
+            TaskPool pool(threads);
+            for (int i = 0; i < 100; ++i) {
+                pool.Run(group, [&] {
+                    executed++;
+                    pool.Run(group, [&] { executed++; });
+                });
+            }
+        }
+        EXPECT_EQ(executed, 200);
+    }
+}
+
+// DelayQueue tests
+// テスト0: 期限前の要素をポップした際の挙動
+// インターフェース:プッシュ (遅延付き)、ポップ (すぐに失敗する / 待つ)
+// 想定する戻り値: 期限前は FALSE、期限を過ぎると TRUE
+// 意図する結果: 期限を過ぎるまで要素がポップできず、待つポップが期限を過ぎてから要素を返すことを確認する。
+// 補足:
+TEST(DelayQueueTest, NotReadyBeforeDeadline) {
+    DelayQueue<std::string> queue;
+    auto start = DelayQueue<std::string>::Clock::now();
+    EXPECT_TRUE(queue.Push("User1", std::chrono::milliseconds(50)));
+    EXPECT_EQ(queue.GetSize(), 1u);
+
+    std::string data;
+    EXPECT_FALSE(queue.TryPopReady(data));
+    EXPECT_FALSE(queue.PopReady(data, std::chrono::milliseconds(0)));
+    EXPECT_TRUE(queue.PopReady(data, std::chrono::seconds(5)));
+    EXPECT_GE(DelayQueue<std::string>::Clock::now() - start, std::chrono::milliseconds(50));
+    EXPECT_EQ(data, "User1");
+    EXPECT_TRUE(queue.IsEmpty());
+}
+
+// テスト1: 期限がばらばらの要素を順不同でプッシュした際の挙動
+// インターフェース:プッシュ (期限付き)、ポップ (待つ)
+// 想定する戻り値: 期限の早い順の要素
+// 意図する結果: 上の段から下の段へ振り分け直された要素も含めて、期限を過ぎてから期限順にポップされることを確認する。
+// 補足: 1 刻みを 1 マイクロ秒にして、最大 150 ミリ秒 (3 段目まで) の期限を使う
+TEST(DelayQueueTest, DeadlineOrderAcrossLevels) {
+    typedef DelayQueue<int>::Clock Clock;
+    DelayQueue<int> queue(std::chrono::microseconds(1));
+    const int count = 300;
+    std::vector<int> delays;
+    for (int i = 0; i < count; ++i) {
+        delays.push_back(i * 500); // 0 から 149.5 ミリ秒 (マイクロ秒単位)
+    }
+    std::vector<int> order(delays);
+    std::reverse(order.begin(), order.end());
+    std::rotate(order.begin(), order.begin() + count / 3, order.end());
+
+    auto start = Clock::now();
+    for (int delay : order) {
+        EXPECT_TRUE(queue.PushAt(delay, start + std::chrono::microseconds(delay)));
+    }
+
+    for (int i = 0; i < count; ++i) {
+        int data = -1;
+        ASSERT_TRUE(queue.PopReady(data, std::chrono::seconds(5)));
+        EXPECT_GE(Clock::now(), start + std::chrono::microseconds(data));
+        EXPECT_EQ(data, delays[i]);
+    }
+    EXPECT_TRUE(queue.IsEmpty());
+}
+
+// テスト2: 待っている間に早い期限の要素をプッシュした際の挙動
+// インターフェース:プッシュ (遅延付き)、ポップ (待つ)
+// 想定する戻り値: 後からプッシュした期限の早い要素
+// 意図する結果: 遠い期限に合わせて眠っている消費者が、早い期限のプッシュで起こされることを確認する。
+// 補足:
+TEST(DelayQueueTest, EarlierPushWakesWaiter) {
+    DelayQueue<int> queue;
+    EXPECT_TRUE(queue.Push(1, std::chrono::seconds(10)));
+    std::thread producer([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        queue.Push(2, std::chrono::milliseconds(0));
+    });
+
+    int data = 0;
+    auto start = DelayQueue<int>::Clock::now();
+    EXPECT_TRUE(queue.PopReady(data, std::chrono::seconds(5)));
+    producer.join();
+    EXPECT_LT(DelayQueue<int>::Clock::now() - start, std::chrono::seconds(5));
+    EXPECT_EQ(data, 2);
+    EXPECT_EQ(queue.GetSize(), 1u);
+}
+
+// テスト3: 待っているスレッドがいる状態で閉じた際の挙動
+// インターフェース:クローズ、プッシュ、ポップ (待つ)
+// 想定する戻り値: 閉じた後のプッシュは FALSE、空のキューのポップは FALSE
+// 意図する結果: 空のキューで待つ消費者が閉じることで起こされ、閉じる前の要素は期限どおりにポップできることを確認する。
+// 補足:
+TEST(DelayQueueTest, CloseWakesWaiters) {
+    DelayQueue<int> empty;
+    bool popped = true;
+    std::thread consumer([&] {
+        int data;
+        popped = empty.PopReady(data, std::chrono::seconds(10));
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    empty.Close();
+    consumer.join();
+    EXPECT_FALSE(popped);
+    EXPECT_TRUE(empty.IsClosed());
+    EXPECT_FALSE(empty.Push(1, std::chrono::milliseconds(0)));
+
+    DelayQueue<int> pending;
+    EXPECT_TRUE(pending.Push(1, std::chrono::milliseconds(20)));
+    pending.Close();
+    int data = 0;
+    EXPECT_TRUE(pending.PopReady(data, std::chrono::seconds(5)));
+    EXPECT_EQ(data, 1);
+    EXPECT_FALSE(pending.PopReady(data, std::chrono::seconds(5)));
+}
+
+// テスト4: 段の境目でちょうど止まった後に、0 段目と 1 段目に要素がある際の挙動
+// インターフェース:プッシュ (期限付き)、ポップ (すぐに失敗する)
+// 想定する戻り値: 期限を過ぎた後すぐに TRUE
+// 意図する結果: 消費者が毎刻み確認して、現在の刻みが 256 刻みの境目で止まっても、1 段目の要素が振り分け直されて
+//               1 周 (65536 刻み) 遅れずにポップされることを確認する。
+// 補足: 1 刻みを 200 マイクロ秒にして、1 段目に入る 300 刻み先の要素と、0 段目に入る 262 刻み先の要素を使う
+TEST(DelayQueueTest, CascadeAtBoundaryWithLevelZeroOccupied) {
+    typedef DelayQueue<int>::Clock Clock;
+    const auto tick = std::chrono::microseconds(200);
+    auto start = Clock::now();
+    DelayQueue<int> queue(tick);
+    EXPECT_TRUE(queue.PushAt(300, start + tick * 300)); // 現在から 256 刻み以上先なので 1 段目に入る
+
+    int data = 0;
+    while (Clock::now() < start + tick * 20) {
+        EXPECT_FALSE(queue.TryPopReady(data));
+    }
+    EXPECT_TRUE(queue.PushAt(262, start + tick * 262)); // 現在から 256 刻み未満なので 0 段目に入る
+
+    // 毎刻み確認して、境目の刻み (256) で止まる状態を作る
+    std::vector<int> popped;
+    std::vector<Clock::duration> lateness;
+    while (popped.size() < 2 && Clock::now() < start + std::chrono::seconds(2)) {
+        if (queue.TryPopReady(data)) {
+            popped.push_back(data);
+            lateness.push_back(Clock::now() - (start + tick * data));
+        }
+    }
+    ASSERT_EQ(popped.size(), 2u);
+    EXPECT_EQ(popped[0], 262);
+    EXPECT_EQ(popped[1], 300);
+    for (Clock::duration late : lateness) {
+        EXPECT_LT(late, std::chrono::milliseconds(50));
+    }
+}
+
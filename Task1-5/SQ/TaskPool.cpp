@@ -0,0 +1,131 @@
+#include "TaskPool.h"
+
+namespace {
+    // 現在のスレッドが所属するプールと両端キュー番号
+    thread_local const TaskPool* currentPool = nullptr;
+    thread_local size_t currentIndex = 0;
+}
+
+// TaskGroup コンストラクタ
+TaskGroup::TaskGroup() : pending(0) {}
+
+// TaskPool コンストラクタ (Wait を呼ぶスレッドの分を除いたワーカースレッドを起動する)
+TaskPool::TaskPool(unsigned threadCount) : queued(0), sleeping(0), stop(false) {
+    if (threadCount == 0) {
+        threadCount = std::thread::hardware_concurrency();
+    }
+    if (threadCount == 0) {
+        threadCount = 1;
+    }
+
+    for (unsigned i = 0; i < threadCount; ++i) {
+        deques.push_back(std::unique_ptr<WorkStealingDeque<Task*>>(new WorkStealingDeque<Task*>()));
+    }
+    for (unsigned i = 1; i < threadCount; ++i) {
+        workers.emplace_back(&TaskPool::workerLoop, this, i);
+    }
+}
+
+// 呼び出し元スレッドの両端キュー番号を取得するメソッド
+size_t TaskPool::currentQueue() const {
+    return currentPool == this ? currentIndex : 0;
+}
+
+// 自分の両端キューに積むメソッド
+// 0 番は複数のプール外のスレッドが共有するため、所有スレッド側の操作をミューテックスで直列化する
+void TaskPool::push(size_t self, Task* task) {
+    if (self == 0) {
+        std::lock_guard<std::mutex> lock(externalMutex);
+        deques[0]->Push(task);
+        return;
+    }
+    deques[self]->Push(task);
+}
+
+// 自分の両端キューから取り出すメソッド
+bool TaskPool::popOwn(size_t self, Task*& task) {
+    if (self == 0) {
+        std::lock_guard<std::mutex> lock(externalMutex);
+        return deques[0]->Pop(task);
+    }
+    return deques[self]->Pop(task);
+}
+
+// タスクを 1 つ取り出して実行するメソッド
+// 自分の両端キューの末尾 (最後に積んだタスク) を優先し、空なら他の両端キューの先頭から盗む
+bool TaskPool::tryRunOne(size_t self) {
+    Task* task = nullptr;
+    bool found = popOwn(self, task);
+    for (size_t i = 1; i < deques.size() && !found; ++i) {
+        found = deques[(self + i) % deques.size()]->Steal(task);
+    }
+    if (!found) return false;
+
+    queued--;
+    task->function();
+    task->group->pending--;
+    delete task;
+    return true;
+}
+
+// ワーカースレッドの処理 (終了要求があるまでタスクを実行し続ける)
+void TaskPool::workerLoop(size_t index) {
+    currentPool = this;
+    currentIndex = index;
+
+    while (true) {
+        if (tryRunOne(index)) continue;
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        // 待機中の数を増やしてから積まれた数を確認するため、Run 側は必ずどちらかに気付く
+        sleeping++;
+        wakeUp.wait(lock, [this] { return stop || queued > 0; });
+        sleeping--;
+        if (stop && queued == 0) return;
+    }
+}
+
+// タスクを追加するメソッド
+// 待機中のワーカースレッドがいる場合だけ起こすため、分割統治で細かいタスクを大量に積んでもロックを取らない
+void TaskPool::Run(TaskGroup& group, std::function<void()> function) {
+    group.pending++;
+    push(currentQueue(), new Task{ std::move(function), &group });
+    queued++;
+    if (sleeping > 0) {
+        // 待機に入る途中のスレッドが wait でロックを解放するのを待ってから通知する
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+        }
+        wakeUp.notify_one();
+    }
+}
+
+// グループの全タスクの完了を待つメソッド
+void TaskPool::Wait(TaskGroup& group) {
+    size_t self = currentQueue();
+    while (group.pending > 0) {
+        if (!tryRunOne(self)) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+// Wait を呼ぶスレッドを含めたスレッド数を取得するメソッド
+unsigned TaskPool::GetThreadCount() const {
+    return static_cast<unsigned>(deques.size());
+}
+
+// TaskPool デストラクタ
+TaskPool::~TaskPool() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stop = true;
+    }
+    wakeUp.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    // ワーカーがいない場合 (スレッド数 1) や、Wait されずに残ったタスクは呼び出し元スレッドで実行する
+    while (tryRunOne(0)) {
+    }
+}
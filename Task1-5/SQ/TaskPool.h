@@ -0,0 +1,72 @@
+#ifndef TASK_POOL_H
+#define TASK_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "ConcurrentSQ.h"
+
+class TaskPool;
+
+/**
+ * @brief タスクグループクラス
+ * まとめて完了を待つタスクの集まり
+ */
+class TaskGroup {
+private:
+    std::atomic<int> pending; // 未完了のタスク数
+
+    friend class TaskPool;
+
+public:
+    TaskGroup(); // コンストラクタ
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+};
+
+/**
+ * @brief タスクプールクラス
+ * スレッドごとにワークスティーリング両端キューを持つ固定数のスレッドプール
+ * 自分の両端キューには末尾から積んで末尾から取り出し、空になったら他のスレッドの両端キューの先頭から盗む
+ * タスク内から Run / Wait を呼び出して分割統治 (fork-join) できる
+ */
+class TaskPool {
+private:
+    // 実行するタスク
+    struct Task {
+        std::function<void()> function; // 実行する処理
+        TaskGroup* group;               // 所属するグループ
+    };
+
+    std::vector<std::unique_ptr<WorkStealingDeque<Task*>>> deques; // 両端キュー (0 番はプール外のスレッド用)
+    std::mutex externalMutex;        // 0 番の両端キューへのプッシュ・ポップを直列化するミューテックス
+    std::vector<std::thread> workers; // ワーカースレッド
+    std::mutex sleepMutex;           // 待機用のミューテックス
+    std::condition_variable wakeUp;  // タスク追加を通知する条件変数
+    std::atomic<int> queued;         // 両端キューに積まれているタスク数
+    std::atomic<int> sleeping;       // 待機中のワーカースレッド数
+    bool stop;                       // 終了要求
+
+    size_t currentQueue() const; // 呼び出し元スレッドの両端キュー番号を取得 (プール外のスレッドは 0)
+    void push(size_t self, Task* task); // 自分の両端キューに積む
+    bool popOwn(size_t self, Task*& task); // 自分の両端キューから取り出す
+    bool tryRunOne(size_t self); // タスクを 1 つ取り出して実行 (どの両端キューも空の場合は false)
+    void workerLoop(size_t index); // ワーカースレッドの処理
+
+public:
+    explicit TaskPool(unsigned threadCount); // コンストラクタ (Wait を呼ぶスレッドを含めたスレッド数、0 の場合はハードウェアのスレッド数)
+    TaskPool(const TaskPool&) = delete;
+    TaskPool& operator=(const TaskPool&) = delete;
+
+    void Run(TaskGroup& group, std::function<void()> function); // タスクを追加
+    void Wait(TaskGroup& group); // グループの全タスクの完了を待つ (待っている間も他のタスクを実行する)
+    unsigned GetThreadCount() const; // Wait を呼ぶスレッドを含めたスレッド数を取得
+
+    ~TaskPool(); // デストラクタ (未実行のタスクを全て実行してから終了する)
+};
+
+#endif // TASK_POOL_H
@@ -0,0 +1,818 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <cstdlib>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../SQ/ConcurrentSQ.h"
+#include "../SQ/SQ.h"
+#include "../SQ/TaskPool.h"
+
+// 確保回数 (operator new の呼び出し回数)
+std::atomic<long long> allocationCount(0);
+
+// 確保回数を数える operator new
+void* operator new(std::size_t size) {
+    allocationCount++;
+    void* memory = std::malloc(size == 0 ? 1 : size);
+    if (memory == nullptr) {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+// operator new に対応する operator delete
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+// サイズ付きの operator delete
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+/**
+ * @brief 結果データ構造体
+ */
+struct ResultData {
+    int score;
+    std::string username;
+};
+
+// 処理時間を計る関数
+// 入力: 計測する処理 (Function function)
+// 戻り値: 処理時間 (ミリ秒)
+template<typename Function>
+double MeasureMilliseconds(Function function) {
+    auto start = std::chrono::steady_clock::now();
+    function();
+    auto finish = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(finish - start).count();
+}
+
+// 計測用のデータを作る関数
+// 入力: 番号 (int i)
+// 戻り値: 番号をスコアとユーザー名にしたデータ
+template<typename T>
+T MakeItem(int i);
+
+template<>
+int MakeItem<int>(int i) {
+    return i;
+}
+
+template<>
+ResultData MakeItem<ResultData>(int i) {
+    return ResultData{ i, "User" + std::to_string(i) };
+}
+
+// 1 操作あたりの時間を表示する関数
+// 入力: 項目名 (const std::string& name), 処理時間 (double milliseconds), 操作数 (long long operations)
+void PrintResult(const std::string& name, double milliseconds, long long operations) {
+    std::cout << name << "\t" << std::fixed << std::setprecision(2) << milliseconds * 1000000.0 / operations << std::endl;
+}
+
+// ストレージごとのスタック・キューの処理時間を計測する関数
+// 入力: 要素数 (int count), 表示するストレージ名 (const std::string& name)
+// 期待結果: まとめてプッシュ・ポップ、一定数を保ったプッシュ・ポップ、ヒープを散らかした後のポップの 1 操作あたりの時間を表示する
+//           最後の項目はノードがヒープ上に散らばった状態での読み出しで、キャッシュミスの影響を見るためのもの
+template<typename T, typename Storage>
+void BenchmarkStorage(int count, const std::string& name) {
+    {
+        // 最初の計測にヒープを広げる時間が入らないよう、1 回空回しする
+        Stack<T, Storage> stack;
+        for (int i = 0; i < count; ++i) {
+            stack.Push(MakeItem<T>(i));
+        }
+        while (!stack.IsEmpty()) {
+            stack.Pop();
+        }
+        double elapsed = MeasureMilliseconds([&] {
+            for (int i = 0; i < count; ++i) {
+                stack.Push(MakeItem<T>(i));
+            }
+            while (!stack.IsEmpty()) {
+                stack.Pop();
+            }
+        });
+        PrintResult(name + "\tStack push+pop", elapsed, 2LL * count);
+    }
+    {
+        Queue<T, Storage> queue;
+        double elapsed = MeasureMilliseconds([&] {
+            for (int i = 0; i < count; ++i) {
+                queue.Push(MakeItem<T>(i));
+            }
+            while (!queue.IsEmpty()) {
+                queue.Pop();
+            }
+        });
+        PrintResult(name + "\tQueue push+pop", elapsed, 2LL * count);
+    }
+    {
+        // 1000 件を保ったまま流し続ける
+        Queue<T, Storage> queue;
+        for (int i = 0; i < 1000; ++i) {
+            queue.Push(MakeItem<T>(i));
+        }
+        double elapsed = MeasureMilliseconds([&] {
+            for (int i = 0; i < count; ++i) {
+                queue.Push(MakeItem<T>(i));
+                queue.Pop();
+            }
+        });
+        PrintResult(name + "\tQueue steady", elapsed, 2LL * count);
+    }
+    {
+        // プッシュの合間に別の確保を挟み、ノードをヒープ上に散らばらせる
+        Queue<T, Storage> queue;
+        std::vector<std::unique_ptr<char[]>> noise;
+        for (int i = 0; i < count; ++i) {
+            queue.Push(MakeItem<T>(i));
+            noise.push_back(std::unique_ptr<char[]>(new char[48]));
+        }
+        double elapsed = MeasureMilliseconds([&] {
+            while (!queue.IsEmpty()) {
+                queue.Pop();
+            }
+        });
+        PrintResult(name + "\tQueue pop (scattered)", elapsed, count);
+    }
+}
+
+// 1 操作あたりの確保回数を計測する関数
+// 入力: 操作数 (int count), 表示するストレージ名 (const std::string& name)
+// 期待結果: 一定数を保ったキューとスタックで、プッシュ・ポップ 1 回あたりの確保回数と時間を表示する
+//           ユーザー名は短い文字列の最適化 (SSO) に収まらない長さにして、コピーすると確保が発生するようにする
+//           要素は計測前に作っておき、ムーブでプッシュする (Push(const T&) の列はコピーでプッシュする)
+template<typename Storage>
+void BenchmarkAllocations(int count, const std::string& name) {
+    std::vector<ResultData> items;
+    for (int i = 0; i < count; ++i) {
+        items.push_back(ResultData{ i, "LeaderboardUser" + std::to_string(i) });
+    }
+
+    Queue<ResultData, Storage> queue;
+    Stack<ResultData, Storage> stack;
+    for (int i = 0; i < 1000; ++i) {
+        queue.Push(items[i]);
+        stack.Push(items[i]);
+        queue.Pop();
+        stack.Pop();
+    }
+    for (int i = 0; i < 100; ++i) {
+        queue.Push(items[i]);
+        stack.Push(items[i]);
+    }
+
+    auto report = [&](const std::string& operation, double milliseconds, long long allocations) {
+        std::cout << name << "\t" << operation << "\t" << std::fixed << std::setprecision(3)
+            << static_cast<double>(allocations) / count << "\t" << std::setprecision(2)
+            << milliseconds * 1000000.0 / count << std::endl;
+    };
+
+    std::vector<ResultData> copies = items;
+    long long before = allocationCount;
+    double elapsed = MeasureMilliseconds([&] {
+        for (int i = 0; i < count; ++i) {
+            queue.Push(copies[i]);
+        }
+    });
+    report("Queue Push(const T&)", elapsed, allocationCount - before);
+
+    before = allocationCount;
+    elapsed = MeasureMilliseconds([&] {
+        for (int i = 0; i < count; ++i) {
+            queue.Pop();
+        }
+    });
+    report("Queue Pop", elapsed, allocationCount - before);
+
+    before = allocationCount;
+    elapsed = MeasureMilliseconds([&] {
+        for (int i = 0; i < count; ++i) {
+            queue.Push(std::move(items[i]));
+            queue.Pop();
+        }
+    });
+    report("Queue Push(T&&)+Pop", elapsed, allocationCount - before);
+
+    ResultData data;
+    before = allocationCount;
+    elapsed = MeasureMilliseconds([&] {
+        for (int i = 0; i < count; ++i) {
+            stack.Emplace(ResultData{ i, std::string() });
+            stack.TryPop(data);
+        }
+    });
+    report("Stack Emplace+TryPop", elapsed, allocationCount - before);
+}
+
+/**
+ * @brief ミューテックスで保護したキュークラス (比較用)
+ */
+template<typename T>
+class LockedQueue {
+private:
+    std::mutex mutex; // キューを保護するミューテックス
+    Queue<T> queue;   // 要素を格納するキュー
+
+public:
+    void Push(const T& data) { // データをプッシュ
+        std::lock_guard<std::mutex> lock(mutex);
+        queue.Push(data);
+    }
+
+    bool TryPop(T& data) { // 空でなければデータをポップ
+        std::lock_guard<std::mutex> lock(mutex);
+        return queue.TryPop(data);
+    }
+};
+
+// 空でなくなるまで待ってポップする関数
+// 入力: キュー (QueueType& queue)
+// 戻り値: ポップしたデータ
+template<typename QueueType>
+int WaitPop(QueueType& queue) {
+    SpinWait wait;
+    int data;
+    while (!queue.TryPop(data)) {
+        wait.Pause();
+    }
+    return data;
+}
+
+// 生産者スレッドから消費者スレッドへ受け渡す処理時間を計測する関数
+// 入力: キュー (QueueType& queue), 要素数 (int count)
+// 戻り値: 全ての要素を受け渡し終えるまでの処理時間 (ミリ秒)
+template<typename QueueType>
+double MeasureThroughput(QueueType& queue, int count) {
+    long long sum = 0;
+    double elapsed = MeasureMilliseconds([&] {
+        std::thread producer([&] {
+            for (int i = 0; i < count; ++i) {
+                queue.Push(i);
+            }
+        });
+        for (int i = 0; i < count; ++i) {
+            sum += WaitPop(queue);
+        }
+        producer.join();
+    });
+    if (sum != static_cast<long long>(count) * (count - 1) / 2) {
+        std::cerr << "lost elements" << std::endl;
+    }
+    return elapsed;
+}
+
+// 2 つのキューで往復する時間を計測する関数
+// 入力: 行きのキュー (QueueType& request), 帰りのキュー (QueueType& response), 往復回数 (int rounds)
+// 戻り値: 全ての往復を終えるまでの処理時間 (ミリ秒)
+template<typename QueueType>
+double MeasureRoundTrip(QueueType& request, QueueType& response, int rounds) {
+    return MeasureMilliseconds([&] {
+        std::thread echo([&] {
+            for (int i = 0; i < rounds; ++i) {
+                response.Push(WaitPop(request));
+            }
+        });
+        for (int i = 0; i < rounds; ++i) {
+            request.Push(i);
+            WaitPop(response);
+        }
+        echo.join();
+    });
+}
+
+// 単一生産者・単一消費者の受け渡しを計測する関数
+// 入力: 要素数 (int count)
+// 期待結果: ミューテックスで保護した Queue<int> と SpscQueue<int> のスループット (1 要素あたりの時間) と
+//           往復の遅延 (1 往復あたりの時間) を表示する
+void BenchmarkSpsc(int count) {
+    const int rounds = count / 10 > 0 ? count / 10 : 1;
+    {
+        LockedQueue<int> queue;
+        PrintResult("mutex+Queue\tthroughput", MeasureThroughput(queue, count), count);
+        LockedQueue<int> request;
+        LockedQueue<int> response;
+        PrintResult("mutex+Queue\tround trip", MeasureRoundTrip(request, response, rounds), rounds);
+    }
+    {
+        SpscQueue<int> queue(1024);
+        PrintResult("SpscQueue\tthroughput", MeasureThroughput(queue, count), count);
+        SpscQueue<int> request(1024);
+        SpscQueue<int> response(1024);
+        PrintResult("SpscQueue\tround trip", MeasureRoundTrip(request, response, rounds), rounds);
+    }
+}
+
+// 複数の生産者から複数の消費者へ受け渡す処理時間を計測する関数
+// 入力: キュー (QueueType& queue), 生産者と消費者それぞれのスレッド数 (int threads), 要素数 (int count)
+// 戻り値: 全ての要素を受け渡し終えるまでの処理時間 (ミリ秒)
+// 期待結果: 各消費者は残りの要素数を 1 つ予約してからポップする
+template<typename QueueType>
+double MeasureMpmc(QueueType& queue, int threads, int count) {
+    std::atomic<int> remaining(count);
+    return MeasureMilliseconds([&] {
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; ++t) {
+            workers.emplace_back([&queue, t, threads, count] {
+                for (int i = t; i < count; i += threads) {
+                    queue.Push(i);
+                }
+            });
+            workers.emplace_back([&queue, &remaining] {
+                while (remaining.fetch_sub(1) > 0) {
+                    WaitPop(queue);
+                }
+            });
+        }
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+    });
+}
+
+// まとめてプッシュ・ポップで受け渡す処理時間を計測する関数
+// 入力: 生産者と消費者それぞれのスレッド数 (int threads), 要素数 (int count), まとめる数 (int batch)
+// 戻り値: 全ての要素を受け渡し終えるまでの処理時間 (ミリ秒)
+double MeasureMpmcBulk(int threads, int count, int batch) {
+    MpmcQueue<int> queue(1024);
+    return MeasureMilliseconds([&] {
+        std::vector<std::thread> producers;
+        std::vector<std::thread> consumers;
+        for (int t = 0; t < threads; ++t) {
+            producers.emplace_back([&queue, t, threads, count, batch] {
+                std::vector<int> items;
+                for (int i = t; i < count; i += threads) {
+                    items.push_back(i);
+                }
+                for (size_t i = 0; i < items.size(); i += batch) {
+                    queue.PushBulk(items.begin() + i, items.begin() + std::min(items.size(), i + batch));
+                }
+            });
+            consumers.emplace_back([&queue, batch] {
+                std::vector<int> items;
+                while (queue.PopBulk(std::back_inserter(items), batch) > 0) {
+                    items.clear();
+                }
+            });
+        }
+        for (std::thread& producer : producers) {
+            producer.join();
+        }
+        queue.Close();
+        for (std::thread& consumer : consumers) {
+            consumer.join();
+        }
+    });
+}
+
+// 複数生産者・複数消費者の受け渡しを計測する関数
+// 入力: 要素数 (int count)
+// 期待結果: 生産者・消費者を 1 から 64 組まで増やしながら、ミューテックスで保護した Queue<int>、
+//           MpmcQueue<int>、32 個ずつまとめて操作する MpmcQueue<int> の 1 要素あたりの時間を表示する
+void BenchmarkMpmc(int count) {
+    for (int threads = 1; threads <= 64; threads *= 2) {
+        std::string pairs = std::to_string(threads) + "x" + std::to_string(threads);
+        LockedQueue<int> locked;
+        PrintResult(pairs + "\tmutex+Queue", MeasureMpmc(locked, threads, count), count);
+        MpmcQueue<int> queue(1024);
+        PrintResult(pairs + "\tMpmcQueue", MeasureMpmc(queue, threads, count), count);
+        PrintResult(pairs + "\tMpmcQueue bulk", MeasureMpmcBulk(threads, count, 32), count);
+    }
+}
+
+/**
+ * @brief ミューテックスで保護したスタッククラス (比較用)
+ */
+template<typename T>
+class LockedStack {
+private:
+    std::mutex mutex; // スタックを保護するミューテックス
+    Stack<T> stack;   // 要素を格納するスタック
+
+public:
+    void Push(const T& data) { // データをプッシュ
+        std::lock_guard<std::mutex> lock(mutex);
+        stack.Push(data);
+    }
+
+    bool TryPop(T& data) { // 空でなければデータをポップ
+        std::lock_guard<std::mutex> lock(mutex);
+        return stack.TryPop(data);
+    }
+};
+
+// 全スレッドが同じスタックにプッシュ・ポップを繰り返す処理時間を計測する関数
+// 入力: スタック (StackType& stack), スレッド数 (int threads), プッシュ・ポップの組の総数 (int count)
+// 戻り値: 全てのスレッドが終えるまでの処理時間 (ミリ秒)
+// 期待結果: 空きリストのように、各スレッドがポップした要素をすぐにプッシュして戻す
+template<typename StackType>
+double MeasureContention(StackType& stack, int threads, int count) {
+    for (int i = 0; i < threads; ++i) {
+        stack.Push(i);
+    }
+    return MeasureMilliseconds([&] {
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; ++t) {
+            workers.emplace_back([&stack, threads, count] {
+                int data;
+                for (int i = 0; i < count / threads; ++i) {
+                    if (stack.TryPop(data)) {
+                        stack.Push(data);
+                    }
+                }
+            });
+        }
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+    });
+}
+
+// 並行スタックの競合を計測する関数
+// 入力: プッシュ・ポップの組の総数 (int count)
+// 期待結果: スレッドを 1 から 64 まで増やしながら、ミューテックスで保護した Stack<int>、消去配列なしの ConcurrentStack<int>、
+//           消去配列ありの ConcurrentStack<int> のプッシュ・ポップ 1 組あたりの時間を表示する
+void BenchmarkStack(int count) {
+    for (int threads = 1; threads <= 64; threads *= 2) {
+        std::string name = std::to_string(threads);
+        LockedStack<int> locked;
+        PrintResult(name + "\tmutex+Stack", MeasureContention(locked, threads, count), count);
+        ConcurrentStack<int> plain(1024, false);
+        PrintResult(name + "\tConcurrentStack", MeasureContention(plain, threads, count), count);
+        ConcurrentStack<int> eliminating(1024);
+        PrintResult(name + "\tConcurrentStack elimination", MeasureContention(eliminating, threads, count), count);
+    }
+}
+
+// 計測用のスコアのリストを作る関数
+// 入力: 格納先のリスト (DoublyLinkedList<ResultData>& list), 要素数 (int count)
+// 期待結果: 疑似乱数のスコアを持つデータが count 個格納される
+void FillScores(DoublyLinkedList<ResultData>& list, int count) {
+    unsigned int seed = 12345;
+    for (int i = 0; i < count; ++i) {
+        seed = seed * 1103515245 + 12345;
+        list.Insert(list.end(), ResultData{ static_cast<int>((seed >> 8) % 1000000), "User" + std::to_string(i) });
+    }
+}
+
+// スコアの高い順に処理する方法ごとの処理時間を計測する関数
+// 入力: 要素数 (int count), 上位だけを処理する場合の件数 (int top)
+// 期待結果: 読み込み済みのリストから、リストをソートして先頭から辿る方法、1 件ずつプッシュしてポップする方法、
+//           リストからまとめてヒープを作ってポップする方法の全件と上位 top 件の処理時間 (ミリ秒) を表示する
+void BenchmarkPriorityQueue(int count, int top) {
+    auto byScore = [](const ResultData& a, const ResultData& b) { return a.score < b.score; };
+    long long checksum = 0;
+
+    auto measureSort = [&](int limit) {
+        DoublyLinkedList<ResultData> list;
+        FillScores(list, count);
+        return MeasureMilliseconds([&] {
+            list.Sort([](const ResultData& a, const ResultData& b) { return a.score > b.score; });
+            int processed = 0;
+            for (auto it = list.begin(); it != list.end() && processed < limit; ++it, ++processed) {
+                checksum += (*it).score;
+            }
+        });
+    };
+    auto measurePush = [&](int limit) {
+        DoublyLinkedList<ResultData> list;
+        FillScores(list, count);
+        return MeasureMilliseconds([&] {
+            PriorityQueue<ResultData, decltype(byScore)> queue(byScore);
+            for (auto it = list.beginConst(); it != list.endConst(); ++it) {
+                queue.Push(*it);
+            }
+            for (int i = 0; i < limit && !queue.IsEmpty(); ++i) {
+                checksum += queue.Pop().score;
+            }
+        });
+    };
+    auto measureBuild = [&](int limit) {
+        DoublyLinkedList<ResultData> list;
+        FillScores(list, count);
+        return MeasureMilliseconds([&] {
+            PriorityQueue<ResultData, decltype(byScore)> queue(byScore);
+            queue.Build(list);
+            for (int i = 0; i < limit && !queue.IsEmpty(); ++i) {
+                checksum += queue.Pop().score;
+            }
+        });
+    };
+
+    const std::string all = "all";
+    const std::string best = "top " + std::to_string(top);
+    std::cout << "list Sort\t" << all << "\t" << std::fixed << std::setprecision(2) << measureSort(count) << std::endl;
+    std::cout << "PriorityQueue Push+Pop\t" << all << "\t" << measurePush(count) << std::endl;
+    std::cout << "PriorityQueue Build+Pop\t" << all << "\t" << measureBuild(count) << std::endl;
+    std::cout << "list Sort\t" << best << "\t" << measureSort(top) << std::endl;
+    std::cout << "PriorityQueue Push+Pop\t" << best << "\t" << measurePush(top) << std::endl;
+    std::cout << "PriorityQueue Build+Pop\t" << best << "\t" << measureBuild(top) << std::endl;
+    if (checksum == 0) {
+        std::cerr << "empty result" << std::endl;
+    }
+}
+
+// 有界キューで受け渡す処理時間を計測する関数
+// 入力: 要素数 (int count), 容量 (size_t capacity), まとめて取り出す数 (size_t batch、1 の場合は 1 個ずつポップ)
+// 期待結果: 1 要素あたりの時間と、消費者が 1 回のロックで取り出した平均の要素数を表示する
+void MeasureBounded(int count, size_t capacity, size_t batch) {
+    BoundedQueue<ResultData> queue(capacity);
+    long long sum = 0;
+    long long locks = 0;
+    double elapsed = MeasureMilliseconds([&] {
+        std::thread producer([&] {
+            for (int i = 0; i < count; ++i) {
+                queue.Push(ResultData{ i, "User" });
+            }
+            queue.Close();
+        });
+        if (batch == 1) {
+            try {
+                for (;;) {
+                    sum += queue.Pop().score;
+                    locks++;
+                }
+            }
+            catch (const std::out_of_range&) {
+            }
+        }
+        else {
+            std::vector<ResultData> items;
+            while (queue.DrainTo(items, batch) > 0) {
+                locks++;
+                for (const ResultData& item : items) {
+                    sum += item.score;
+                }
+                items.clear();
+            }
+        }
+        producer.join();
+    });
+    if (sum != static_cast<long long>(count) * (count - 1) / 2) {
+        std::cerr << "lost elements" << std::endl;
+    }
+    std::string name = batch == 1 ? "Pop" : "DrainTo(" + std::to_string(batch) + ")";
+    std::cout << capacity << "\t" << name << "\t" << std::fixed << std::setprecision(2) << elapsed * 1000000.0 / count
+        << "\t" << static_cast<double>(count) / (locks > 0 ? locks : 1) << std::endl;
+}
+
+// 有界キューの受け渡しを計測する関数
+// 入力: 要素数 (int count)
+// 期待結果: 容量ごとに、1 個ずつポップする場合とまとめて取り出す場合の 1 要素あたりの時間を表示する
+void BenchmarkBounded(int count) {
+    const size_t capacities[] = { 64, 1024 };
+    for (size_t capacity : capacities) {
+        MeasureBounded(count, capacity, 1);
+        MeasureBounded(count, capacity, 16);
+        MeasureBounded(count, capacity, 64);
+    }
+}
+
+// 分割統治でフィボナッチ数を計算する関数
+// 入力: タスクプール (TaskPool& pool), 項番号 (int n), 逐次計算に切り替える項番号 (int cutoff)
+// 戻り値: fib(n)
+long long ParallelFibonacci(TaskPool& pool, int n, int cutoff) {
+    if (n <= cutoff) {
+        std::function<long long(int)> serial = [&serial](int k) -> long long { return k < 2 ? k : serial(k - 1) + serial(k - 2); };
+        return serial(n);
+    }
+    long long left = 0;
+    TaskGroup group;
+    pool.Run(group, [&pool, &left, n, cutoff] { left = ParallelFibonacci(pool, n - 1, cutoff); });
+    long long right = ParallelFibonacci(pool, n - 2, cutoff);
+    pool.Wait(group);
+    return left + right;
+}
+
+// 分割統治でクイックソートする関数
+// 入力: タスクプール (TaskPool& pool), ソートする範囲 (ResultData* first, ResultData* last), 逐次ソートに切り替える要素数 (ptrdiff_t cutoff)
+// 期待結果: 範囲がスコアの降順に並ぶ
+void ParallelQuickSort(TaskPool& pool, ResultData* first, ResultData* last, std::ptrdiff_t cutoff) {
+    auto byScore = [](const ResultData& a, const ResultData& b) { return a.score > b.score; };
+    if (last - first <= cutoff) {
+        std::sort(first, last, byScore);
+        return;
+    }
+    int pivot = first[(last - first) / 2].score;
+    ResultData* middle = std::partition(first, last, [pivot](const ResultData& data) { return data.score > pivot; });
+    ResultData* equal = std::partition(middle, last, [pivot](const ResultData& data) { return data.score == pivot; });
+    TaskGroup group;
+    pool.Run(group, [&pool, first, middle, cutoff] { ParallelQuickSort(pool, first, middle, cutoff); });
+    ParallelQuickSort(pool, equal, last, cutoff);
+    pool.Wait(group);
+}
+
+// ワークスティーリングのタスクプールのスケーリングを計測する関数
+// 入力: ソートする要素数 (int count)
+// 期待結果: スレッド数を 1 から 8 まで増やしながら、fib(32) と、リストの要素を配列に移して並列にソートし書き戻す処理時間 (ミリ秒) を表示する
+//           比較として、リストの Sort の処理時間を最初に表示する
+void BenchmarkForkJoin(int count) {
+    {
+        DoublyLinkedList<ResultData> list;
+        FillScores(list, count);
+        double elapsed = MeasureMilliseconds([&] {
+            list.Sort([](const ResultData& a, const ResultData& b) { return a.score > b.score; });
+        });
+        std::cout << "-\tlist Sort\t" << std::fixed << std::setprecision(2) << elapsed << std::endl;
+    }
+
+    for (unsigned threads = 1; threads <= 8; threads *= 2) {
+        TaskPool pool(threads);
+        long long fib = 0;
+        double elapsed = MeasureMilliseconds([&] {
+            fib = ParallelFibonacci(pool, 32, 12);
+        });
+        std::cout << threads << "\tfib(32)\t" << elapsed << std::endl;
+        if (fib != 2178309) {
+            std::cerr << "wrong result" << std::endl;
+        }
+
+        DoublyLinkedList<ResultData> list;
+        FillScores(list, count);
+        elapsed = MeasureMilliseconds([&] {
+            std::vector<ResultData> items;
+            items.reserve(list.Getsize());
+            for (auto it = list.begin(); it != list.end(); ++it) {
+                items.push_back(std::move(*it));
+            }
+            ParallelQuickSort(pool, items.data(), items.data() + items.size(), 4096);
+            size_t i = 0;
+            for (auto it = list.begin(); it != list.end(); ++it) {
+                *it = std::move(items[i++]);
+            }
+        });
+        std::cout << threads << "\tparallel Sort\t" << elapsed << std::endl;
+    }
+}
+
+/**
+ * @brief 遅延処理するスコア構造体
+ */
+struct DelayedScore {
+    std::chrono::steady_clock::time_point deadline; // 処理してよい時刻
+    int score;                                      // スコア
+};
+
+// 計測用の期限 (開始時刻からの時間) を作る関数
+// 入力: 要素数 (int count), 期限をばらまく範囲 (std::chrono::milliseconds spread)
+// 戻り値: 疑似乱数の期限を count 個格納した配列
+std::vector<std::chrono::steady_clock::duration> MakeDelays(int count, std::chrono::milliseconds spread) {
+    std::vector<std::chrono::steady_clock::duration> delays;
+    delays.reserve(count);
+    unsigned int seed = 12345;
+    long long range = std::chrono::duration_cast<std::chrono::microseconds>(spread).count();
+    for (int i = 0; i < count; ++i) {
+        seed = seed * 1103515245 + 12345;
+        delays.push_back(std::chrono::microseconds(static_cast<long long>(seed >> 4) % range));
+    }
+    return delays;
+}
+
+// 遅延処理の計測結果を表示する関数
+// 入力: 方式の名前 (const std::string& name), 要素数 (int count), プッシュの処理時間 (double pushMilliseconds),
+//       取り出しに使った CPU 時間 (std::clock_t popClocks), 期限からの最大の遅れ (std::chrono::steady_clock::duration late)
+// 期待結果: プッシュと取り出しの 1 要素あたりの時間と、最大の遅れ (ミリ秒) を表示する
+void PrintDelayResult(const std::string& name, int count, double pushMilliseconds, std::clock_t popClocks, std::chrono::steady_clock::duration late) {
+    double popNanoseconds = static_cast<double>(popClocks) * 1000000000.0 / CLOCKS_PER_SEC / count;
+    std::cout << name << "\t" << std::fixed << std::setprecision(2) << pushMilliseconds * 1000000.0 / count << "\t" << popNanoseconds
+        << "\t" << std::chrono::duration<double, std::milli>(late).count() << std::endl;
+}
+
+// 遅延キューで期限付きの要素を処理する時間を計測する関数
+// 入力: 期限の配列 (const std::vector<...>& delays), 1 刻みの長さ (std::chrono::steady_clock::duration tick), 方式の名前 (const std::string& name)
+// 期待結果: 全ての要素をプッシュしてから PopReady で期限順に取り出し、結果を表示する
+void MeasureDelayQueue(const std::vector<std::chrono::steady_clock::duration>& delays, std::chrono::steady_clock::duration tick, const std::string& name) {
+    int count = static_cast<int>(delays.size());
+    DelayQueue<DelayedScore> queue(tick);
+    auto start = std::chrono::steady_clock::now() + std::chrono::milliseconds(500); // プッシュし終わってから期限が来るようにずらす
+    double pushMilliseconds = MeasureMilliseconds([&] {
+        for (int i = 0; i < count; ++i) {
+            queue.PushAt(DelayedScore{ start + delays[i], i }, start + delays[i]);
+        }
+    });
+
+    std::chrono::steady_clock::duration late = std::chrono::steady_clock::duration::zero();
+    std::clock_t cpuStart = std::clock();
+    DelayedScore item;
+    for (int i = 0; i < count && queue.PopReady(item, std::chrono::seconds(10)); ++i) {
+        late = std::max(late, std::chrono::steady_clock::now() - item.deadline);
+    }
+    PrintDelayResult(name, count, pushMilliseconds, std::clock() - cpuStart, late);
+}
+
+// 期限の早い順のヒープで期限付きの要素を処理する時間を計測する関数
+// 入力: 期限の配列 (const std::vector<...>& delays), 先頭の期限まで眠らずに確認を繰り返す場合は true (bool poll)
+// 期待結果: 全ての要素をプッシュしてから、先頭の期限を過ぎた要素を順に取り出し、結果を表示する
+void MeasureHeapTimers(const std::vector<std::chrono::steady_clock::duration>& delays, bool poll) {
+    auto earlier = [](const DelayedScore& a, const DelayedScore& b) { return a.deadline > b.deadline; };
+    int count = static_cast<int>(delays.size());
+    PriorityQueue<DelayedScore, decltype(earlier)> heap(earlier);
+    auto start = std::chrono::steady_clock::now() + std::chrono::milliseconds(500); // プッシュし終わってから期限が来るようにずらす
+    double pushMilliseconds = MeasureMilliseconds([&] {
+        for (int i = 0; i < count; ++i) {
+            heap.Push(DelayedScore{ start + delays[i], i });
+        }
+    });
+
+    std::chrono::steady_clock::duration late = std::chrono::steady_clock::duration::zero();
+    std::clock_t cpuStart = std::clock();
+    while (!heap.IsEmpty()) {
+        auto now = std::chrono::steady_clock::now();
+        if (heap.Top().deadline <= now) {
+            late = std::max(late, now - heap.Pop().deadline);
+        }
+        else if (poll) {
+            std::this_thread::yield();
+        }
+        else {
+            std::this_thread::sleep_until(heap.Top().deadline);
+        }
+    }
+    PrintDelayResult(poll ? "PriorityQueue poll" : "PriorityQueue sleep", count, pushMilliseconds, std::clock() - cpuStart, late);
+}
+
+// 期限付きの要素の処理方式ごとの時間を計測する関数
+// 入力: 要素数 (int count)
+// 期待結果: 1 秒の範囲にばらまいた期限で、ヒープを確認し続ける方式、ヒープの先頭まで眠る方式、遅延キュー (1 ミリ秒 / 100 マイクロ秒刻み) の結果を表示する
+void BenchmarkDelay(int count) {
+    std::vector<std::chrono::steady_clock::duration> delays = MakeDelays(count, std::chrono::milliseconds(1000));
+    MeasureHeapTimers(delays, true);
+    MeasureHeapTimers(delays, false);
+    MeasureDelayQueue(delays, std::chrono::milliseconds(1), "DelayQueue 1ms");
+    MeasureDelayQueue(delays, std::chrono::microseconds(100), "DelayQueue 100us");
+}
+
+// メイン関数
+// 入力: コマンドライン引数 (ベンチマーク名, 要素数)
+// 期待結果: 指定したベンチマークを実行して結果を表示する
+int main(int argc, char** argv) {
+    std::string name = argc > 1 ? argv[1] : "storage";
+    int count = argc > 2 ? std::atoi(argv[2]) : 1000000;
+
+    if (name == "storage") {
+        std::cout << "Stack / Queue Storage (" << count << " elements)" << std::endl;
+        std::cout << "type\tstorage\toperation\tns/op" << std::endl;
+        BenchmarkStorage<int, ListStorage<int>>(count, "int\tList");
+        BenchmarkStorage<int, ChunkedStorage<int>>(count, "int\tChunked");
+        BenchmarkStorage<ResultData, ListStorage<ResultData>>(count, "ResultData\tList");
+        BenchmarkStorage<ResultData, ChunkedStorage<ResultData>>(count, "ResultData\tChunked");
+    }
+    else if (name == "alloc") {
+        std::cout << "Allocations per Operation (" << count << " operations)" << std::endl;
+        std::cout << "storage\toperation\tallocs/op\tns/op" << std::endl;
+        BenchmarkAllocations<ListStorage<ResultData>>(count, "List");
+        BenchmarkAllocations<ChunkedStorage<ResultData>>(count, "Chunked");
+    }
+    else if (name == "spsc") {
+        std::cout << "Single Producer / Single Consumer (" << count << " elements)" << std::endl;
+        std::cout << "queue\tmeasure\tns/op" << std::endl;
+        BenchmarkSpsc(count);
+    }
+    else if (name == "mpmc") {
+        std::cout << "Multiple Producers / Multiple Consumers (" << count << " elements)" << std::endl;
+        std::cout << "threads\tqueue\tns/op" << std::endl;
+        BenchmarkMpmc(count);
+    }
+    else if (name == "stack") {
+        std::cout << "Concurrent Stack Contention (" << count << " push/pop pairs)" << std::endl;
+        std::cout << "threads\tstack\tns/op" << std::endl;
+        BenchmarkStack(count);
+    }
+    else if (name == "pq") {
+        std::cout << "Score-ordered Processing (" << count << " elements)" << std::endl;
+        std::cout << "method\tprocessed\tms" << std::endl;
+        BenchmarkPriorityQueue(count, 100);
+    }
+    else if (name == "bounded") {
+        std::cout << "Bounded Queue (" << count << " elements)" << std::endl;
+        std::cout << "capacity\tconsumer\tns/op\telements/lock" << std::endl;
+        BenchmarkBounded(count);
+    }
+    else if (name == "forkjoin") {
+        std::cout << "Fork-Join Scaling (" << count << " elements to sort)" << std::endl;
+        std::cout << "threads\ttask\tms" << std::endl;
+        BenchmarkForkJoin(count);
+    }
+    else if (name == "delay") {
+        std::cout << "Delayed Processing (" << count << " timers within 1 s)" << std::endl;
+        std::cout << "method\tpush ns/op\tpop cpu ns/op\tmax late ms" << std::endl;
+        BenchmarkDelay(count);
+    }
+    else {
+        std::cerr << "Usage: SQBench [storage|alloc|spsc|mpmc|stack|pq|bounded|forkjoin|delay] [count]" << std::endl;
+        return -1;
+    }
+    return 0;
+}
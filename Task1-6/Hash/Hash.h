@@ -1,6 +1,8 @@
 ﻿#pragma once
 #include <vector>
 #include <functional>
+#include <memory>
+#include "NodePool.h"
 
 // ペア構造体
 // キーと値を格納するための構造体
@@ -22,20 +24,29 @@ struct Node {
 
 // ダブルリンクリストクラス
 // 入力: キーと値のペアを格納するダブルリンクリストの実装
-template<typename KeyType, typename ValueType>
+// ノードは Allocator から確保する (既定では NodePool のページから切り出し、挿入・削除ごとの new / delete を避ける)
+template<typename KeyType, typename ValueType, typename Allocator = PoolAllocator<Pair<KeyType, ValueType>>>
 class DoublyLinkedList {
 private:
+    typedef typename std::allocator_traits<Allocator>::template rebind_alloc<Node<KeyType, ValueType>> NodeAllocator;
+    typedef std::allocator_traits<NodeAllocator> NodeTraits;
+
     Node<KeyType, ValueType>* head;  // リストの先頭ノード
     Node<KeyType, ValueType>* tail;  // リストの末尾ノード
     size_t size;  // リストのサイズ
+    NodeAllocator allocator;  // ノードを確保するアロケータ
+
+    Node<KeyType, ValueType>* createNode(const Pair<KeyType, ValueType>& data);  // ノードを生成 (アロケータから確保する)
+    void destroyNode(Node<KeyType, ValueType>* node);  // ノードを破棄 (領域はアロケータに返す)
 
 public:
-    DoublyLinkedList();  // コンストラクタ
+    explicit DoublyLinkedList(const Allocator& allocator = Allocator());  // コンストラクタ (省略時は既定のアロケータ)
     ~DoublyLinkedList();  // デストラクタ
     size_t GetSize() const;  // リストのサイズを取得
     void Insert(const Pair<KeyType, ValueType>& data);  // ノードを挿入
     bool Delete(const KeyType& key);  // ノードを削除
     Node<KeyType, ValueType>* Search(const KeyType& key) const;  // ノードを検索
+    void Clear();  // 全ノードを削除
 
     Node<KeyType, ValueType>* begin() const { return head; }  // リストの先頭ノードを取得
     Node<KeyType, ValueType>* end() const { return nullptr; }  // リストの末尾ノードを取得
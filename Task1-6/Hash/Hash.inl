@@ -2,34 +2,54 @@
 
 // DoublyLinkedList クラスのコンストラクタ
 // 期待結果: 空のダブルリンクリストが生成される
-template<typename KeyType, typename ValueType>
-DoublyLinkedList<KeyType, ValueType>::DoublyLinkedList() : head(nullptr), tail(nullptr), size(0) {}
+template<typename KeyType, typename ValueType, typename Allocator>
+DoublyLinkedList<KeyType, ValueType, Allocator>::DoublyLinkedList(const Allocator& allocator) : head(nullptr), tail(nullptr), size(0), allocator(allocator) {}
+
+// ノードを生成する関数
+// 引数: 格納するデータ (Pair)
+// 戻り値: アロケータから確保した領域に構築したノード
+template<typename KeyType, typename ValueType, typename Allocator>
+Node<KeyType, ValueType>* DoublyLinkedList<KeyType, ValueType, Allocator>::createNode(const Pair<KeyType, ValueType>& data) {
+    Node<KeyType, ValueType>* node = NodeTraits::allocate(allocator, 1);
+    try {
+        NodeTraits::construct(allocator, node, data);
+    }
+    catch (...) {
+        NodeTraits::deallocate(allocator, node, 1);
+        throw;
+    }
+    return node;
+}
+
+// ノードを破棄する関数
+// 引数: 破棄するノード
+// 期待結果: ノードが破棄され、領域がアロケータに返される
+template<typename KeyType, typename ValueType, typename Allocator>
+void DoublyLinkedList<KeyType, ValueType, Allocator>::destroyNode(Node<KeyType, ValueType>* node) {
+    NodeTraits::destroy(allocator, node);
+    NodeTraits::deallocate(allocator, node, 1);
+}
 
 // DoublyLinkedList クラスのデストラクタ
 // 期待結果: リストの全ノードが削除される
-template<typename KeyType, typename ValueType>
-DoublyLinkedList<KeyType, ValueType>::~DoublyLinkedList() {
-    Node<KeyType, ValueType>* current = head;
-    while (current) {
-        Node<KeyType, ValueType>* next = current->next;
-        delete current;
-        current = next;
-    }
+template<typename KeyType, typename ValueType, typename Allocator>
+DoublyLinkedList<KeyType, ValueType, Allocator>::~DoublyLinkedList() {
+    Clear();
 }
 
 // リストのサイズを取得する関数
 // 戻り値: リストのサイズ
-template<typename KeyType, typename ValueType>
-size_t DoublyLinkedList<KeyType, ValueType>::GetSize() const {
+template<typename KeyType, typename ValueType, typename Allocator>
+size_t DoublyLinkedList<KeyType, ValueType, Allocator>::GetSize() const {
     return size;
 }
 
 // ノードをリストに挿入する関数
 // 引数: 挿入するデータ (Pair)
 // 期待結果: ノードがリストに追加される
-template<typename KeyType, typename ValueType>
-void DoublyLinkedList<KeyType, ValueType>::Insert(const Pair<KeyType, ValueType>& data) {
-    Node<KeyType, ValueType>* newNode = new Node<KeyType, ValueType>(data);
+template<typename KeyType, typename ValueType, typename Allocator>
+void DoublyLinkedList<KeyType, ValueType, Allocator>::Insert(const Pair<KeyType, ValueType>& data) {
+    Node<KeyType, ValueType>* newNode = createNode(data);
     if (!head) {
         head = tail = newNode;
     }
@@ -44,8 +64,8 @@ void DoublyLinkedList<KeyType, ValueType>::Insert(const Pair<KeyType, ValueType>
 // キーでノードを削除する関数
 // 引数: 削除するキー
 // 戻り値: 削除に成功した場合は true, それ以外は false
-template<typename KeyType, typename ValueType>
-bool DoublyLinkedList<KeyType, ValueType>::Delete(const KeyType& key) {
+template<typename KeyType, typename ValueType, typename Allocator>
+bool DoublyLinkedList<KeyType, ValueType, Allocator>::Delete(const KeyType& key) {
     Node<KeyType, ValueType>* current = head;
     while (current) {
         if (current->data.key == key) {
@@ -61,7 +81,7 @@ bool DoublyLinkedList<KeyType, ValueType>::Delete(const KeyType& key) {
             else {
                 tail = current->prev;
             }
-            delete current;
+            destroyNode(current);
             size--;
             return true;
         }
@@ -73,8 +93,8 @@ bool DoublyLinkedList<KeyType, ValueType>::Delete(const KeyType& key) {
 // キーでノードを検索する関数
 // 引数: 検索するキー
 // 戻り値: 検索に成功した場合はノードへのポインタを返す、それ以外は nullptr を返す
-template<typename KeyType, typename ValueType>
-Node<KeyType, ValueType>* DoublyLinkedList<KeyType, ValueType>::Search(const KeyType& key) const {
+template<typename KeyType, typename ValueType, typename Allocator>
+Node<KeyType, ValueType>* DoublyLinkedList<KeyType, ValueType, Allocator>::Search(const KeyType& key) const {
     Node<KeyType, ValueType>* current = head;
     while (current) {
         if (current->data.key == key) {
@@ -85,6 +105,21 @@ Node<KeyType, ValueType>* DoublyLinkedList<KeyType, ValueType>::Search(const Key
     return nullptr;
 }
 
+// 全ノードを削除する関数
+// 期待結果: 全ノードが破棄されて領域がアロケータに返され、リストが空になる
+template<typename KeyType, typename ValueType, typename Allocator>
+void DoublyLinkedList<KeyType, ValueType, Allocator>::Clear() {
+    Node<KeyType, ValueType>* current = head;
+    while (current) {
+        Node<KeyType, ValueType>* next = current->next;
+        destroyNode(current);
+        current = next;
+    }
+    head = nullptr;
+    tail = nullptr;
+    size = 0;
+}
+
 // HashTable クラスのコンストラクタ
 // 期待結果: 指定されたバケット数でハッシュテーブルが初期化される
 template<typename KeyType, typename ValueType, typename HashFunction>
@@ -525,3 +525,59 @@ TEST(HashFind, TestConst) {
 #endif //SKIP_TEST
     SUCCEED();
 }
+
+//テスト35:全ての要素を削除した後に再び挿入した際の挙動
+//テスト項目:ハッシュテーブル
+//インターフェース:データの挿入、削除、検索
+//想定する戻り値:TRUE
+//意図する結果:削除で返されたノード領域が再利用され、再挿入した値が正しく検索できる
+//補足:ノードプールのページ解放後の再確保と、既定以外のアロケータ (std::allocator) を指定したリストもチェック
+TEST(HashAllocator, ReinsertAfterDeleteAll) {
+    HashTable<int, std::string> hashTable(10);
+    for (int i = 0; i < 1000; ++i) {
+        hashTable.Insert(i, std::to_string(i));
+    }
+    for (int i = 0; i < 1000; ++i) {
+        hashTable.Delete(i);
+    }
+    assert(hashTable.Size() == 0);
+    for (int i = 0; i < 1000; ++i) {
+        hashTable.Insert(i, std::to_string(i * 2));
+    }
+    std::string value;
+    bool found = hashTable.Search(999, value);
+    assert(found && value == "1998" && hashTable.Size() == 1000);
+
+    DoublyLinkedList<int, std::string, std::allocator<Pair<int, std::string>>> list;
+    list.Insert({ 1, "One" });
+    list.Insert({ 2, "Two" });
+    bool deleted = list.Delete(1);
+    assert(deleted && list.GetSize() == 1 && list.Search(2)->data.value == "Two");
+}
+
+//テスト36:ダブルリンクリストの全ノードを削除した際の挙動
+//テスト項目:ダブルリンクリスト
+//インターフェース:全ノードの削除
+//想定する戻り値:なし
+//意図する結果:全ノードの領域がノードプールに返されてリストが空になり、その後も挿入と検索ができる
+//補足:Clear を 2 回呼んでも問題ないこともチェック
+TEST(HashAllocator, ClearReturnsNodes) {
+    typedef NodePool<sizeof(Node<int, std::string>), alignof(Node<int, std::string>)> Pool;
+    size_t before = Pool::GetLiveCount();
+    DoublyLinkedList<int, std::string> list;
+    for (int i = 0; i < 100; ++i) {
+        list.Insert({ i, std::to_string(i) });
+    }
+    EXPECT_EQ(Pool::GetLiveCount(), before + 100);
+    list.Clear();
+    EXPECT_EQ(list.GetSize(), 0u);
+    EXPECT_EQ(list.begin(), list.end());
+    EXPECT_EQ(Pool::GetLiveCount(), before);
+    list.Clear();
+    EXPECT_EQ(list.GetSize(), 0u);
+
+    list.Insert({ 7, "Seven" });
+    ASSERT_NE(list.Search(7), nullptr);
+    EXPECT_EQ(list.Search(7)->data.value, "Seven");
+    EXPECT_EQ(list.GetSize(), 1u);
+}
@@ -0,0 +1,97 @@
+﻿#pragma once
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+// ノードプールクラス
+// 同じ大きさのノード領域を 64 KiB のページから切り出して配るメモリプール
+// 解放された領域は空きリストで再利用するため、確保・解放はポインタの付け替えだけで済む
+// スレッドごとに (領域の大きさと境界ごとに) 1 つを持ち、プール上の領域が全て解放された時点で
+// 切り出し中のページ 1 枚を残してページをまとめて返す
+// 各領域の前に確保元のプールを記録し (malloc の管理領域と同程度の 1 ワード)、
+// 他のスレッドで解放された領域は確保元のプールの別のリストに積んで、確保元のスレッドが次に確保する時にまとめて回収する
+template<size_t Size, size_t Align>
+class NodePool {
+private:
+    // ノード領域
+    struct Slot {
+        NodePool* owner;  // 確保元のプール
+        union {
+            Slot* next;  // 空いている間は次の空き領域
+            typename std::aligned_storage<Size, Align>::type storage;
+        };
+    };
+
+    // スレッドが終了した時にプールを手放すための保持クラス
+    struct LocalHolder {
+        NodePool* pool = nullptr;  // 呼び出し元スレッドのプール
+        ~LocalHolder();
+    };
+
+    static const size_t PageSize = 64 * 1024;  // ページの大きさ (バイト)
+
+    std::vector<Slot*> pages;  // 確保したページ (末尾が切り出し中のページ)
+    Slot* freeList;  // 空き領域のリスト
+    Slot* cursor;  // 切り出し中のページの未使用部分の先頭
+    Slot* limit;  // 切り出し中のページの末尾
+    size_t live;  // 使用中の領域数 (他のスレッドで解放されて未回収の領域を含む)
+    std::mutex remoteMutex;  // 以下の 3 つを保護するミューテックス
+    Slot* remoteList;  // 他のスレッドから解放された領域のリスト
+    size_t remoteCount;  // remoteList の領域数
+    bool orphaned;  // 確保元のスレッドが終了した場合は true
+    std::atomic<bool> hasRemote;  // remoteList が空でない場合は true
+
+    static LocalHolder& holder();  // 呼び出し元スレッドのプールの保持クラスを取得
+    static NodePool& local();  // 呼び出し元スレッドのプールを取得 (初回の呼び出しで生成する)
+
+    NodePool();  // コンストラクタ
+    ~NodePool();  // デストラクタ (全てのページを解放する)
+
+    Slot* allocateSlot();  // 空きリストまたは切り出し中のページから領域を取り出す
+    void freeLocal(Slot* slot);  // 確保元のスレッドで領域を解放 (全て解放された場合はページを返す)
+    void freeRemote(Slot* slot);  // 他のスレッドで領域を解放
+    void addPage();  // ページを追加
+    void collectRemote();  // 他のスレッドから解放された領域を回収
+    void releasePages();  // 全ての領域が解放されたプールのページを返す
+    void abandon();  // 確保元のスレッドの終了時にプールを手放す
+
+public:
+    static const size_t SlotsPerPage = PageSize / sizeof(Slot);  // 1 ページあたりの領域数
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    static void* Allocate();  // 呼び出し元スレッドのプールから Size バイト・Align 境界の領域を確保
+    static void Deallocate(void* memory);  // 領域を確保元のプールに返す (どのスレッドで確保したものでもよい)
+    static size_t GetPageCount();  // 呼び出し元スレッドのプールが確保しているページ数を取得
+    static size_t GetLiveCount();  // 呼び出し元スレッドのプールの使用中の領域数を取得
+};
+
+// プールアロケータクラス
+// NodePool から 1 要素ずつの領域を確保するアロケータ (複数要素の確保は operator new に任せる)
+// 状態を持たず、どのインスタンスで確保した領域もどのインスタンスでも解放できる
+template<typename T>
+class PoolAllocator {
+public:
+    typedef T value_type;
+    typedef NodePool<sizeof(T), alignof(T)> Pool;
+
+    static_assert(alignof(T) <= alignof(std::max_align_t), "PoolAllocator does not support over-aligned types");
+
+    PoolAllocator() {}  // コンストラクタ
+    template<typename U>
+    PoolAllocator(const PoolAllocator<U>&) {}  // 別の型のアロケータからのコンストラクタ
+
+    T* allocate(size_t count);  // count 要素分の領域を確保
+    void deallocate(T* memory, size_t count);  // 領域を確保元に返す
+};
+
+// アロケータの等価比較 (状態を持たないため常に等しい)
+template<typename T, typename U>
+bool operator==(const PoolAllocator<T>&, const PoolAllocator<U>&) { return true; }
+template<typename T, typename U>
+bool operator!=(const PoolAllocator<T>&, const PoolAllocator<U>&) { return false; }
+
+#include "NodePool.inl"
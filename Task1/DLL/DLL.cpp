@@ -2,6 +2,7 @@
 #include <fstream>
 #include <sstream>
 #include <string>
+#include "NodePool.h"
 
 // Define node
 struct Node {
@@ -14,6 +15,8 @@ struct Node {
 // Double linked list defince
 class DoublyLinkedList {
 private:
+    typedef NodePool<sizeof(Node), alignof(Node)> Pool; // Pool for node memory
+
     Node* head;
     Node* tail;
 
@@ -22,7 +25,15 @@ public:
 
     // Add node
     void addNode(int score, const std::string& username) {
-        Node* newNode = new Node{ score, username, nullptr, nullptr };
+        void* memory = Pool::Allocate();
+        Node* newNode;
+        try {
+            newNode = new (memory) Node{ score, username, nullptr, nullptr };
+        }
+        catch (...) {
+            Pool::Deallocate(memory); // Return memory if username copy fails
+            throw;
+        }
         if (!head) {
             head = tail = newNode;
         }
@@ -47,7 +58,8 @@ public:
         Node* current = head;
         while (current) {
             Node* next = current->next;
-            delete current;
+            current->~Node();
+            Pool::Deallocate(current);
             current = next;
         }
     }